@@ -41,12 +41,14 @@ class UnitsConan(ConanFile):
         "gsl-lite/0.38.1"
     )
     options = {
-        "downcast_mode": ["off", "on", "auto"],
-        "build_docs": [True, False]
+        "downcast_mode": ["off", "on", "auto", "registry"],
+        "build_docs": [True, False],
+        "build_instantiations": [True, False]
     }
     default_options = {
         "downcast_mode": "on",
-        "build_docs": True
+        "build_docs": True,
+        "build_instantiations": False
     }
     exports = ["LICENSE.md"]
     exports_sources = ["docs/*", "src/*", "test/*", "cmake/*", "example/*","CMakeLists.txt"]
@@ -106,6 +108,7 @@ class UnitsConan(ConanFile):
         tc.variables["UNITS_DOWNCAST_MODE"] = str(self.options.downcast_mode).upper()
         # if self._run_tests:  # TODO Enable this when environment is supported in the Conan toolchain
         tc.variables["UNITS_BUILD_DOCS"] = self.options.build_docs
+        tc.variables["UNITS_BUILD_INSTANTIATIONS"] = self.options.build_instantiations
         tc.generate()
         deps = CMakeDeps(self)
         deps.generate()
@@ -123,7 +126,8 @@ class UnitsConan(ConanFile):
         cmake.install()
 
     def package_id(self):
-        self.info.header_only()
+        if not self.options.build_instantiations:
+            self.info.header_only()
 
     def package_info(self):
         compiler = self.settings.compiler
@@ -151,3 +155,8 @@ class UnitsConan(ConanFile):
         self.cpp_info.components["si-uscs"].requires = ["si"]
         self.cpp_info.components["isq-iec80000"].requires = ["si"]
         self.cpp_info.components["systems"].requires = ["isq", "isq-natural", "si", "si-cgs", "si-fps", "si-hep", "si-iau", "si-imperial", "si-international", "si-typographic", "si-uscs", "isq-iec80000"]
+
+        # explicit instantiations
+        if self.options.build_instantiations:
+            self.cpp_info.components["instantiations"].requires = ["core-fmt", "core-io", "si"]
+            self.cpp_info.components["instantiations"].libs = ["mp-units-instantiations"]
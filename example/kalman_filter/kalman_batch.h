@@ -0,0 +1,231 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/bits/external/type_traits.h>
+#include <units/linear_algebra.h>
+#include <gsl/gsl-lite.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace kalman {
+
+template<typename T>
+concept Vector = units::is_specialization_of<T, units::la::vector>;
+
+// Kalman filter for many independent tracks sharing the same model
+//
+// The state and the covariance of all the tracks are stored as a structure of arrays: every number
+// of the state vector and of the covariance matrix has its own row with one entry per track. Every
+// step of the filter is a sequence of loops over contiguous rows, so the work is vectorized across
+// tracks. The dimensions of all the matrices are checked once at the type level by `units::la`,
+// while the kernels operate on raw numbers only.
+template<Vector State, Vector Measurement>
+  requires (State::size <= 9) && (Measurement::size <= State::size)
+class batch {
+public:
+  using state_type = State;
+  using measurement_type = Measurement;
+  using transition_matrix = units::la::matrix<State, State>;
+  using covariance_matrix = units::la::matrix<State, units::la::inverse_vector<State>>;
+  using observation_matrix = units::la::matrix<Measurement, State>;
+  using measurement_covariance_matrix = units::la::matrix<Measurement, units::la::inverse_vector<Measurement>>;
+
+private:
+  static constexpr std::size_t n = State::size;
+  static constexpr std::size_t m = Measurement::size;
+  // tracks are processed in blocks small enough to keep all the rows of a block in cache
+  static constexpr std::size_t block = 256;
+
+  std::size_t tracks_;
+  std::vector<double> x_;        // n rows
+  std::vector<double> p_;        // n * n rows
+  std::vector<double> scratch_;  // rows of a single block allocated once to not allocate in `predict()` and `update()`
+
+  double* row(std::vector<double>& v, std::size_t i, std::size_t first = 0) { return v.data() + i * tracks_ + first; }
+  const double* row(const std::vector<double>& v, std::size_t i) const { return v.data() + i * tracks_; }
+  double* tmp(std::size_t i) { return scratch_.data() + i * block; }
+
+  // y += a * x
+  static void axpy(std::size_t count, double a, const double* x, double* y)
+  {
+    if (a == 0.) return;
+    for (std::size_t t = 0; t < count; ++t) y[t] += a * x[t];
+  }
+
+  // z += x * y (element-wise)
+  static void mul_add(std::size_t count, const double* x, const double* y, double* z)
+  {
+    for (std::size_t t = 0; t < count; ++t) z[t] += x[t] * y[t];
+  }
+
+  void predict(std::span<const double> fn, std::span<const double> qn, std::size_t first, std::size_t count)
+  {
+    // x = F x
+    std::fill(scratch_.begin(), scratch_.end(), 0.);
+    for (std::size_t i = 0; i < n; ++i)
+      for (std::size_t j = 0; j < n; ++j) axpy(count, fn[i * n + j], row(x_, j, first), tmp(i));
+    for (std::size_t i = 0; i < n; ++i) std::copy_n(tmp(i), count, row(x_, i, first));
+
+    // tmp = F P
+    std::fill(scratch_.begin(), scratch_.end(), 0.);
+    for (std::size_t i = 0; i < n; ++i)
+      for (std::size_t k = 0; k < n; ++k)
+        for (std::size_t j = 0; j < n; ++j) axpy(count, fn[i * n + k], row(p_, k * n + j, first), tmp(i * n + j));
+
+    // P = tmp F^T + Q
+    for (std::size_t i = 0; i < n; ++i)
+      for (std::size_t j = 0; j < n; ++j) {
+        double* p = row(p_, i * n + j, first);
+        std::fill_n(p, count, qn[i * n + j]);
+        for (std::size_t k = 0; k < n; ++k) axpy(count, fn[j * n + k], tmp(i * n + k), p);
+      }
+  }
+
+  void update(std::span<const double> hn, std::span<const double> rn, std::span<const Measurement> z, std::size_t first,
+              std::size_t count)
+  {
+    constexpr std::size_t pht = 0;          // n * m rows of P H^T
+    constexpr std::size_t s = pht + n * m;  // m * m rows of S inverted in place
+    constexpr std::size_t y = s + m * m;    // m rows of innovation
+    constexpr std::size_t k = y + m;        // n * m rows of the gain
+    constexpr std::size_t d = k + n * m;    // a row of temporary values
+    std::fill(scratch_.begin(), scratch_.end(), 0.);
+
+    for (std::size_t i = 0; i < n; ++i)
+      for (std::size_t a = 0; a < m; ++a)
+        for (std::size_t j = 0; j < n; ++j) axpy(count, hn[a * n + j], row(p_, i * n + j, first), tmp(pht + i * m + a));
+
+    for (std::size_t a = 0; a < m; ++a)
+      for (std::size_t b = 0; b < m; ++b) {
+        double* sab = tmp(s + a * m + b);
+        std::fill_n(sab, count, rn[a * m + b]);
+        for (std::size_t j = 0; j < n; ++j) axpy(count, hn[a * n + j], tmp(pht + j * m + b), sab);
+      }
+
+    // S is symmetric positive-definite so the in-place Gauss-Jordan inversion does not need pivoting
+    double* dt = tmp(d);
+    for (std::size_t c = 0; c < m; ++c) {
+      double* scc = tmp(s + c * m + c);
+      for (std::size_t t = 0; t < count; ++t) {
+        dt[t] = 1. / scc[t];
+        scc[t] = 1.;
+      }
+      for (std::size_t j = 0; j < m; ++j) {
+        double* scj = tmp(s + c * m + j);
+        for (std::size_t t = 0; t < count; ++t) scj[t] *= dt[t];
+      }
+      for (std::size_t i = 0; i < m; ++i) {
+        if (i == c) continue;
+        double* sic = tmp(s + i * m + c);
+        std::copy_n(sic, count, dt);
+        std::fill_n(sic, count, 0.);
+        for (std::size_t j = 0; j < m; ++j) {
+          const double* scj = tmp(s + c * m + j);
+          double* sij = tmp(s + i * m + j);
+          for (std::size_t t = 0; t < count; ++t) sij[t] -= dt[t] * scj[t];
+        }
+      }
+    }
+
+    for (std::size_t a = 0; a < m; ++a) {
+      double* ya = tmp(y + a);
+      for (std::size_t t = 0; t < count; ++t) ya[t] = z[first + t].numbers()[a];
+      for (std::size_t j = 0; j < n; ++j) axpy(count, -hn[a * n + j], row(x_, j, first), ya);
+    }
+
+    for (std::size_t i = 0; i < n; ++i)
+      for (std::size_t a = 0; a < m; ++a)
+        for (std::size_t b = 0; b < m; ++b) mul_add(count, tmp(pht + i * m + b), tmp(s + b * m + a), tmp(k + i * m + a));
+
+    for (std::size_t i = 0; i < n; ++i)
+      for (std::size_t a = 0; a < m; ++a) mul_add(count, tmp(k + i * m + a), tmp(y + a), row(x_, i, first));
+
+    // H P = (P H^T)^T as P is symmetric
+    for (std::size_t i = 0; i < n; ++i)
+      for (std::size_t j = 0; j < n; ++j) {
+        double* pij = row(p_, i * n + j, first);
+        for (std::size_t a = 0; a < m; ++a) {
+          const double* kia = tmp(k + i * m + a);
+          const double* phja = tmp(pht + j * m + a);
+          for (std::size_t t = 0; t < count; ++t) pij[t] -= kia[t] * phja[t];
+        }
+      }
+  }
+
+public:
+  batch(std::size_t tracks, const State& initial, const covariance_matrix& uncertainty) :
+      tracks_(tracks), x_(n * tracks), p_(n * n * tracks), scratch_(std::max(n * n, 2 * n * m + m * m + m + 1) * block)
+  {
+    for (std::size_t i = 0; i < n; ++i) std::fill_n(row(x_, i), tracks_, initial.numbers()[i]);
+    for (std::size_t i = 0; i < n * n; ++i) std::fill_n(row(p_, i), tracks_, uncertainty.numbers()[i]);
+  }
+
+  [[nodiscard]] std::size_t size() const noexcept { return tracks_; }
+
+  [[nodiscard]] State state(std::size_t track) const
+  {
+    gsl_Expects(track < tracks_);
+    State s;
+    for (std::size_t i = 0; i < n; ++i) s.numbers()[i] = row(x_, i)[track];
+    return s;
+  }
+
+  [[nodiscard]] covariance_matrix covariance(std::size_t track) const
+  {
+    gsl_Expects(track < tracks_);
+    covariance_matrix p;
+    for (std::size_t i = 0; i < n * n; ++i) p.numbers()[i] = row(p_, i)[track];
+    return p;
+  }
+
+  void reset(std::size_t track, const State& s, const covariance_matrix& p)
+  {
+    gsl_Expects(track < tracks_);
+    for (std::size_t i = 0; i < n; ++i) row(x_, i)[track] = s.numbers()[i];
+    for (std::size_t i = 0; i < n * n; ++i) row(p_, i)[track] = p.numbers()[i];
+  }
+
+  // x = F x
+  // P = F P F^T + Q
+  void predict(const transition_matrix& f, const covariance_matrix& q)
+  {
+    for (std::size_t first = 0; first < tracks_; first += block)
+      predict(f.numbers(), q.numbers(), first, std::min(block, tracks_ - first));
+  }
+
+  // S = H P H^T + R
+  // K = P H^T S^-1
+  // x = x + K (z - H x)
+  // P = (I - K H) P
+  void update(const observation_matrix& h, const measurement_covariance_matrix& r, std::span<const Measurement> z)
+  {
+    gsl_Expects(z.size() == tracks_);
+    for (std::size_t first = 0; first < tracks_; first += block)
+      update(h.numbers(), r.numbers(), z, first, std::min(block, tracks_ - first));
+  }
+};
+
+}  // namespace kalman
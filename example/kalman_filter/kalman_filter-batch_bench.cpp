@@ -0,0 +1,157 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+
+#include "kalman.h"
+#include "kalman_batch.h"
+#include <units/isq/si/length.h>
+#include <units/isq/si/speed.h>
+#include <units/isq/si/time.h>
+#include <units/linear_algebra.h>
+#include <catch2/catch.hpp>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+using namespace units;
+using namespace units::isq::si;
+
+namespace {
+
+constexpr std::size_t tracks = 100'000;
+constexpr double dt = 1.;
+
+template<typename Filter>
+struct model {
+  typename Filter::transition_matrix f;
+  typename Filter::covariance_matrix q;
+  typename Filter::observation_matrix h;
+  typename Filter::measurement_covariance_matrix r;
+};
+
+template<typename Matrix>
+Matrix diagonal(double v)
+{
+  Matrix m;
+  for (std::size_t i = 0; i < Matrix::rows; ++i) m.numbers()[i * Matrix::cols + i] = v;
+  return m;
+}
+
+// 1D constant velocity with position measurements
+using state2 = la::vector<length<metre>, speed<metre_per_second>>;
+using filter2 = kalman::batch<state2, la::vector<length<metre>>>;
+
+model<filter2> make_model2()
+{
+  return {filter2::transition_matrix(1., isq::si::time<second>(dt), 0., 1.), diagonal<filter2::covariance_matrix>(0.1),
+          filter2::observation_matrix(1., 0.), diagonal<filter2::measurement_covariance_matrix>(25.)};
+}
+
+// 3D constant velocity with position measurements
+using state6 = la::vector<length<metre>, length<metre>, length<metre>, speed<metre_per_second>, speed<metre_per_second>,
+                          speed<metre_per_second>>;
+using filter6 = kalman::batch<state6, la::vector<length<metre>, length<metre>, length<metre>>>;
+
+model<filter6> make_model6()
+{
+  auto f = filter6::transition_matrix::identity();
+  f.set<0, 3>(isq::si::time<second>(dt));
+  f.set<1, 4>(isq::si::time<second>(dt));
+  f.set<2, 5>(isq::si::time<second>(dt));
+  filter6::observation_matrix h;
+  h.set<0, 0>(1.);
+  h.set<1, 1>(1.);
+  h.set<2, 2>(1.);
+  return {f, diagonal<filter6::covariance_matrix>(0.1), h, diagonal<filter6::measurement_covariance_matrix>(25.)};
+}
+
+// the textbook form of one predict/update cycle of a single track
+template<typename Filter>
+void step(typename Filter::state_type& x, typename Filter::covariance_matrix& p, const model<Filter>& md,
+          const typename Filter::measurement_type& z)
+{
+  x = md.f * x;
+  p = md.f * p * transpose(md.f) + md.q;
+  const auto s = md.h * p * transpose(md.h) + md.r;
+  const auto k = p * transpose(md.h) * inverse(s);
+  x += k * (z - md.h * x);
+  p = (Filter::transition_matrix::identity() - k * md.h) * p;
+}
+
+template<typename Filter>
+std::vector<typename Filter::measurement_type> make_measurements()
+{
+  std::vector<typename Filter::measurement_type> z(tracks);
+  for (std::size_t t = 0; t < tracks; ++t)
+    for (double& v : z[t].numbers()) v = 1'000. + static_cast<double>(t % 100);
+  return z;
+}
+
+template<typename Filter>
+void compare(const model<Filter>& md)
+{
+  using state = TYPENAME Filter::state_type;
+  using covariance = TYPENAME Filter::covariance_matrix;
+  const auto z = make_measurements<Filter>();
+  const auto p0 = diagonal<covariance>(100.);
+
+  Filter batch(tracks, state(), p0);
+  std::vector<state> x(tracks);
+  std::vector<covariance> p(tracks, p0);
+
+  BENCHMARK("per-track la::matrix filter") {
+    for (std::size_t t = 0; t < tracks; ++t) step(x[t], p[t], md, z[t]);
+    return x.back();
+  };
+  BENCHMARK("batch filter") {
+    batch.predict(md.f, md.q);
+    batch.update(md.h, md.r, z);
+    return batch.state(tracks - 1);
+  };
+}
+
+}  // namespace
+
+TEST_CASE("batched Kalman filter", "[kalman]")
+{
+  // divide the number of tracks by the reported time to get tracks/s
+  SECTION("2 states") {
+    SECTION("scalar alpha-beta filter from kalman.h") {
+      using state = kalman::state<length<metre>, speed<metre_per_second>>;
+      const auto interval = isq::si::time<second>(dt);
+      const std::array gain = {dimensionless<one>(0.2), dimensionless<one>(0.1)};
+      const auto z = make_measurements<filter2>();
+      std::vector<state> next(tracks, state(length<metre>(0.), speed<metre_per_second>(0.)));
+
+      BENCHMARK("kalman.h") {
+        for (std::size_t t = 0; t < tracks; ++t)
+          next[t] = kalman::state_extrapolation(kalman::state_update(next[t], z[t].get<0>(), gain, interval), interval);
+        return next.back();
+      };
+    }
+    compare(make_model2());
+  }
+
+  SECTION("6 states") { compare(make_model6()); }
+}
@@ -0,0 +1,141 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#define CATCH_CONFIG_MAIN
+
+#include "kalman_batch.h"
+#include <units/isq/si/length.h>
+#include <units/isq/si/speed.h>
+#include <units/isq/si/time.h>
+#include <units/linear_algebra.h>
+#include <catch2/catch.hpp>
+#include <cstddef>
+#include <vector>
+
+using namespace units;
+using namespace units::isq::si;
+
+namespace {
+
+// more than one block of the batch filter with the last one only partially filled
+constexpr std::size_t tracks = 1'000;
+constexpr double dt = 1.;
+
+template<typename Filter>
+struct model {
+  typename Filter::transition_matrix f;
+  typename Filter::covariance_matrix q;
+  typename Filter::observation_matrix h;
+  typename Filter::measurement_covariance_matrix r;
+};
+
+template<typename Matrix>
+Matrix diagonal(double v)
+{
+  Matrix m;
+  for (std::size_t i = 0; i < Matrix::rows; ++i) m.numbers()[i * Matrix::cols + i] = v;
+  return m;
+}
+
+// 1D constant velocity with position measurements
+using state2 = la::vector<length<metre>, speed<metre_per_second>>;
+using filter2 = kalman::batch<state2, la::vector<length<metre>>>;
+
+model<filter2> make_model2()
+{
+  return {filter2::transition_matrix(1., isq::si::time<second>(dt), 0., 1.), diagonal<filter2::covariance_matrix>(0.1),
+          filter2::observation_matrix(1., 0.), diagonal<filter2::measurement_covariance_matrix>(25.)};
+}
+
+// 3D constant velocity with position measurements
+using state6 = la::vector<length<metre>, length<metre>, length<metre>, speed<metre_per_second>, speed<metre_per_second>,
+                          speed<metre_per_second>>;
+using filter6 = kalman::batch<state6, la::vector<length<metre>, length<metre>, length<metre>>>;
+
+model<filter6> make_model6()
+{
+  auto f = filter6::transition_matrix::identity();
+  f.set<0, 3>(isq::si::time<second>(dt));
+  f.set<1, 4>(isq::si::time<second>(dt));
+  f.set<2, 5>(isq::si::time<second>(dt));
+  filter6::observation_matrix h;
+  h.set<0, 0>(1.);
+  h.set<1, 1>(1.);
+  h.set<2, 2>(1.);
+  return {f, diagonal<filter6::covariance_matrix>(0.1), h, diagonal<filter6::measurement_covariance_matrix>(25.)};
+}
+
+// the textbook form of one predict/update cycle of a single track
+template<typename Filter>
+void step(typename Filter::state_type& x, typename Filter::covariance_matrix& p, const model<Filter>& md,
+          const typename Filter::measurement_type& z)
+{
+  x = md.f * x;
+  p = md.f * p * transpose(md.f) + md.q;
+  const auto s = md.h * p * transpose(md.h) + md.r;
+  const auto k = p * transpose(md.h) * inverse(s);
+  x += k * (z - md.h * x);
+  p = (Filter::transition_matrix::identity() - k * md.h) * p;
+}
+
+template<typename Filter>
+std::vector<typename Filter::measurement_type> make_measurements(std::size_t cycle)
+{
+  std::vector<typename Filter::measurement_type> z(tracks);
+  for (std::size_t t = 0; t < tracks; ++t)
+    for (double& v : z[t].numbers()) v = 1'000. + static_cast<double>(t % 100) + 10. * static_cast<double>(cycle);
+  return z;
+}
+
+template<typename Filter>
+void compare(const model<Filter>& md)
+{
+  using state = TYPENAME Filter::state_type;
+  using covariance = TYPENAME Filter::covariance_matrix;
+  const auto p0 = diagonal<covariance>(100.);
+
+  Filter batch(tracks, state(), p0);
+  std::vector<state> x(tracks);
+  std::vector<covariance> p(tracks, p0);
+
+  for (std::size_t cycle = 0; cycle < 3; ++cycle) {
+    const auto z = make_measurements<Filter>(cycle);
+    batch.predict(md.f, md.q);
+    batch.update(md.h, md.r, z);
+    for (std::size_t t = 0; t < tracks; ++t) step(x[t], p[t], md, z[t]);
+  }
+
+  for (std::size_t t = 0; t < tracks; ++t) {
+    for (std::size_t i = 0; i < state::size; ++i)
+      REQUIRE(batch.state(t).numbers()[i] == Approx(x[t].numbers()[i]));
+    for (std::size_t i = 0; i < covariance::rows * covariance::cols; ++i)
+      REQUIRE(batch.covariance(t).numbers()[i] == Approx(p[t].numbers()[i]).margin(1e-12));
+  }
+}
+
+}  // namespace
+
+TEST_CASE("batched Kalman filter matches the per-track filter", "[kalman]")
+{
+  SECTION("2 states") { compare(make_model2()); }
+  SECTION("6 states") { compare(make_model6()); }
+}
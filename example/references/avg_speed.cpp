@@ -20,6 +20,15 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include <exception>
+#include <iostream>
+
+#ifdef UNITS_MODULES
+import mp_units.core.io;
+import mp_units.systems.si;
+import mp_units.systems.si.cgs;
+import mp_units.systems.si.international;
+#else
 #include <units/isq/si/cgs/length.h>
 #include <units/isq/si/cgs/speed.h> // IWYU pragma: keep
 #include <units/isq/si/international/length.h>
@@ -28,8 +37,7 @@
 #include <units/isq/si/time.h>
 #include <units/isq/si/speed.h>
 #include <units/quantity_io.h>
-#include <exception>
-#include <iostream>
+#endif
 
 namespace {
 
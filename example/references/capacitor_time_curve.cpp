@@ -20,6 +20,12 @@
     physical_quantities
 */
 
+#include <iostream>
+
+#ifdef UNITS_MODULES
+import mp_units.core.io;
+import mp_units.systems.si;
+#else
 #include <units/generic/dimensionless.h>
 #include <units/isq/dimensions/electric_current.h>
 #include <units/isq/si/capacitance.h>
@@ -28,7 +34,7 @@
 #include <units/isq/si/voltage.h>
 #include <units/math.h> // IWYU pragma: keep
 #include <units/quantity_io.h>
-#include <iostream>
+#endif
 
 int main()
 {
@@ -0,0 +1,62 @@
+# The MIT License (MIT)
+#
+# Copyright (c) 2018 Mateusz Pusz
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+#
+# Measures a clean build of the `references` examples that have a C++20 modules variant, once
+# including the headers and once importing the modules (building of the module interface units
+# included):
+#
+#   cmake -D BUILD_DIR=<build tree configured with UNITS_BUILD_MODULES=ON> [-D JOBS=<n>] -P clean_build_time.cmake
+#
+
+cmake_minimum_required(VERSION 3.28)
+
+if(NOT BUILD_DIR)
+    message(FATAL_ERROR "'BUILD_DIR' pointing to a build tree configured with 'UNITS_BUILD_MODULES=ON' is required")
+endif()
+if(NOT JOBS)
+    set(JOBS 1)
+endif()
+
+set(examples avg_speed capacitor_time_curve experimental_angle total_energy unknown_dimension)
+list(TRANSFORM examples APPEND -references OUTPUT_VARIABLE headers_targets)
+list(TRANSFORM examples APPEND -references-modules OUTPUT_VARIABLE modules_targets)
+
+function(clean_build_time variant)
+    execute_process(COMMAND ${CMAKE_COMMAND} --build ${BUILD_DIR} --target clean
+        OUTPUT_QUIET COMMAND_ERROR_IS_FATAL ANY
+    )
+    string(TIMESTAMP start "%s%f")
+    execute_process(COMMAND ${CMAKE_COMMAND} --build ${BUILD_DIR} --parallel ${JOBS} --target ${ARGN}
+        OUTPUT_QUIET COMMAND_ERROR_IS_FATAL ANY
+    )
+    string(TIMESTAMP stop "%s%f")
+    math(EXPR elapsed "(${stop} - ${start}) / 1000")
+    message(STATUS "${variant}: ${elapsed} ms")
+    set(${variant}_time ${elapsed} PARENT_SCOPE)
+endfunction()
+
+clean_build_time(headers ${headers_targets})
+clean_build_time(modules ${modules_targets})
+
+math(EXPR saving "100 * (${headers_time} - ${modules_time}) / ${headers_time}")
+message(STATUS "Clean build time saving: ${saving}%")
@@ -20,6 +20,12 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include <iostream>
+
+#ifdef UNITS_MODULES
+import mp_units.core.io;
+import mp_units.systems.si;
+#else
 #include <units/bits/external/hacks.h> // IWYU pragma: keep
 
 UNITS_DIAGNOSTIC_PUSH
@@ -32,7 +38,7 @@ UNITS_DIAGNOSTIC_POP
 #include <units/isq/si/length.h>
 #include <units/isq/si/torque.h> // IWYU pragma: keep
 #include <units/quantity_io.h>
-#include <iostream>
+#endif
 
 int main()
 {
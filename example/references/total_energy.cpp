@@ -20,6 +20,14 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include <exception>
+#include <iostream>
+
+#ifdef UNITS_MODULES
+import mp_units.core.io;
+import mp_units.systems.si;
+import mp_units.systems.natural;
+#else
 #include <units/isq/natural/natural.h>
 #include <units/isq/si/constants.h>
 #include <units/isq/si/energy.h>
@@ -28,8 +36,7 @@
 #include <units/isq/si/speed.h> // IWYU pragma: keep
 #include <units/math.h>
 #include <units/quantity_io.h>
-#include <exception>
-#include <iostream>
+#endif
 
 namespace {
 
@@ -20,12 +20,18 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include <exception>
+#include <iostream>
+
+#ifdef UNITS_MODULES
+import mp_units.core.io;
+import mp_units.systems.si;
+#else
 #include <units/isq/si/length.h>
 #include <units/isq/si/speed.h> // IWYU pragma: keep
 #include <units/isq/si/time.h>
 #include <units/quantity_io.h>
-#include <exception>
-#include <iostream>
+#endif
 
 namespace {
 
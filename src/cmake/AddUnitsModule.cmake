@@ -37,4 +37,34 @@ function(add_units_module name)
 
     install(TARGETS mp-units-${name} EXPORT mp-unitsTargets)
     install(DIRECTORY include/units TYPE INCLUDE)
+
+    # the targets without a module interface unit (i.e. `core-fmt`) are provided as headers only
+    if(UNITS_BUILD_MODULES AND EXISTS ${CMAKE_CURRENT_SOURCE_DIR}/${name}.cppm)
+        set(module_dependencies ${ARGN})
+        list(FILTER module_dependencies INCLUDE REGEX "^mp-units::")
+        list(TRANSFORM module_dependencies APPEND -module)
+        add_units_module_interface(${name} ${module_dependencies})
+    endif()
+endfunction()
+
+#
+# add_units_module_interface(ModuleName <module dependencies>...)
+#
+# Builds the C++20 module interface unit `<ModuleName>.cppm` of the current directory on top of
+# the `mp-units::<ModuleName>` headers target.
+#
+function(add_units_module_interface name)
+    add_library(mp-units-${name}-module STATIC)
+    target_sources(mp-units-${name}-module PUBLIC
+        FILE_SET CXX_MODULES
+        BASE_DIRS ${CMAKE_CURRENT_SOURCE_DIR}
+        FILES ${name}.cppm
+    )
+    target_link_libraries(mp-units-${name}-module PUBLIC mp-units::${name} ${ARGN})
+    set_target_properties(mp-units-${name}-module PROPERTIES EXPORT_NAME ${name}-module)
+    add_library(mp-units::${name}-module ALIAS mp-units-${name}-module)
+
+    install(TARGETS mp-units-${name}-module EXPORT mp-unitsTargets
+        FILE_SET CXX_MODULES DESTINATION ${CMAKE_INSTALL_LIBDIR}/cmake/mp-units/modules/${name}
+    )
 endfunction()
@@ -0,0 +1,45 @@
+# The MIT License (MIT)
+#
+# Copyright (c) 2018 Mateusz Pusz
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+cmake_minimum_required(VERSION 3.16)
+
+#
+# add_units_pch(Target DEPENDENCIES <dependencies>... HEADERS <headers>... [DEFINITIONS <definitions>...])
+#
+# Builds a precompiled header of `HEADERS` provided by `DEPENDENCIES`. The target is excluded from
+# the `all` target, so it is built only if some other target reuses it. Targets that already link
+# with all of `DEPENDENCIES` and are compiled with the same flags and `DEFINITIONS` can do it with:
+#
+#   target_precompile_headers(<target> REUSE_FROM <Target>)
+#
+function(add_units_pch target)
+    cmake_parse_arguments(PARSE_ARGV 1 arg "" "" "DEPENDENCIES;HEADERS;DEFINITIONS")
+
+    # a precompiled header has to be built as a part of some translation unit
+    file(GENERATE OUTPUT ${CMAKE_CURRENT_BINARY_DIR}/${target}.cpp CONTENT "")
+    add_library(${target} STATIC EXCLUDE_FROM_ALL ${CMAKE_CURRENT_BINARY_DIR}/${target}.cpp)
+    target_link_libraries(${target} PUBLIC ${arg_DEPENDENCIES})
+    target_compile_definitions(${target} PUBLIC ${arg_DEFINITIONS})
+    list(TRANSFORM arg_HEADERS PREPEND "<")
+    list(TRANSFORM arg_HEADERS APPEND ">")
+    target_precompile_headers(${target} PRIVATE ${arg_HEADERS})
+endfunction()
@@ -316,12 +316,11 @@ namespace units {
 
       void on_quantity_unit([[maybe_unused]] const CharT)
       {
-        auto txt = unit_text<Dimension, Unit>();
         if(unit_specs.modifier == 'A') {
-          format_to(out, "{}", txt.ascii().c_str());
+          format_to(out, "{}", unit_symbol_ascii<Dimension, Unit>());
         }
         else {
-          format_to(out, "{}", txt.standard().c_str());
+          format_to(out, "{}", unit_symbol_standard<Dimension, Unit>());
         }
       }
     };
@@ -464,15 +463,16 @@ private:
   }
 
 public:
-  constexpr auto parse(fmt::basic_format_parse_context<CharT>& ctx)
+  constexpr iterator parse(fmt::basic_format_parse_context<CharT>& ctx)
   {
     auto range = do_parse(ctx);
     format_str = fmt::basic_string_view<CharT>(&*range.begin, fmt::detail::to_unsigned(range.end - range.begin));
     return range.end;
   }
 
+  // explicit return types allow the explicit instantiation declarations to suppress the instantiation
   template<typename FormatContext>
-  auto format(const units::quantity<Dimension, Unit, Rep>& q, FormatContext& ctx)
+  typename FormatContext::iterator format(const units::quantity<Dimension, Unit, Rep>& q, FormatContext& ctx)
   {
     auto begin = format_str.begin(), end = format_str.end();
 
@@ -491,10 +491,10 @@ public:
     if(begin == end || *begin == '}') {
       // default format should print value followed by the unit separated with 1 space
       to_quantity_buffer = units::detail::format_units_quantity_value<CharT>(to_quantity_buffer, q.number(), rep_specs, ctx.locale());
-      constexpr auto symbol = units::detail::unit_text<Dimension, Unit>();
-      if(symbol.standard().size()) {
+      constexpr auto symbol = units::detail::unit_symbol_standard<Dimension, Unit>();
+      if constexpr(!symbol.empty()) {
         *to_quantity_buffer++ = CharT(' ');
-        format_to(to_quantity_buffer, "{}", symbol.standard().c_str());
+        format_to(to_quantity_buffer, "{}", symbol);
       }
     }
     else {
@@ -39,9 +39,9 @@ template<typename CharT, class Traits, typename D, typename U, typename Rep>
 void to_stream(std::basic_ostream<CharT, Traits>& os, const quantity<D, U, Rep>& q)
 {
   os << q.number();
-  constexpr auto symbol = detail::unit_text<D, U>();
-  if constexpr (!symbol.standard().empty()) {
-    os << " " << symbol.standard();
+  constexpr auto symbol = detail::unit_symbol_standard<D, U>();
+  if constexpr (!symbol.empty()) {
+    os << " " << symbol;
   }
 }
 
@@ -0,0 +1,289 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+module;
+
+#include <units/algorithm.h>
+#include <units/alias_distribution.h>
+#include <units/concepts.h>
+#include <units/customization_points.h>
+#include <units/fixed_point.h>
+#include <units/generic/dimensionless.h>
+#include <units/kind.h>
+#include <units/linear_algebra.h>
+#include <units/math.h>
+#include <units/mdspan.h>
+#include <units/mixed.h>
+#include <units/ode.h>
+#include <units/optional_quantity.h>
+#include <units/overflow_checked.h>
+#include <units/parallel_random.h>
+#include <units/quantity.h>
+#include <units/quantity_cast.h>
+#include <units/quantity_kind.h>
+#include <units/quantity_point.h>
+#include <units/quantity_point_kind.h>
+#include <units/random.h>
+#include <units/ratio.h>
+#include <units/reference.h>
+#include <units/symbol_text.h>
+#include <units/unit.h>
+#include <units/views.h>
+
+export module mp_units.core;
+
+export namespace units {
+
+// ratio.h
+using units::ratio;
+using units::inverse;
+using units::is_integral;
+using units::common_ratio;
+
+// symbol_text.h
+using units::basic_fixed_string;
+using units::fixed_string;
+using units::basic_symbol_text;
+using units::concat;
+
+// downcasting.h
+using units::downcast_base;
+using units::Downcastable;
+using units::downcast_mode;
+using units::downcast_registry;
+using units::downcast_dispatch;
+using units::downcast;
+using units::downcast_base_t;
+
+// prefix.h
+using units::prefix_family;
+using units::PrefixFamily;
+using units::Prefix;
+using units::no_prefix;
+using units::prefix;
+
+// unit.h
+using units::UnitRatio;
+using units::Unit;
+using units::scaled_unit;
+using units::downcast_unit;
+using units::unit;
+using units::named_unit;
+using units::named_scaled_unit;
+using units::prefixed_unit;
+using units::derived_unit;
+using units::named_derived_unit;
+using units::alias_unit;
+using units::prefixed_alias_unit;
+using units::unknown_coherent_unit;
+
+// base_dimension.h, derived_dimension.h, exponent.h
+using units::base_dimension;
+using units::BaseDimension;
+using units::exponent;
+using units::Exponent;
+using units::exponent_list;
+using units::derived_dimension;
+using units::DerivedDimension;
+using units::Dimension;
+using units::dimension_unit;
+using units::UnitOf;
+using units::unknown_dimension;
+using units::downcast_dimension;
+using units::dim_invert;
+using units::dimension_multiply;
+using units::dimension_divide;
+using units::dimension_pow;
+using units::dimension_sqrt;
+using units::equivalent;
+
+// point_origin.h, kind.h
+using units::point_origin;
+using units::PointOrigin;
+using units::rebind_point_origin_dimension;
+using units::RebindablePointOriginFor;
+using units::dynamic_origin;
+using units::kind;
+using units::derived_kind;
+using units::point_kind;
+using units::downcast_kind;
+using units::downcast_point_kind;
+using units::Kind;
+using units::PointKind;
+
+// reference.h
+using units::reference;
+using units::reference_multiply;
+using units::reference_divide;
+using units::Reference;
+
+// concepts.h
+using units::Quantity;
+using units::QuantityPoint;
+using units::QuantityKind;
+using units::QuantityPointKind;
+using units::QuantityLike;
+using units::QuantityPointLike;
+using units::Representation;
+using units::DimensionOfT;
+using units::QuantityOfT;
+using units::QuantityOf;
+using units::QuantityEquivalentTo;
+using units::QuantityPointOf;
+using units::QuantityPointEquivalentTo;
+using units::QuantityKindOf;
+using units::QuantityKindEquivalentTo;
+using units::QuantityPointKindOf;
+using units::QuantityPointKindEquivalentTo;
+using units::QuantityKindRelatedTo;
+
+// customization_points.h
+using units::treat_as_floating_point;
+using units::quantity_values;
+using units::quantity_like_traits;
+using units::quantity_point_like_traits;
+
+// quantity.h, quantity_kind.h, quantity_point.h, quantity_point_kind.h, quantity_cast.h
+using units::quantity;
+using units::quantity_point;
+using units::quantity_kind;
+using units::quantity_point_kind;
+using units::quantity_cast;
+using units::quantity_point_cast;
+using units::quantity_kind_cast;
+using units::quantity_point_kind_cast;
+using units::operator+;
+using units::operator-;
+using units::operator*;
+using units::operator/;
+using units::operator%;
+using units::operator==;
+using units::operator<=>;
+
+// generic/dimensionless.h
+using units::one;
+using units::percent;
+using units::dim_one;
+using units::Dimensionless;
+using units::dimensionless;
+
+// math.h (together with the ratio.h overloads)
+using units::pow;
+using units::sqrt;
+using units::cbrt;
+using units::exp;
+using units::abs;
+using units::epsilon;
+
+// algorithm.h
+using units::bulk_cast;
+using units::bulk_sum;
+using units::integrate_trapezoid;
+using units::differentiate;
+using units::incremental_integral;
+using units::incremental_derivative;
+
+// random.h, alias_distribution.h, parallel_random.h
+using units::uniform_int_distribution;
+using units::uniform_real_distribution;
+using units::binomial_distribution;
+using units::negative_binomial_distribution;
+using units::geometric_distribution;
+using units::poisson_distribution;
+using units::exponential_distribution;
+using units::gamma_distribution;
+using units::weibull_distribution;
+using units::extreme_value_distribution;
+using units::normal_distribution;
+using units::lognormal_distribution;
+using units::chi_squared_distribution;
+using units::cauchy_distribution;
+using units::fisher_f_distribution;
+using units::student_t_distribution;
+using units::discrete_distribution;
+using units::piecewise_constant_distribution;
+using units::piecewise_linear_distribution;
+using units::alias_distribution;
+using units::histogram_bins_t;
+using units::histogram_bins;
+using units::philox4x32;
+using units::generate_uniform;
+using units::generate_normal;
+using units::generate_exponential;
+
+// fixed_point.h, mixed.h, overflow_checked.h, optional_quantity.h
+using units::fixed_point;
+using units::range_fits;
+using units::mixed;
+using units::overflow_checked;
+using units::throw_on_overflow;
+using units::saturate_on_overflow;
+using units::checked;
+using units::saturating;
+using units::optional_quantity;
+using units::optional_quantity_traits;
+using units::sentinel_value;
+
+// mdspan.h
+using units::quantity_accessor;
+using units::converting_accessor;
+#if __cpp_lib_mdspan
+using units::quantity_mdspan;
+using units::converting_mdspan;
+#endif
+
+}  // namespace units
+
+export namespace units::views {
+
+using units::views::as_unit;
+using units::views::as_rep;
+using units::views::numbers;
+
+}  // namespace units::views
+
+export namespace units::la {
+
+using units::la::vector;
+using units::la::matrix;
+using units::la::inverse_vector;
+using units::la::transpose;
+using units::la::inverse;
+using units::la::operator*;
+
+}  // namespace units::la
+
+export namespace units::ode {
+
+using units::ode::are_derivatives;
+using units::ode::State;
+using units::ode::derivative;
+using units::ode::SystemFunction;
+using units::ode::euler;
+using units::ode::rk4;
+using units::ode::rk45;
+using units::ode::integrate;
+using units::ode::integrate_adaptive;
+using units::ode::step_all;
+using units::ode::chain;
+
+}  // namespace units::ode
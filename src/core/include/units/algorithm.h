@@ -0,0 +1,233 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/concepts.h>
+#include <units/quantity.h>
+#include <units/quantity_cast.h>
+#include <gsl/gsl-lite.hpp>
+#include <cstddef>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace units {
+
+/**
+ * @brief Converts a contiguous range of quantities to another quantity type
+ *
+ * Every element of @c from is converted with @c quantity_cast<std::ranges::range_value_t<Out>>
+ * and stored in the corresponding element of @c to. The loop does not allocate and is easy to
+ * vectorize, which makes it suitable for converting between a compact storage format (i.e.
+ * half-precision) and a wider compute format in one pass.
+ *
+ * @param from a range of quantities to convert
+ * @param to a range of at least the same size to store the results in
+ */
+template<std::ranges::contiguous_range In, std::ranges::contiguous_range Out>
+  requires std::ranges::sized_range<In> && std::ranges::sized_range<Out> &&
+           Quantity<std::ranges::range_value_t<In>> && Quantity<std::ranges::range_value_t<Out>> &&
+           requires(const std::ranges::range_value_t<In>& q) { quantity_cast<std::ranges::range_value_t<Out>>(q); }
+constexpr void bulk_cast(const In& from, Out&& to)
+{
+  using To = std::ranges::range_value_t<Out>;
+  gsl_Expects(std::ranges::size(from) <= std::ranges::size(to));
+  const auto* in = std::ranges::data(from);
+  auto* out = std::ranges::data(to);
+  const std::size_t size = std::ranges::size(from);
+  for (std::size_t i = 0; i < size; ++i) out[i] = quantity_cast<To>(in[i]);
+}
+
+/**
+ * @brief Sums a range of quantities
+ *
+ * Values stored in a half-precision representation type are accumulated in single precision
+ * to not lose accuracy after a few thousands of additions.
+ *
+ * @param r a range of quantities to sum
+ * @return Quantity the sum of all the elements of the range
+ */
+template<std::ranges::input_range R>
+  requires Quantity<std::ranges::range_value_t<R>>
+[[nodiscard]] constexpr Quantity auto bulk_sum(const R& r)
+{
+  using Q = std::ranges::range_value_t<R>;
+  using acc_type = quantity<typename Q::dimension, typename Q::unit, detail::widened_rep<typename Q::rep>>;
+  auto acc = acc_type::zero();
+  for (const Q& q : r) acc += acc_type(static_cast<typename acc_type::rep>(q.number()));
+  return acc;
+}
+
+namespace detail {
+
+template<typename T>
+concept sample_point_ = (Quantity<T> || QuantityPoint<T>) && Quantity<decltype(std::declval<T>() - std::declval<T>())>;  // exposition only
+
+template<typename T>
+using sample_interval = decltype(std::declval<T>() - std::declval<T>());
+
+template<typename T, typename Q>
+using sample_integral = decltype(std::declval<Q>() * std::declval<sample_interval<T>>());
+
+template<typename T, typename Q>
+using sample_derivative = decltype(std::declval<Q>() / std::declval<sample_interval<T>>());
+
+}  // namespace detail
+
+/**
+ * @brief Integrates sampled values with the trapezoidal rule
+ *
+ * The sample points may be quantities or quantity points (i.e. time points of a clock) and do not
+ * have to be equally spaced. For example integrating power over time results in energy.
+ *
+ * @param points a range of the sample points in an increasing order
+ * @param values a range of the sampled values of the same size as @c points
+ * @return Quantity the integral with a dimension of the product of the values and the point intervals
+ */
+template<std::ranges::random_access_range Ps, std::ranges::random_access_range Vs>
+  requires std::ranges::sized_range<Ps> && std::ranges::sized_range<Vs> &&
+           detail::sample_point_<std::ranges::range_value_t<Ps>> && Quantity<std::ranges::range_value_t<Vs>>
+[[nodiscard]] constexpr Quantity auto integrate_trapezoid(const Ps& points, const Vs& values)
+{
+  using result = detail::sample_integral<std::ranges::range_value_t<Ps>, std::ranges::range_value_t<Vs>>;
+  gsl_Expects(std::ranges::size(points) == std::ranges::size(values));
+  const auto p = std::ranges::begin(points);
+  const auto v = std::ranges::begin(values);
+  const auto size = std::ranges::ssize(points);
+  auto sum = result::zero();
+  for (std::ranges::range_difference_t<Ps> i = 1; i < size; ++i) sum += (v[i - 1] + v[i]) * (p[i] - p[i - 1]);
+  return sum / 2;
+}
+
+/**
+ * @brief Computes derivatives of sampled values with finite differences
+ *
+ * Central differences are used for the inner samples and one-sided differences for the first and
+ * the last one, so @c out gets a derivative for every sample. The loop has no dependencies between
+ * iterations and is easy to vectorize.
+ *
+ * @param points a range of at least two sample points in an increasing order
+ * @param values a range of the sampled values of the same size as @c points
+ * @param out a range of at least the same size to store the derivatives in
+ */
+template<std::ranges::random_access_range Ps, std::ranges::random_access_range Vs, std::ranges::random_access_range Out>
+  requires std::ranges::sized_range<Ps> && std::ranges::sized_range<Vs> && std::ranges::sized_range<Out> &&
+           detail::sample_point_<std::ranges::range_value_t<Ps>> && Quantity<std::ranges::range_value_t<Vs>> &&
+           std::convertible_to<detail::sample_derivative<std::ranges::range_value_t<Ps>, std::ranges::range_value_t<Vs>>,
+                               std::ranges::range_value_t<Out>>
+constexpr void differentiate(const Ps& points, const Vs& values, Out&& out)
+{
+  const auto size = std::ranges::ssize(points);
+  gsl_Expects(size >= 2 && std::ranges::ssize(values) == size && std::ranges::ssize(out) >= size);
+  const auto p = std::ranges::begin(points);
+  const auto v = std::ranges::begin(values);
+  const auto o = std::ranges::begin(out);
+  o[0] = (v[1] - v[0]) / (p[1] - p[0]);
+  for (std::ranges::range_difference_t<Ps> i = 1; i < size - 1; ++i) o[i] = (v[i + 1] - v[i - 1]) / (p[i + 1] - p[i - 1]);
+  o[size - 1] = (v[size - 1] - v[size - 2]) / (p[size - 1] - p[size - 2]);
+}
+
+/**
+ * @brief A streaming form of @c integrate_trapezoid for live data
+ *
+ * Every pushed sample extends the integral by one trapezoid so the result is always up to date
+ * without storing the history.
+ *
+ * @tparam P a type of the sample points (i.e. a quantity point of a clock)
+ * @tparam Q a quantity type of the sampled values
+ */
+template<detail::sample_point_ P, Quantity Q>
+class incremental_integral {
+public:
+  using point_type = P;
+  using value_type = Q;
+  using result_type = detail::sample_integral<P, Q>;
+
+  constexpr void push(const P& point, const Q& value)
+  {
+    if (!empty_) {
+      gsl_ExpectsAudit(point >= last_point_);
+      twice_sum_ += (last_value_ + value) * (point - last_point_);
+    }
+    last_point_ = point;
+    last_value_ = value;
+    empty_ = false;
+  }
+
+  [[nodiscard]] constexpr result_type value() const { return twice_sum_ / 2; }
+
+private:
+  P last_point_{};
+  Q last_value_{};
+  result_type twice_sum_ = result_type::zero();
+  bool empty_ = true;
+};
+
+/**
+ * @brief A streaming backward-difference derivative of sampled values for live data
+ *
+ * @tparam P a type of the sample points (i.e. a quantity point of a clock)
+ * @tparam Q a quantity type of the sampled values
+ */
+template<detail::sample_point_ P, Quantity Q>
+class incremental_derivative {
+public:
+  using point_type = P;
+  using value_type = Q;
+  using result_type = detail::sample_derivative<P, Q>;
+
+  constexpr void push(const P& point, const Q& value)
+  {
+    if (count_ > 0) {
+      gsl_ExpectsAudit(point > last_point_);
+      derivative_ = (value - last_value_) / (point - last_point_);
+    }
+    last_point_ = point;
+    last_value_ = value;
+    if (count_ < 2) ++count_;
+  }
+
+  /**
+   * @brief Returns @c true if at least two samples were pushed
+   */
+  [[nodiscard]] constexpr bool has_value() const { return count_ == 2; }
+
+  /**
+   * @brief Returns the derivative between the last two samples
+   *
+   * @pre has_value()
+   */
+  [[nodiscard]] constexpr result_type value() const
+  {
+    gsl_Expects(has_value());
+    return derivative_;
+  }
+
+private:
+  P last_point_{};
+  Q last_value_{};
+  result_type derivative_{};
+  int count_ = 0;
+};
+
+}  // namespace units
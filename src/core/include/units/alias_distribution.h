@@ -0,0 +1,205 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/concepts.h>
+#include <units/customization_points.h>
+#include <units/parallel_random.h>
+#include <gsl/gsl-lite.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <vector>
+
+namespace units {
+
+/**
+ * @brief A tag selecting sampling uniformly within histogram bins in @c alias_distribution
+ */
+struct histogram_bins_t {
+  explicit histogram_bins_t() = default;
+};
+
+inline constexpr histogram_bins_t histogram_bins{};
+
+/**
+ * @brief A discrete distribution sampling in O(1) using the alias method
+ *
+ * Builds the alias tables of Walker in O(n) with the algorithm of Vose ("A Linear Algorithm For
+ * Generating Random Numbers With a Given Distribution", 1991). Every sample needs one 64-bit
+ * random draw, one table lookup, and one comparison regardless of the number of bins, while
+ * @c discrete_distribution and @c piecewise_constant_distribution perform a binary search.
+ *
+ * The distribution either returns one of the provided quantities or, when constructed with
+ * @c histogram_bins, a value uniformly distributed within one of the bins of a histogram.
+ *
+ * Requires an engine producing full-range 32- or 64-bit words (i.e. @c std::mt19937_64 or
+ * @c philox4x32).
+ *
+ * @tparam Q a type of quantities to sample
+ */
+template<Quantity Q>
+class alias_distribution {
+public:
+  using result_type = Q;
+  using rep = TYPENAME Q::rep;
+
+  alias_distribution() : alias_distribution(std::span<const Q>(&default_value, 1), std::span<const double>(&default_weight, 1)) {}
+
+  /**
+   * @brief Constructs a distribution sampling @c values with probabilities proportional to @c weights
+   */
+  alias_distribution(std::span<const Q> values, std::span<const double> weights) : values_(values.begin(), values.end())
+  {
+    gsl_Expects(values.size() == weights.size());
+    build(weights);
+  }
+
+  alias_distribution(std::initializer_list<Q> values, std::initializer_list<double> weights) :
+      alias_distribution(std::span<const Q>(values.begin(), values.size()), std::span<const double>(weights.begin(), weights.size()))
+  {
+  }
+
+  /**
+   * @brief Constructs a distribution sampling uniformly within histogram bins
+   *
+   * @param bounds the boundaries of the bins (@c weights.size() + 1)
+   * @param weights the weights of the bins
+   */
+  alias_distribution(histogram_bins_t, std::span<const Q> bounds, std::span<const double> weights)
+    requires treat_as_floating_point<rep>
+      : values_(bounds.begin(), bounds.end()), histogram_(true)
+  {
+    gsl_Expects(bounds.size() == weights.size() + 1);
+    build(weights);
+  }
+
+  void reset() noexcept {}
+
+  template<detail::full_range_urbg_ Generator>
+  [[nodiscard]] Q operator()(Generator& g) const
+  {
+    return sample(detail::random_bits64(g), g);
+  }
+
+  template<detail::full_range_urbg_ Generator>
+  void generate(Generator& g, std::span<Q> out) const
+  {
+    for (Q& q : out) q = sample(detail::random_bits64(g), g);
+  }
+
+  [[nodiscard]] std::size_t size() const noexcept { return table_.size(); }
+
+  /**
+   * @brief The values (or the boundaries of the histogram bins) of the distribution
+   */
+  [[nodiscard]] std::span<const Q> values() const noexcept { return values_; }
+
+  /**
+   * @brief The normalized probabilities of the values (or bins)
+   */
+  [[nodiscard]] std::vector<double> probabilities() const
+  {
+    const double n = static_cast<double>(table_.size());
+    std::vector<double> result(table_.size(), 0.0);
+    for (std::size_t i = 0; i < table_.size(); ++i) {
+      const double p = static_cast<double>(table_[i].threshold) * 0x1.0p-32;
+      result[i] += p / n;
+      result[table_[i].alias] += (1.0 - p) / n;
+    }
+    return result;
+  }
+
+  [[nodiscard]] Q min() const { return histogram_ ? values_.front() : *std::min_element(values_.begin(), values_.end()); }
+  [[nodiscard]] Q max() const { return histogram_ ? values_.back() : *std::max_element(values_.begin(), values_.end()); }
+
+  [[nodiscard]] friend bool operator==(const alias_distribution& lhs, const alias_distribution& rhs) = default;
+
+private:
+  struct entry {
+    std::uint64_t threshold;  // a probability of keeping the bin scaled by 2^32
+    std::size_t alias;
+    [[nodiscard]] friend bool operator==(const entry&, const entry&) = default;
+  };
+
+  static constexpr Q default_value = Q::zero();
+  static constexpr double default_weight = 1.0;
+
+  std::vector<Q> values_;
+  std::vector<entry> table_;
+  bool histogram_ = false;
+
+  void build(std::span<const double> weights)
+  {
+    const std::size_t n = weights.size();
+    gsl_Expects(n > 0 && n <= std::numeric_limits<std::uint32_t>::max());
+    const double sum = std::accumulate(weights.begin(), weights.end(), 0.0);
+    gsl_Expects(sum > 0);
+
+    // probabilities scaled so that the average one is 1
+    std::vector<double> scaled(n);
+    std::vector<std::size_t> small, large;
+    small.reserve(n);
+    large.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      gsl_Expects(weights[i] >= 0);
+      scaled[i] = weights[i] * static_cast<double>(n) / sum;
+      (scaled[i] < 1.0 ? small : large).push_back(i);
+    }
+
+    table_.assign(n, entry{std::uint64_t{1} << 32, 0});
+    for (std::size_t i = 0; i < n; ++i) table_[i].alias = i;
+    while (!small.empty() && !large.empty()) {
+      const std::size_t s = small.back();
+      small.pop_back();
+      const std::size_t l = large.back();
+      table_[s] = entry{static_cast<std::uint64_t>(scaled[s] * 0x1.0p32), l};
+      scaled[l] = (scaled[l] + scaled[s]) - 1.0;
+      if (scaled[l] < 1.0) {
+        large.pop_back();
+        small.push_back(l);
+      }
+    }
+    // whatever is left has a probability of 1 up to rounding errors and is never aliased
+  }
+
+  template<typename Generator>
+  [[nodiscard]] Q sample(std::uint64_t bits, Generator& g) const
+  {
+    // the high 32 bits select a bin (multiply-shift instead of a modulo) and the low ones decide on an alias
+    const std::size_t i = static_cast<std::size_t>(((bits >> 32) * table_.size()) >> 32);
+    const entry& e = table_[i];
+    const std::size_t bin = (bits & 0xFFFF'FFFF) < e.threshold ? i : e.alias;
+    if (!histogram_) return values_[bin];
+
+    const double u = static_cast<double>(detail::random_bits64(g) >> 11) * 0x1.0p-53;
+    const Q& lo = values_[bin];
+    return Q(static_cast<rep>(static_cast<double>(lo.number()) + u * static_cast<double>((values_[bin + 1] - lo).number())));
+  }
+};
+
+}  // namespace units
@@ -24,25 +24,11 @@
 
 #include <units/bits/dimension_op.h>
 #include <units/bits/equivalent.h>
+#include <units/fwd.h>
 #include <units/quantity_cast.h>
 
 namespace units {
 
-template<Dimension D, UnitOf<D> U>
-struct reference;
-
-template<Dimension D, UnitOf<D> U, Representation Rep>
-class quantity;
-
-template<PointOrigin O, UnitOf<typename O::dimension> U, Representation Rep>
-class quantity_point;
-
-template<Kind K, UnitOf<typename K::dimension> U, Representation Rep>
-class quantity_kind;
-
-template<PointKind PK, UnitOf<typename PK::dimension> U, Representation Rep>
-class quantity_point_kind;
-
 namespace detail {
 
 template<typename R1, typename R2>
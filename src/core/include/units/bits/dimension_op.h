@@ -38,11 +38,17 @@ namespace units {
  * Sometimes a temporary partial result of a complex calculation may not result in a predefined
  * dimension. In such a case an `unknown_dimension` is created with a coherent unit of `unknown_coherent_unit`
  * and ratio(1).
+ *
+ * The exponents may be provided in any order and may refer to derived dimensions, like for
+ * units::derived_dimension. The results of dimensional algebra are already normalized so for them
+ * the sorting and consolidation of the exponents is skipped.
  * 
  * @tparam Es the list of exponents of ingredient dimensions
  */
 template<Exponent... Es>
-struct unknown_dimension : derived_dimension<unknown_dimension<Es...>, unknown_coherent_unit, Es...> {};
+struct unknown_dimension :
+    detail::derived_dimension_impl<unknown_dimension<Es...>, unknown_coherent_unit,
+                                   typename detail::make_dimension_unless_normalized<detail::normalized_exponents<Es...>, Es...>::type, Es...> {};
 
 namespace detail {
 
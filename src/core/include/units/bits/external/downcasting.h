@@ -26,7 +26,7 @@
 #include <type_traits>
 
 #ifdef UNITS_DOWNCAST_MODE
-#if UNITS_DOWNCAST_MODE < 0 || UNITS_DOWNCAST_MODE > 2
+#if UNITS_DOWNCAST_MODE < 0 || UNITS_DOWNCAST_MODE > 3
 #error "Invalid UNITS_DOWNCAST_MODE value"
 #endif
 #else
@@ -71,12 +71,42 @@ struct downcast_poison : T {
 enum class downcast_mode {
   off = 0,         // no downcasting at all
   on = 1,          // downcasting always forced -> compile-time errors in case of duplicated definitions
-  automatic = 2    // downcasting automatically enabled if no collisions are present
+  automatic = 2,   // downcasting automatically enabled if no collisions are present
+  registry = 3     // downcasting only to the types listed with UNITS_DOWNCAST_REGISTER -> no friend injection
 };
 
+/**
+ * @brief An explicit registry of downcasting targets
+ *
+ * Used instead of the friend injection in the `downcast_mode::registry` mode. Specialized with
+ * `UNITS_DOWNCAST_REGISTER` for the downcasting base of every registered target type. Duplicated
+ * registrations are explicit specialization redefinitions and do not compile.
+ *
+ * @tparam BaseType a downcasting base (source) type
+ */
+template<typename BaseType>
+struct downcast_registry {};
+
+/**
+ * @brief Registers a downcasting target in the @c downcast_registry
+ *
+ * Has to be used at the global namespace scope after the definition of a target type. Expands to
+ * nothing meaningful in other downcasting modes so the registrations do not need to be guarded.
+ *
+ * @code{.cpp}
+ * UNITS_DOWNCAST_REGISTER(units::isq::si::metre);
+ * @endcode
+ */
+#if UNITS_DOWNCAST_MODE == 3
+#define UNITS_DOWNCAST_REGISTER(T) \
+  template<>                       \
+  struct units::downcast_registry<T::downcast_base_type> : std::type_identity<T> {}
+#else
+#define UNITS_DOWNCAST_REGISTER(T) static_assert(true)
+#endif
 
 template<typename Target, Downcastable T, downcast_mode mode = static_cast<downcast_mode>(UNITS_DOWNCAST_MODE)>
-struct downcast_dispatch : std::conditional_t<mode == downcast_mode::off, T,
+struct downcast_dispatch : std::conditional_t<mode == downcast_mode::off || mode == downcast_mode::registry, T,
 #ifdef UNITS_COMP_MSVC
                                               downcast_child<Target, T>> {};
 #else
@@ -89,8 +119,13 @@ namespace detail {
 template<typename T>
 constexpr auto downcast_impl()
 {
+#if UNITS_DOWNCAST_MODE == 3
+  if constexpr(requires { typename downcast_registry<T>::type; })
+    return downcast_registry<T>();
+#else
   if constexpr(has_downcast_guide<downcast_base<T>> && !has_downcast_poison_pill<downcast_base<T>>)
     return decltype(downcast_guide(std::declval<downcast_base<T>>()))();
+#endif
   else
     return std::type_identity<T>();
 }
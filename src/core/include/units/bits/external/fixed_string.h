@@ -124,4 +124,24 @@ basic_fixed_string(CharT) -> basic_fixed_string<CharT, 1>;
 template<std::size_t N>
 using fixed_string = basic_fixed_string<char, N>;
 
+/**
+ * @brief Concatenates fixed strings
+ *
+ * Unlike a chain of `operator+` calls, it writes all the characters into a single preallocated
+ * buffer and does not instantiate an intermediate string type for every step.
+ *
+ * @param txts fixed strings to concatenate
+ */
+template<typename CharT, std::size_t... Ns>
+[[nodiscard]] constexpr basic_fixed_string<CharT, (Ns + ...)> concat(const basic_fixed_string<CharT, Ns>&... txts) noexcept
+{
+  CharT txt[(Ns + ...) + 1] = {};
+  std::size_t pos = 0;
+  auto append = [&](const auto& t) {
+    for (std::size_t i = 0; i != t.size(); ++i) txt[pos++] = t[i];
+  };
+  (append(txts), ...);
+  return basic_fixed_string<CharT, (Ns + ...)>(txt);
+}
+
 }  // namespace units
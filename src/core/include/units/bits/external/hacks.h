@@ -98,6 +98,14 @@
 
 #endif
 
+#if defined(__FLT16_MAX__) && !UNITS_COMP_MSVC
+#define UNITS_HAS_FLOAT16 1
+#endif
+
+#if defined(__STDCPP_BFLOAT16_T__)
+#define UNITS_HAS_BFLOAT16 1
+#endif
+
 
 namespace std {
 
@@ -50,28 +50,28 @@ template<std::intmax_t Value>
 constexpr auto superscript_helper()
 {
   if constexpr(Value < 0)
-    return superscript_minus + superscript_helper<-Value>();
+    return concat(superscript_minus, superscript_helper<-Value>());
   else if constexpr(Value < 10)
     return basic_symbol_text(superscript_number<Value>, basic_fixed_string(static_cast<char>('0' + Value)));
   else
-    return superscript_helper<Value / 10>() + superscript_helper<Value % 10>();
+    return concat(superscript_helper<Value / 10>(), superscript_helper<Value % 10>());
 }
 
 template<std::intmax_t Value>
 constexpr auto superscript()
 {
-  return superscript_prefix + superscript_helper<Value>();
+  return concat(superscript_prefix, superscript_helper<Value>());
 }
 
 template<std::intmax_t Value>
 constexpr auto regular()
 {
   if constexpr (Value < 0)
-    return basic_fixed_string("-") + superscript_helper<-Value>();
+    return concat(basic_fixed_string("-"), superscript_helper<-Value>());
   else if constexpr (Value < 10)
     return basic_symbol_text(static_cast<char>('0' + Value));
   else
-    return regular<Value / 10>() + regular<Value % 10>();
+    return concat(regular<Value / 10>(), regular<Value % 10>());
 }
 
 }  // namespace units::detail
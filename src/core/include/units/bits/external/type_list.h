@@ -24,7 +24,10 @@
 
 #include <units/bits/external/hacks.h>
 #include <units/bits/external/type_traits.h>
+#include <array>
 #include <cstddef>
+#include <type_traits>
+#include <utility>
 
 #ifdef _MSC_VER
 #pragma warning (push)
@@ -194,6 +197,42 @@ using type_list_merge_sorted = TYPENAME detail::type_list_merge_sorted_impl<Sort
 
 namespace detail {
 
+// constant-depth access to the I-th element of a pack
+template<std::size_t I, typename T>
+struct indexed_type {};
+
+template<std::size_t I, typename T>
+std::type_identity<T> type_at_impl(indexed_type<I, T>);
+
+template<typename Seq, typename... Types>
+struct indexed_types;
+
+template<std::size_t... Is, typename... Types>
+struct indexed_types<std::index_sequence<Is...>, Types...> : indexed_type<Is, Types>... {};
+
+template<std::size_t I, typename... Types>
+using type_at = TYPENAME decltype(type_at_impl<I>(indexed_types<std::index_sequence_for<Types...>, Types...>{}))::type;
+
+template<template<typename, typename> typename Pred, typename T, typename... Types>
+inline constexpr std::array<bool, sizeof...(Types)> type_list_less_row = {Pred<T, Types>::value...};
+
+// Returns the indices of the elements in a sorted order. The position of every element is the number
+// of elements less than it plus the number of equivalent elements preceding it, so the sort is stable.
+template<template<typename, typename> typename Pred, typename... Types>
+[[nodiscard]] consteval std::array<std::size_t, sizeof...(Types)> type_list_sort_permutation()
+{
+  constexpr std::size_t n = sizeof...(Types);
+  constexpr std::array<std::array<bool, n>, n> less = {type_list_less_row<Pred, Types, Types...>...};
+  std::array<std::size_t, n> permutation{};
+  for (std::size_t i = 0; i < n; ++i) {
+    std::size_t position = 0;
+    for (std::size_t j = 0; j < n; ++j)
+      if (less[j][i] || (j < i && !less[i][j])) ++position;
+    permutation[position] = i;
+  }
+  return permutation;
+}
+
 template<typename List, template<typename, typename> typename Pred>
 struct type_list_sort_impl;
 
@@ -207,13 +246,19 @@ struct type_list_sort_impl<List<T>, Pred> {
   using type = List<T>;
 };
 
+template<template<typename...> typename List, typename T1, typename T2, template<typename, typename> typename Pred>
+struct type_list_sort_impl<List<T1, T2>, Pred> {
+  using type = conditional<Pred<T2, T1>::value, List<T2, T1>, List<T1, T2>>;
+};
+
 template<template<typename...> typename List, typename... Types, template<typename, typename> typename Pred>
 struct type_list_sort_impl<List<Types...>, Pred> {
-  using types = List<Types...>;
-  using split = type_list_split_half<List<Types...>>;
-  using sorted_left = TYPENAME type_list_sort_impl<typename split::first_list, Pred>::type;
-  using sorted_right = TYPENAME type_list_sort_impl<typename split::second_list, Pred>::type;
-  using type = TYPENAME type_list_merge_sorted_impl<sorted_left, sorted_right, Pred>::type;
+  static constexpr std::array<std::size_t, sizeof...(Types)> permutation = type_list_sort_permutation<Pred, Types...>();
+
+  template<std::size_t... Is>
+  static List<type_at<permutation[Is], Types...>...> sorted(std::index_sequence<Is...>);
+
+  using type = decltype(sorted(std::index_sequence_for<Types...>{}));
 };
 
 }  // namespace detail
@@ -23,7 +23,6 @@
 #pragma once
 
 #include <gsl/gsl-lite.hpp>
-#include <units/bits/constexpr_math.h>
 #include <units/bits/math_concepts.h>
 #include <units/bits/pow.h>
 #include <units/bits/ratio_maths.h>
@@ -58,15 +57,36 @@ template<std::intmax_t N, typename F>
   }
 }
 
-// maximum v is std::numeric_limits<std::intmax_t>::max() which is the worst case for exp convergence
-// ExpOrder = 12 and Factor = 64 give a precision of about O(1e-15) for a wide range of 1 / N exponents
-// Factor = 32 needs quite a few more terms to converge
-// https://godbolt.org/z/odWq1o
-template<std::intmax_t N, std::size_t ExpOrder = 12, std::intmax_t Factor = 64>
+// exact integer Newton iteration x' = ((N - 1) * x + v / x^(N - 1)) / N started from a power of 2 above the root;
+// v / x^(N - 1) is computed as nested floor divisions (exact and immune to overflow) so no wider integer type is needed
+template<std::intmax_t N>
   requires gt_zero<N>
 [[nodiscard]] constexpr std::intmax_t iroot_compile(std::intmax_t v) noexcept
 {
-  return iroot_impl<N>(v, [](double x, double exponent) { return constexpr_pow<ExpOrder, Factor>(x, exponent); });
+  if constexpr (N == 1) {
+    return v;
+  } else {
+    gsl_Expects(v >= 0);
+    if (v < 2) {
+      return v;
+    }
+
+    const auto uv = static_cast<std::uintmax_t>(v);
+    std::intmax_t bits = 0;
+    for (std::uintmax_t t = uv; t != 0; t >>= 1) ++bits;
+
+    // 2^ceil(bits / N) is not smaller than the root
+    auto x = std::uintmax_t(1) << ((bits + N - 1) / N);
+    while (true) {
+      std::uintmax_t q = uv;
+      for (std::intmax_t i = 1; i < N && q != 0; ++i) q /= x;
+      const std::uintmax_t y = (static_cast<std::uintmax_t>(N - 1) * x + q) / static_cast<std::uintmax_t>(N);
+      if (y >= x) {
+        return static_cast<std::intmax_t>(x);
+      }
+      x = y;
+    }
+  }
 }
 
 template<std::intmax_t N>
@@ -26,6 +26,8 @@
 #include <units/bits/external/text_tools.h>
 #include <units/prefix.h>
 #include <units/derived_dimension.h>
+#include <string_view>
+#include <type_traits>
 
 namespace units::detail {
 
@@ -35,28 +37,26 @@ template<ratio R>
 constexpr auto ratio_text()
 {
   if constexpr(R.num == 1 && R.den == 1 && R.exp != 0) {
-    return base_multiplier + superscript<R.exp>();
+    return concat(base_multiplier, superscript<R.exp>());
   }
   else if constexpr(R.num != 1 || R.den != 1 || R.exp != 0) {
-    auto txt = basic_fixed_string("[") + regular<R.num>();
     if constexpr(R.den == 1) {
       if constexpr(R.exp == 0) {
-        return txt + basic_fixed_string("]");
+        return concat(basic_fixed_string("["), regular<R.num>(), basic_fixed_string("]"));
       }
       else {
-        return txt + " " + base_multiplier + superscript<R.exp>() +
-            basic_fixed_string("]");
+        return concat(basic_fixed_string("["), regular<R.num>(), basic_fixed_string(" "), base_multiplier,
+                      superscript<R.exp>(), basic_fixed_string("]"));
       }
     }
     else {
       if constexpr(R.exp == 0) {
-        return txt + basic_fixed_string("/") + regular<R.den>() +
-            basic_fixed_string("]");
+        return concat(basic_fixed_string("["), regular<R.num>(), basic_fixed_string("/"), regular<R.den>(),
+                      basic_fixed_string("]"));
       }
       else {
-        return txt + basic_fixed_string("/") + regular<R.den>() +
-            " " + base_multiplier + superscript<R.exp>() +
-            basic_fixed_string("]");
+        return concat(basic_fixed_string("["), regular<R.num>(), basic_fixed_string("/"), regular<R.den>(),
+                      basic_fixed_string(" "), base_multiplier, superscript<R.exp>(), basic_fixed_string("]"));
       }
     }
   }
@@ -85,7 +85,7 @@ constexpr auto prefix_or_ratio_text()
         // print as a ratio of the coherent unit
         constexpr auto txt = ratio_text<R>();
         if constexpr(SymbolLen > 0 && txt.standard().size() > 0)
-          return txt + basic_fixed_string(" ");
+          return concat(txt, basic_fixed_string(" "));
         else
           return txt;
       }
@@ -94,7 +94,7 @@ constexpr auto prefix_or_ratio_text()
       // print as a ratio of the coherent unit
       constexpr auto txt = ratio_text<R>();
       if constexpr(SymbolLen > 0 && txt.standard().size() > 0)
-        return txt + basic_fixed_string(" ");
+        return concat(txt, basic_fixed_string(" "));
       else
         return txt;
     }
@@ -104,7 +104,7 @@ constexpr auto prefix_or_ratio_text()
 template<typename... Es, std::size_t... Idxs>
 constexpr auto derived_dimension_unit_text(exponent_list<Es...>, std::index_sequence<Idxs...>)
 {
-  return (exp_text<Es, dimension_unit<typename Es::dimension>::symbol, negative_exp_count<Es...>, Idxs>() + ... + basic_symbol_text(basic_fixed_string("")));
+  return concat(basic_symbol_text(basic_fixed_string("")), exp_text<Es, dimension_unit<typename Es::dimension>::symbol, negative_exp_count<Es...>, Idxs>()...);
 }
 
 template<typename... Es>
@@ -166,15 +166,39 @@ constexpr auto unit_text()
       // use predefined coherent unit symbol
       constexpr auto symbol_text = coherent_unit::symbol;
       constexpr auto prefix_txt = prefix_or_ratio_text<U::ratio / coherent_unit::ratio, typename U::reference::prefix_family, symbol_text.standard().size()>();
-      return prefix_txt + symbol_text;
+      return concat(prefix_txt, symbol_text);
     }
     else {
       // use derived dimension ingredients to create a unit symbol
       constexpr auto symbol_text = derived_dimension_unit_text<Dim>();
       constexpr auto prefix_txt = prefix_or_ratio_text<U::ratio / coherent_unit::ratio, typename U::reference::prefix_family, symbol_text.standard().size()>();
-      return prefix_txt + symbol_text;
+      return concat(prefix_txt, symbol_text);
     }
   }
 }
 
+/**
+ * @brief The symbol text of a unit generated only once for each dimension and unit
+ *
+ * The library code printing units should use it (or its accessors) rather than call `unit_text()`
+ * directly so the compile-time symbol generation is not repeated in every formatting function.
+ */
+template<Dimension Dim, Unit U>
+inline constexpr auto unit_symbol = unit_text<Dim, U>();
+
+template<Dimension Dim, Unit U>
+[[nodiscard]] constexpr std::basic_string_view<typename std::remove_cvref_t<decltype(unit_symbol<Dim, U>)>::standard_char_type>
+unit_symbol_standard() noexcept
+{
+  constexpr auto& txt = unit_symbol<Dim, U>.standard();
+  return {txt.data(), txt.size()};
+}
+
+template<Dimension Dim, Unit U>
+[[nodiscard]] constexpr std::basic_string_view<char> unit_symbol_ascii() noexcept
+{
+  constexpr auto& txt = unit_symbol<Dim, U>.ascii();
+  return {txt.data(), txt.size()};
+}
+
 }  // namespace units::detail
@@ -26,8 +26,29 @@
 #include <limits>
 #include <type_traits>
 
+#if UNITS_HAS_BFLOAT16
+#include <stdfloat>
+#endif
+
 namespace units {
 
+namespace detail {
+
+template<typename T>
+inline constexpr bool is_half_precision = false;
+
+#if UNITS_HAS_FLOAT16
+template<>
+inline constexpr bool is_half_precision<_Float16> = true;
+#endif
+
+#if UNITS_HAS_BFLOAT16
+template<>
+inline constexpr bool is_half_precision<std::bfloat16_t> = true;
+#endif
+
+}  // namespace detail
+
 /**
  * @brief Specifies if a value of a type should be treated as a floating-point value
  * 
@@ -38,7 +59,7 @@ namespace units {
  * @tparam Rep a representation type for which a type trait is defined
  */
 template<typename Rep>
-inline constexpr bool treat_as_floating_point = std::is_floating_point_v<Rep>;
+inline constexpr bool treat_as_floating_point = std::is_floating_point_v<Rep> || detail::is_half_precision<Rep>;
 
 template<typename T>
   requires requires { typename T::value_type; }
@@ -72,6 +93,19 @@ struct quantity_values {
   { return std::numeric_limits<Rep>::max(); }
 };
 
+#if UNITS_HAS_FLOAT16
+
+// std::numeric_limits is not specialized for _Float16 by all the Standard Library implementations
+template<>
+struct quantity_values<_Float16> {
+  static constexpr _Float16 zero() noexcept { return _Float16(0); }
+  static constexpr _Float16 one() noexcept { return _Float16(1); }
+  static constexpr _Float16 min() noexcept { return static_cast<_Float16>(-65504.f); }
+  static constexpr _Float16 max() noexcept { return static_cast<_Float16>(65504.f); }
+};
+
+#endif
+
 /**
  * @brief Provides support for external quantity-like types
  * 
@@ -51,6 +51,62 @@ namespace detail {
 template<Exponent... Es>
 using make_dimension = TYPENAME to_derived_dimension_base<typename dim_consolidate<type_list_sort<typename dim_unpack<Es...>::type, exponent_less>>::type>::type;
 
+template<typename E1, typename E2>
+[[nodiscard]] consteval bool exponents_ordered()
+{
+  if constexpr (BaseDimension<typename E1::dimension> && BaseDimension<typename E2::dimension>)
+    return exponent_less<E1, E2>::value;
+  else
+    return false;
+}
+
+/**
+ * @brief Checks if the exponents are already in the form created by make_dimension
+ *
+ * It is true for exponents of base dimensions strictly ordered with units::exponent_less (i.e. the
+ * results of dimensional algebra). The check is linear in the number of exponents while
+ * make_dimension sorts them.
+ */
+template<Exponent... Es>
+inline constexpr bool normalized_exponents = true;
+
+template<Exponent E>
+inline constexpr bool normalized_exponents<E> = BaseDimension<typename E::dimension>;
+
+template<Exponent E1, Exponent E2, Exponent... ERest>
+inline constexpr bool normalized_exponents<E1, E2, ERest...> = exponents_ordered<E1, E2>() && normalized_exponents<E2, ERest...>;
+
+/**
+ * @brief Creates a units::derived_dimension_base with make_dimension only if the exponents are not normalized yet
+ */
+template<bool Normalized, Exponent... Es>
+struct make_dimension_unless_normalized {
+  using type = derived_dimension_base<Es...>;
+};
+
+template<Exponent... Es>
+struct make_dimension_unless_normalized<false, Es...> {
+  using type = make_dimension<Es...>;
+};
+
+/**
+ * @brief The implementation of a derived dimension with an already normalized units::derived_dimension_base
+ *
+ * Results of dimensional algebra are already unpacked, sorted, and consolidated so they can skip the
+ * make_dimension step and instantiate only the downcasting facility.
+ *
+ * @tparam Child inherited class type used by the downcasting facility (CRTP Idiom)
+ * @tparam U a coherent unit of a derived dimension
+ * @tparam Base the normalized units::derived_dimension_base of a dimension
+ * @tparam Es the list of exponents of ingredient dimensions
+ */
+template<typename Child, Unit U, typename Base, Exponent... Es>
+struct derived_dimension_impl : downcast_dispatch<Child, Base> {
+  using recipe = exponent_list<Es...>;
+  using coherent_unit = U;
+  static constexpr ratio base_units_ratio = detail::base_units_ratio(typename derived_dimension_impl::exponents());
+};
+
 }  // namespace detail
 
 /**
@@ -81,10 +137,6 @@ using make_dimension = TYPENAME to_derived_dimension_base<typename dim_consolida
  * @tparam Es the list of exponents of ingredient dimensions
  */
 template<typename Child, Unit U, Exponent... Es>
-struct derived_dimension : downcast_dispatch<Child, typename detail::make_dimension<Es...>> {
-  using recipe = exponent_list<Es...>;
-  using coherent_unit = U;
-  static constexpr ratio base_units_ratio = detail::base_units_ratio(typename derived_dimension::exponents());
-};
+struct derived_dimension : detail::derived_dimension_impl<Child, U, detail::make_dimension<Es...>, Es...> {};
 
 }  // namespace units
@@ -0,0 +1,304 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/customization_points.h>
+#include <units/quantity_cast.h>
+#include <units/ratio.h>
+#include <gsl/gsl-lite.hpp>
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace units {
+
+template<std::integral IntRep, int FracBits>
+  requires (sizeof(IntRep) < sizeof(std::intmax_t)) && (FracBits >= 0) && (FracBits < std::numeric_limits<IntRep>::digits)
+class fixed_point;
+
+namespace detail {
+
+template<typename T>
+inline constexpr bool is_fixed_point = false;
+
+template<typename IntRep, int FracBits>
+inline constexpr bool is_fixed_point<fixed_point<IntRep, FracBits>> = true;
+
+template<std::integral IntRep>
+[[nodiscard]] constexpr IntRep saturate(std::intmax_t v) noexcept
+{
+  return static_cast<IntRep>(std::clamp<std::intmax_t>(v, std::numeric_limits<IntRep>::lowest(), std::numeric_limits<IntRep>::max()));
+}
+
+template<std::integral IntRep, std::floating_point T>
+[[nodiscard]] constexpr IntRep saturate_round(T v) noexcept
+{
+  if (v != v) return IntRep(0);  // NaN
+  if (v <= static_cast<T>(std::numeric_limits<IntRep>::lowest())) return std::numeric_limits<IntRep>::lowest();
+  if (v >= static_cast<T>(std::numeric_limits<IntRep>::max())) return std::numeric_limits<IntRep>::max();
+  return static_cast<IntRep>(v < T(0) ? v - T(0.5) : v + T(0.5));
+}
+
+template<std::integral IntRep, std::floating_point T>
+[[nodiscard]] constexpr IntRep saturate_trunc(T v) noexcept
+{
+  if (v != v) return IntRep(0);  // NaN
+  if (v <= static_cast<T>(std::numeric_limits<IntRep>::lowest())) return std::numeric_limits<IntRep>::lowest();
+  if (v >= static_cast<T>(std::numeric_limits<IntRep>::max())) return std::numeric_limits<IntRep>::max();
+  return static_cast<IntRep>(v);
+}
+
+}  // namespace detail
+
+/**
+ * @brief A binary fixed-point number
+ *
+ * Stores a value as an integer number of @c 2^-FracBits steps (i.e. @c fixed_point<std::uint16_t, 2>
+ * stores values in 0.25 steps in 2 bytes), which makes it a good fit for packed and wire-format data.
+ *
+ * Construction from arithmetic types rounds to the nearest step. All conversions and arithmetic
+ * operations saturate at the range of @c IntRep instead of overflowing.
+ *
+ * @tparam IntRep an integral type used for storage (at most 4 bytes)
+ * @tparam FracBits a number of fractional bits
+ */
+template<std::integral IntRep, int FracBits>
+  requires (sizeof(IntRep) < sizeof(std::intmax_t)) && (FracBits >= 0) && (FracBits < std::numeric_limits<IntRep>::digits)
+class fixed_point {
+  IntRep raw_;
+
+  struct raw_tag {};
+  constexpr fixed_point(raw_tag, IntRep raw) noexcept : raw_(raw) {}
+
+  static constexpr std::intmax_t one_raw = std::intmax_t(1) << FracBits;
+
+  template<std::integral T>
+  [[nodiscard]] static constexpr IntRep raw_from_integral(T v) noexcept
+  {
+    if (!std::in_range<IntRep>(v)) return std::cmp_less(v, 0) ? std::numeric_limits<IntRep>::lowest() : std::numeric_limits<IntRep>::max();
+    return detail::saturate<IntRep>(static_cast<std::intmax_t>(v) * one_raw);
+  }
+
+  template<typename IntRep2, int FracBits2>
+  [[nodiscard]] static constexpr IntRep raw_from_fixed_point(const fixed_point<IntRep2, FracBits2>& v) noexcept
+  {
+    if constexpr (FracBits >= FracBits2)
+      return detail::saturate<IntRep>(static_cast<std::intmax_t>(v.raw()) * (std::intmax_t(1) << (FracBits - FracBits2)));
+    else
+      return detail::saturate<IntRep>(static_cast<std::intmax_t>(v.raw()) >> (FracBits2 - FracBits));
+  }
+
+public:
+  using raw_type = IntRep;
+  static constexpr int fractional_bits = FracBits;
+
+  fixed_point() = default;
+
+  template<std::integral T>
+  constexpr explicit(false) fixed_point(T v) noexcept : raw_(raw_from_integral(v)) {}
+
+  template<std::floating_point T>
+  constexpr explicit(false) fixed_point(T v) noexcept : raw_(detail::saturate_round<IntRep>(v * static_cast<T>(one_raw))) {}
+
+  template<typename IntRep2, int FracBits2>
+    requires (!std::same_as<fixed_point<IntRep2, FracBits2>, fixed_point>)
+  constexpr explicit fixed_point(const fixed_point<IntRep2, FracBits2>& v) noexcept : raw_(raw_from_fixed_point(v)) {}
+
+  [[nodiscard]] static constexpr fixed_point from_raw(IntRep raw) noexcept { return fixed_point(raw_tag{}, raw); }
+  [[nodiscard]] constexpr IntRep raw() const noexcept { return raw_; }
+
+  template<std::floating_point T>
+  [[nodiscard]] constexpr explicit operator T() const noexcept { return static_cast<T>(raw_) / static_cast<T>(one_raw); }
+
+  template<std::integral T>
+  [[nodiscard]] constexpr explicit operator T() const noexcept
+  {
+    return static_cast<T>(static_cast<std::intmax_t>(raw_) / one_raw);
+  }
+
+  [[nodiscard]] constexpr fixed_point operator+() const noexcept { return *this; }
+  [[nodiscard]] constexpr fixed_point operator-() const noexcept
+  {
+    return from_raw(detail::saturate<IntRep>(-static_cast<std::intmax_t>(raw_)));
+  }
+
+  constexpr fixed_point& operator+=(const fixed_point& rhs) noexcept { return *this = *this + rhs; }
+  constexpr fixed_point& operator-=(const fixed_point& rhs) noexcept { return *this = *this - rhs; }
+  constexpr fixed_point& operator*=(const fixed_point& rhs) noexcept { return *this = *this * rhs; }
+  constexpr fixed_point& operator/=(const fixed_point& rhs) noexcept { return *this = *this / rhs; }
+
+  // Hidden Friends
+  // Below friend functions are to be found via argument-dependent lookup only
+  [[nodiscard]] friend constexpr fixed_point operator+(const fixed_point& lhs, const fixed_point& rhs) noexcept
+  {
+    return from_raw(detail::saturate<IntRep>(static_cast<std::intmax_t>(lhs.raw_) + rhs.raw_));
+  }
+
+  [[nodiscard]] friend constexpr fixed_point operator-(const fixed_point& lhs, const fixed_point& rhs) noexcept
+  {
+    return from_raw(detail::saturate<IntRep>(static_cast<std::intmax_t>(lhs.raw_) - rhs.raw_));
+  }
+
+  [[nodiscard]] friend constexpr fixed_point operator*(const fixed_point& lhs, const fixed_point& rhs) noexcept
+  {
+    const std::intmax_t product = static_cast<std::intmax_t>(lhs.raw_) * rhs.raw_;
+    if constexpr (FracBits == 0)
+      return from_raw(detail::saturate<IntRep>(product));
+    else
+      return from_raw(detail::saturate<IntRep>((product + (one_raw >> 1)) >> FracBits));
+  }
+
+  [[nodiscard]] friend constexpr fixed_point operator/(const fixed_point& lhs, const fixed_point& rhs)
+  {
+    gsl_ExpectsAudit(rhs.raw_ != 0);
+    return from_raw(detail::saturate<IntRep>(static_cast<std::intmax_t>(lhs.raw_) * one_raw / rhs.raw_));
+  }
+
+  [[nodiscard]] friend constexpr auto operator<=>(const fixed_point& lhs, const fixed_point& rhs) = default;
+  [[nodiscard]] friend constexpr bool operator==(const fixed_point& lhs, const fixed_point& rhs) = default;
+};
+
+template<typename IntRep, int FracBits>
+inline constexpr bool treat_as_floating_point<fixed_point<IntRep, FracBits>> = (FracBits > 0);
+
+template<typename IntRep, int FracBits>
+struct quantity_values<fixed_point<IntRep, FracBits>> {
+  using rep = fixed_point<IntRep, FracBits>;
+  static constexpr rep zero() noexcept { return rep::from_raw(IntRep(0)); }
+  static constexpr rep one() noexcept { return rep(1); }
+  static constexpr rep min() noexcept { return rep::from_raw(std::numeric_limits<IntRep>::lowest()); }
+  static constexpr rep max() noexcept { return rep::from_raw(std::numeric_limits<IntRep>::max()); }
+};
+
+namespace detail {
+
+template<typename T>
+inline constexpr int fractional_bits_of = 0;
+
+template<typename IntRep, int FracBits>
+inline constexpr int fractional_bits_of<fixed_point<IntRep, FracBits>> = FracBits;
+
+template<typename T>
+[[nodiscard]] constexpr auto raw_value_of(const T& v) noexcept
+{
+  if constexpr (is_fixed_point<T>)
+    return v.raw();
+  else
+    return v;
+}
+
+/**
+ * @brief Converts a value to another representation type and scales it by @c R
+ *
+ * The binary scale of the fixed-point types taking part in the conversion and the ratio @c R
+ * are folded into a single compile-time constant, so the conversion costs one multiplication.
+ */
+template<typename To, ratio R, typename From>
+[[nodiscard]] constexpr To fixed_point_scale(const From& v) noexcept
+{
+  using calc = std::conditional_t<std::floating_point<To>, To, std::conditional_t<std::floating_point<From>, From, double>>;
+  constexpr int shift = fractional_bits_of<To> - fractional_bits_of<From>;
+  constexpr long double binary_scale = shift >= 0 ? static_cast<long double>(std::intmax_t(1) << shift)
+                                                  : 1.0L / static_cast<long double>(std::intmax_t(1) << -shift);
+  constexpr calc factor = static_cast<calc>(static_cast<long double>(R.num) * fpow10<long double>(R.exp) /
+                                            static_cast<long double>(R.den) * binary_scale);
+  const calc result = static_cast<calc>(raw_value_of(v)) * factor;
+  if constexpr (is_fixed_point<To>)
+    return To::from_raw(saturate_round<typename To::raw_type>(result));
+  else if constexpr (std::integral<To>)
+    return saturate_trunc<To>(result);
+  else
+    return static_cast<To>(result);
+}
+
+template<typename From, typename To>
+struct fixed_point_cast_traits {
+  using ratio_type = double;
+  using rep_type = std::conditional_t<std::floating_point<To>, To, double>;
+
+  template<ratio R>
+  [[nodiscard]] static constexpr To scale(const From& v) noexcept { return fixed_point_scale<To, R>(v); }
+};
+
+template<typename IntRep, int FracBits, typename To>
+struct cast_traits<fixed_point<IntRep, FracBits>, To> : fixed_point_cast_traits<fixed_point<IntRep, FracBits>, To> {};
+
+template<typename From, typename IntRep, int FracBits>
+struct cast_traits<From, fixed_point<IntRep, FracBits>> : fixed_point_cast_traits<From, fixed_point<IntRep, FracBits>> {};
+
+template<typename IntRep1, int FracBits1, typename IntRep2, int FracBits2>
+struct cast_traits<fixed_point<IntRep1, FracBits1>, fixed_point<IntRep2, FracBits2>> :
+    fixed_point_cast_traits<fixed_point<IntRep1, FracBits1>, fixed_point<IntRep2, FracBits2>> {};
+
+}  // namespace detail
+
+/**
+ * @brief Checks if a range of quantity values can be represented by a target quantity type
+ *
+ * Meant to be used in a @c static_assert to verify at compile-time that a packed representation
+ * (i.e. a @c fixed_point one) does not saturate for the expected range of values:
+ *
+ * static_assert(units::range_fits<altitude>(-500_q_m, 15'000_q_m));
+ *
+ * @tparam To a target quantity type
+ * @param lo the lowest expected value
+ * @param hi the highest expected value
+ */
+template<Quantity To, QuantityOf<typename To::dimension> Q>
+  requires requires { quantity_values<typename To::rep>::min(); quantity_values<typename To::rep>::max(); }
+[[nodiscard]] consteval bool range_fits(const Q& lo, const Q& hi)
+{
+  using calc = quantity<typename To::dimension, typename To::unit, long double>;
+  const auto min = static_cast<long double>(quantity_values<typename To::rep>::min());
+  const auto max = static_cast<long double>(quantity_values<typename To::rep>::max());
+  const long double l = quantity_cast<calc>(quantity<typename Q::dimension, typename Q::unit, long double>(static_cast<long double>(lo.number()))).number();
+  const long double h = quantity_cast<calc>(quantity<typename Q::dimension, typename Q::unit, long double>(static_cast<long double>(hi.number()))).number();
+  return min <= l && h <= max;
+}
+
+}  // namespace units
+
+namespace std {
+
+template<typename IntRep1, int FracBits1, typename IntRep2, int FracBits2>
+struct common_type<units::fixed_point<IntRep1, FracBits1>, units::fixed_point<IntRep2, FracBits2>> {
+  using type = units::fixed_point<common_type_t<IntRep1, IntRep2>, (FracBits1 > FracBits2 ? FracBits1 : FracBits2)>;
+};
+
+template<typename IntRep, int FracBits, typename T>
+  requires is_arithmetic_v<T>
+struct common_type<units::fixed_point<IntRep, FracBits>, T> {
+  using type = conditional_t<is_floating_point_v<T>, T, units::fixed_point<IntRep, FracBits>>;
+};
+
+template<typename T, typename IntRep, int FracBits>
+  requires is_arithmetic_v<T>
+struct common_type<T, units::fixed_point<IntRep, FracBits>> {
+  using type = conditional_t<is_floating_point_v<T>, T, units::fixed_point<IntRep, FracBits>>;
+};
+
+}  // namespace std
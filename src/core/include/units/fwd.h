@@ -0,0 +1,53 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/bits/basic_concepts.h>
+
+/**
+ * @file
+ * @brief Forward declarations of the library class templates
+ *
+ * Lightweight enough to be included by headers that only need to name the quantity types
+ * (i.e. in generic function declarations) without defining any of their operations. The default
+ * template arguments are provided only here.
+ */
+
+namespace units {
+
+template<Dimension D, UnitOf<D> U>
+struct reference;
+
+template<Dimension D, UnitOf<D> U, Representation Rep = double>
+class quantity;
+
+template<PointOrigin O, UnitOf<typename O::dimension> U, Representation Rep = double>
+class quantity_point;
+
+template<Kind K, UnitOf<typename K::dimension> U, Representation Rep = double>
+class quantity_kind;
+
+template<PointKind PK, UnitOf<typename PK::dimension> U, Representation Rep = double>
+class quantity_point_kind;
+
+}  // namespace units
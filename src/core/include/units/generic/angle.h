@@ -72,3 +72,5 @@ using namespace angle_references;
 #endif // UNITS_NO_REFERENCES
 
 }  // namespace units
+
+UNITS_DOWNCAST_REGISTER(units::radian);
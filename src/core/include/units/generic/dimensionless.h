@@ -48,3 +48,7 @@ template<UnitOf<dim_one> U, Representation Rep = double>
 using dimensionless = quantity<dim_one, U, Rep>;
 
 }  // namespace units
+
+UNITS_DOWNCAST_REGISTER(units::one);
+UNITS_DOWNCAST_REGISTER(units::percent);
+UNITS_DOWNCAST_REGISTER(units::dim_one);
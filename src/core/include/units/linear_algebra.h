@@ -0,0 +1,371 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/concepts.h>
+#include <units/quantity.h>
+#include <gsl/gsl-lite.hpp>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace units::la {
+
+template<Quantity... Qs>
+  requires (std::same_as<typename Qs::rep, double> && ...) && (sizeof...(Qs) > 0)
+class vector;
+
+namespace detail {
+
+template<typename Q>
+using inverse_quantity = decltype(1. / std::declval<Q>());
+
+template<typename R, typename C>
+using element_quantity = decltype(std::declval<R>() / std::declval<C>());
+
+template<typename T>
+inline constexpr bool is_vector = false;
+
+template<typename... Qs>
+inline constexpr bool is_vector<vector<Qs...>> = true;
+
+template<typename T>
+concept vector_ = is_vector<T>;  // exposition only
+
+template<typename V>
+struct inverse_vector;
+
+template<typename... Qs>
+struct inverse_vector<vector<Qs...>> {
+  using type = vector<inverse_quantity<Qs>...>;
+};
+
+[[nodiscard]] constexpr double abs(double v) noexcept { return v < 0 ? -v : v; }
+
+}  // namespace detail
+
+/**
+ * @brief A column vector of quantities of possibly different dimensions
+ *
+ * The numbers of all the elements are stored in a contiguous array of @c double expressed
+ * in the units of the corresponding quantity types, so the arithmetic kernels run on raw
+ * numbers while all the dimension checks are done at compile time. For example a state of
+ * a 1D constant-velocity Kalman filter can be expressed as:
+ *
+ * la::vector<length<metre>, speed<metre_per_second>> x(0_q_m, 1_q_m_per_s);
+ *
+ * @tparam Qs quantity types of the elements of the vector
+ */
+template<Quantity... Qs>
+  requires (std::same_as<typename Qs::rep, double> && ...) && (sizeof...(Qs) > 0)
+class vector {
+  double numbers_[sizeof...(Qs)]{};
+
+public:
+  static constexpr std::size_t size = sizeof...(Qs);
+
+  template<std::size_t I>
+  using element_type = std::tuple_element_t<I, std::tuple<Qs...>>;
+
+  vector() = default;
+  constexpr explicit(sizeof...(Qs) == 1) vector(const Qs&... qs) noexcept : numbers_{qs.number()...} {}
+
+  [[nodiscard]] static constexpr vector zero() noexcept { return vector(); }
+
+  template<std::size_t I>
+    requires (I < size)
+  [[nodiscard]] constexpr element_type<I> get() const noexcept { return element_type<I>(numbers_[I]); }
+
+  template<std::size_t I>
+    requires (I < size)
+  constexpr void set(const element_type<I>& q) noexcept { numbers_[I] = q.number(); }
+
+  [[nodiscard]] constexpr std::span<double, size> numbers() noexcept { return numbers_; }
+  [[nodiscard]] constexpr std::span<const double, size> numbers() const noexcept { return numbers_; }
+
+  constexpr vector& operator+=(const vector& v) noexcept
+  {
+    for (std::size_t i = 0; i < size; ++i) numbers_[i] += v.numbers_[i];
+    return *this;
+  }
+
+  constexpr vector& operator-=(const vector& v) noexcept
+  {
+    for (std::size_t i = 0; i < size; ++i) numbers_[i] -= v.numbers_[i];
+    return *this;
+  }
+
+  constexpr vector& operator*=(double v) noexcept
+  {
+    for (double& n : numbers_) n *= v;
+    return *this;
+  }
+
+  // Hidden Friends
+  // Below friend functions are to be found via argument-dependent lookup only
+
+  [[nodiscard]] friend constexpr vector operator+(vector lhs, const vector& rhs) noexcept { return lhs += rhs; }
+  [[nodiscard]] friend constexpr vector operator-(vector lhs, const vector& rhs) noexcept { return lhs -= rhs; }
+  [[nodiscard]] friend constexpr vector operator*(vector lhs, double rhs) noexcept { return lhs *= rhs; }
+  [[nodiscard]] friend constexpr vector operator*(double lhs, vector rhs) noexcept { return rhs *= lhs; }
+
+  [[nodiscard]] friend constexpr bool operator==(const vector& lhs, const vector& rhs) noexcept
+  {
+    for (std::size_t i = 0; i < size; ++i)
+      if (lhs.numbers_[i] != rhs.numbers_[i]) return false;
+    return true;
+  }
+};
+
+/**
+ * @brief A vector of the inverses of the quantities of @c V (i.e. 1/m for m)
+ */
+template<typename V>
+using inverse_vector = TYPENAME detail::inverse_vector<V>::type;
+
+/**
+ * @brief A matrix mapping vectors of type @c Cols to vectors of type @c Rows
+ *
+ * The quantity type of the element in row @c I and column @c J is @c Rows[I] / @c Cols[J] so
+ * multiplication by a @c Cols vector always yields a @c Rows vector. For example a covariance
+ * matrix of a state @c X is @c matrix<X, inverse_vector<X>> as its elements are products of
+ * the state quantities.
+ *
+ * The numbers of all the elements are stored in a row-major contiguous array of @c double
+ * expressed in the units of the element quantity types. The dimensions of the results of
+ * multiplication, transpose, and inverse are computed at compile time while the kernels
+ * operate on raw numbers only.
+ *
+ * @tparam Rows a vector type describing the rows of the matrix
+ * @tparam Cols a vector type describing the columns of the matrix
+ */
+template<detail::vector_ Rows, detail::vector_ Cols>
+class matrix {
+  double numbers_[Rows::size * Cols::size]{};
+
+  template<std::size_t... Is, typename... Es>
+  constexpr void init(std::index_sequence<Is...>, const Es&... es) noexcept
+  {
+    ((numbers_[Is] = element_type<Is / cols, Is % cols>(es).number()), ...);
+  }
+
+  template<typename... Es, std::size_t... Is>
+  [[nodiscard]] static consteval bool constructible_elements(std::index_sequence<Is...>)
+  {
+    return (std::constructible_from<element_type<Is / cols, Is % cols>, const Es&> && ...);
+  }
+
+public:
+  using rows_type = Rows;
+  using cols_type = Cols;
+  static constexpr std::size_t rows = Rows::size;
+  static constexpr std::size_t cols = Cols::size;
+
+  template<std::size_t I, std::size_t J>
+  using element_type = detail::element_quantity<typename Rows::template element_type<I>, typename Cols::template element_type<J>>;
+
+  matrix() = default;
+
+  /**
+   * @brief Constructs a matrix from all of its elements given in a row-major order
+   *
+   * Every argument has to be explicitly convertible to the quantity type of its element, so
+   * a plain number can initialize a dimensionful element (i.e. 0 for a frequency).
+   */
+  template<typename... Es>
+    requires (sizeof...(Es) == rows * cols) && (constructible_elements<Es...>(std::index_sequence_for<Es...>{}))
+  constexpr explicit matrix(const Es&... es) noexcept
+  {
+    init(std::index_sequence_for<Es...>{}, es...);
+  }
+
+  [[nodiscard]] static constexpr matrix zero() noexcept { return matrix(); }
+
+  [[nodiscard]] static constexpr matrix identity() noexcept
+    requires std::same_as<Rows, Cols>
+  {
+    matrix m;
+    for (std::size_t i = 0; i < rows; ++i) m.numbers_[i * cols + i] = 1.;
+    return m;
+  }
+
+  template<std::size_t I, std::size_t J>
+    requires (I < rows) && (J < cols)
+  [[nodiscard]] constexpr element_type<I, J> get() const noexcept
+  {
+    return element_type<I, J>(numbers_[I * cols + J]);
+  }
+
+  template<std::size_t I, std::size_t J>
+    requires (I < rows) && (J < cols)
+  constexpr void set(const element_type<I, J>& q) noexcept { numbers_[I * cols + J] = q.number(); }
+
+  [[nodiscard]] constexpr std::span<double, rows * cols> numbers() noexcept { return numbers_; }
+  [[nodiscard]] constexpr std::span<const double, rows * cols> numbers() const noexcept { return numbers_; }
+
+  constexpr matrix& operator+=(const matrix& m) noexcept
+  {
+    for (std::size_t i = 0; i < rows * cols; ++i) numbers_[i] += m.numbers_[i];
+    return *this;
+  }
+
+  constexpr matrix& operator-=(const matrix& m) noexcept
+  {
+    for (std::size_t i = 0; i < rows * cols; ++i) numbers_[i] -= m.numbers_[i];
+    return *this;
+  }
+
+  constexpr matrix& operator*=(double v) noexcept
+  {
+    for (double& n : numbers_) n *= v;
+    return *this;
+  }
+
+  // Hidden Friends
+  // Below friend functions are to be found via argument-dependent lookup only
+
+  [[nodiscard]] friend constexpr matrix operator+(matrix lhs, const matrix& rhs) noexcept { return lhs += rhs; }
+  [[nodiscard]] friend constexpr matrix operator-(matrix lhs, const matrix& rhs) noexcept { return lhs -= rhs; }
+  [[nodiscard]] friend constexpr matrix operator*(matrix lhs, double rhs) noexcept { return lhs *= rhs; }
+  [[nodiscard]] friend constexpr matrix operator*(double lhs, matrix rhs) noexcept { return rhs *= lhs; }
+
+  [[nodiscard]] friend constexpr Rows operator*(const matrix& m, const Cols& v) noexcept
+  {
+    Rows result;
+    const auto in = v.numbers();
+    const auto out = result.numbers();
+    for (std::size_t i = 0; i < rows; ++i) {
+      double acc = 0.;
+      for (std::size_t j = 0; j < cols; ++j) acc += m.numbers_[i * cols + j] * in[j];
+      out[i] = acc;
+    }
+    return result;
+  }
+
+  [[nodiscard]] friend constexpr bool operator==(const matrix& lhs, const matrix& rhs) noexcept
+  {
+    for (std::size_t i = 0; i < rows * cols; ++i)
+      if (lhs.numbers_[i] != rhs.numbers_[i]) return false;
+    return true;
+  }
+};
+
+/**
+ * @brief Multiplies two matrices
+ *
+ * The columns of @c lhs have to match the rows of @c rhs.
+ *
+ * @return matrix<Rows, Cols> mapping the columns of @c rhs to the rows of @c lhs
+ */
+template<typename Rows, typename Mid, typename Cols>
+[[nodiscard]] constexpr matrix<Rows, Cols> operator*(const matrix<Rows, Mid>& lhs, const matrix<Mid, Cols>& rhs) noexcept
+{
+  constexpr std::size_t n = Rows::size;
+  constexpr std::size_t m = Mid::size;
+  constexpr std::size_t p = Cols::size;
+  matrix<Rows, Cols> result;
+  const auto a = lhs.numbers();
+  const auto b = rhs.numbers();
+  const auto c = result.numbers();
+  // i-k-j order keeps the innermost loop contiguous in both the result and the right-hand side
+  for (std::size_t i = 0; i < n; ++i)
+    for (std::size_t k = 0; k < m; ++k) {
+      const double aik = a[i * m + k];
+      for (std::size_t j = 0; j < p; ++j) c[i * p + j] += aik * b[k * p + j];
+    }
+  return result;
+}
+
+/**
+ * @brief Transposes a matrix
+ *
+ * The element in row @c J and column @c I of the result has the same quantity type as the element
+ * in row @c I and column @c J of the argument.
+ */
+template<typename Rows, typename Cols>
+[[nodiscard]] constexpr matrix<inverse_vector<Cols>, inverse_vector<Rows>> transpose(const matrix<Rows, Cols>& m) noexcept
+{
+  constexpr std::size_t rows = Rows::size;
+  constexpr std::size_t cols = Cols::size;
+  matrix<inverse_vector<Cols>, inverse_vector<Rows>> result;
+  const auto in = m.numbers();
+  const auto out = result.numbers();
+  for (std::size_t i = 0; i < rows; ++i)
+    for (std::size_t j = 0; j < cols; ++j) out[j * rows + i] = in[i * cols + j];
+  return result;
+}
+
+/**
+ * @brief Inverts a square matrix
+ *
+ * Uses the Gauss-Jordan elimination with partial pivoting on the raw numbers. The unit scaling
+ * of the rows and columns commutes with the inversion so no conversions are needed.
+ *
+ * @pre the matrix is not singular
+ *
+ * @return matrix<Cols, Rows> mapping the rows of the argument back to its columns
+ */
+template<typename Rows, typename Cols>
+  requires (Rows::size == Cols::size)
+[[nodiscard]] constexpr matrix<Cols, Rows> inverse(const matrix<Rows, Cols>& m)
+{
+  constexpr std::size_t n = Rows::size;
+  double a[n * n];
+  matrix<Cols, Rows> result = matrix<Cols, Rows>::zero();
+  const auto in = m.numbers();
+  const auto inv = result.numbers();
+  for (std::size_t i = 0; i < n * n; ++i) a[i] = in[i];
+  for (std::size_t i = 0; i < n; ++i) inv[i * n + i] = 1.;
+
+  for (std::size_t c = 0; c < n; ++c) {
+    std::size_t pivot = c;
+    for (std::size_t r = c + 1; r < n; ++r)
+      if (detail::abs(a[r * n + c]) > detail::abs(a[pivot * n + c])) pivot = r;
+    gsl_Expects(a[pivot * n + c] != 0.);
+    if (pivot != c)
+      for (std::size_t j = 0; j < n; ++j) {
+        std::swap(a[c * n + j], a[pivot * n + j]);
+        std::swap(inv[c * n + j], inv[pivot * n + j]);
+      }
+    const double d = a[c * n + c];
+    for (std::size_t j = 0; j < n; ++j) {
+      a[c * n + j] /= d;
+      inv[c * n + j] /= d;
+    }
+    for (std::size_t r = 0; r < n; ++r) {
+      if (r == c) continue;
+      const double f = a[r * n + c];
+      if (f == 0.) continue;
+      for (std::size_t j = 0; j < n; ++j) {
+        a[r * n + j] -= f * a[c * n + j];
+        inv[r * n + j] -= f * inv[c * n + j];
+      }
+    }
+  }
+  return result;
+}
+
+}  // namespace units::la
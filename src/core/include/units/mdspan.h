@@ -0,0 +1,103 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/concepts.h>
+#include <units/quantity.h>
+#include <units/quantity_cast.h>
+#include <concepts>
+#include <cstddef>
+#include <version>
+
+#if __cpp_lib_mdspan
+#include <mdspan>
+#endif
+
+namespace units {
+
+/**
+ * @brief An @c std::mdspan accessor policy viewing a buffer of raw numbers as quantities
+ *
+ * The underlying buffer stores values of @c Q::rep expressed in the unit of @c Q. Every access
+ * returns a @c Q by value so a multidimensional grid kept in a plain array (i.e. a temperature
+ * field or terrain heights) can be used through a strongly typed view without copying it.
+ *
+ * @tparam Q a quantity type returned by the accessor
+ */
+template<Quantity Q>
+struct quantity_accessor {
+  using offset_policy = quantity_accessor;
+  using element_type = const Q;
+  using reference = Q;
+  using data_handle_type = const TYPENAME Q::rep*;
+
+  constexpr quantity_accessor() noexcept = default;
+
+  [[nodiscard]] constexpr reference access(data_handle_type p, std::size_t i) const noexcept { return Q(p[i]); }
+  [[nodiscard]] constexpr data_handle_type offset(data_handle_type p, std::size_t i) const noexcept { return p + i; }
+};
+
+/**
+ * @brief An @c std::mdspan accessor policy converting quantities on load
+ *
+ * The underlying buffer stores values of @c From::rep expressed in the unit of @c From. Every access
+ * returns the element converted to @c To with a @c quantity_cast, so the conversion ratio is folded
+ * at compile time and applied with a single multiplication per loaded element. This allows viewing
+ * the same buffer i.e. both in metres and in feet without copies and without a conversion pass over
+ * the whole array.
+ *
+ * An accessor can be constructed from @c quantity_accessor<From> so an existing view can be converted
+ * to another unit. The constructor is explicit if the conversion of @c From to @c To may truncate.
+ *
+ * @tparam From a quantity type of the elements stored in the buffer
+ * @tparam To a quantity type returned by the accessor
+ */
+template<Quantity From, Quantity To>
+  requires requires(const From& q) { quantity_cast<To>(q); }
+struct converting_accessor {
+  using offset_policy = converting_accessor;
+  using element_type = const To;
+  using reference = To;
+  using data_handle_type = const TYPENAME From::rep*;
+
+  constexpr converting_accessor() noexcept = default;
+  constexpr explicit(!std::convertible_to<From, To>) converting_accessor(quantity_accessor<From>) noexcept {}
+
+  [[nodiscard]] constexpr reference access(data_handle_type p, std::size_t i) const noexcept
+  {
+    return quantity_cast<To>(From(p[i]));
+  }
+  [[nodiscard]] constexpr data_handle_type offset(data_handle_type p, std::size_t i) const noexcept { return p + i; }
+};
+
+#if __cpp_lib_mdspan
+
+template<Quantity Q, typename Extents, typename LayoutPolicy = std::layout_right>
+using quantity_mdspan = std::mdspan<const Q, Extents, LayoutPolicy, quantity_accessor<Q>>;
+
+template<Quantity From, Quantity To, typename Extents, typename LayoutPolicy = std::layout_right>
+using converting_mdspan = std::mdspan<const To, Extents, LayoutPolicy, converting_accessor<From, To>>;
+
+#endif
+
+}  // namespace units
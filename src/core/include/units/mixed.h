@@ -0,0 +1,194 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/customization_points.h>
+#include <units/quantity_cast.h>
+#include <gsl/gsl-lite.hpp>
+#include <compare>
+#include <concepts>
+#include <limits>
+#include <type_traits>
+
+namespace units {
+
+namespace detail {
+
+template<typename T>
+concept arithmetic_ = std::is_arithmetic_v<T> || is_half_precision<T>;  // exposition only
+
+}  // namespace detail
+
+/**
+ * @brief A representation type that stores values with one precision and computes with another
+ *
+ * Meant for large, memory-bound arrays of quantities that should take only @c sizeof(Storage)
+ * bytes per element while not losing accuracy in the calculations (i.e. @c mixed<float, double>).
+ *
+ * All binary arithmetic operators promote both arguments to @c Compute and return a @c Compute
+ * value, so the whole expression is evaluated in @c Compute precision. The result is narrowed
+ * to @c Storage only when it is stored back into a @c mixed object (i.e. by an assignment, compound
+ * assignment operator, or a @c quantity_cast to a quantity using a @c mixed representation).
+ *
+ * @tparam Storage a floating-point type used to store the value
+ * @tparam Compute a floating-point type used for calculations
+ */
+template<typename Storage, std::floating_point Compute>
+  requires treat_as_floating_point<Storage> && (sizeof(Storage) <= sizeof(Compute))
+class mixed {
+  Storage value_;
+
+  template<typename T>
+  [[nodiscard]] static constexpr std::common_type_t<Compute, T> promote(const auto& v) noexcept
+  {
+    return static_cast<std::common_type_t<Compute, T>>(v);
+  }
+
+public:
+  using storage_type = Storage;
+  using compute_type = Compute;
+
+  mixed() = default;
+
+  template<detail::arithmetic_ T>
+  constexpr explicit(false) mixed(T v) noexcept : value_(static_cast<Storage>(v)) {}
+
+  [[nodiscard]] constexpr Storage stored() const noexcept { return value_; }
+  [[nodiscard]] constexpr Compute value() const noexcept { return static_cast<Compute>(value_); }
+
+  [[nodiscard]] constexpr explicit(false) operator Compute() const noexcept { return value(); }
+
+  template<detail::arithmetic_ T>
+    requires (!std::same_as<T, Compute>)
+  [[nodiscard]] constexpr explicit operator T() const noexcept { return static_cast<T>(value()); }
+
+  [[nodiscard]] constexpr mixed operator+() const noexcept { return *this; }
+  [[nodiscard]] constexpr mixed operator-() const noexcept { return mixed(-value_); }
+
+  constexpr mixed& operator+=(const mixed& rhs) noexcept { return *this = value() + rhs.value(); }
+  constexpr mixed& operator-=(const mixed& rhs) noexcept { return *this = value() - rhs.value(); }
+  constexpr mixed& operator*=(const mixed& rhs) noexcept { return *this = value() * rhs.value(); }
+  constexpr mixed& operator/=(const mixed& rhs)
+  {
+    gsl_ExpectsAudit(rhs.value_ != Storage(0));
+    return *this = value() / rhs.value();
+  }
+
+  // Hidden Friends
+  // Below friend functions are to be found via argument-dependent lookup only
+  [[nodiscard]] friend constexpr Compute operator+(const mixed& lhs, const mixed& rhs) noexcept { return lhs.value() + rhs.value(); }
+  [[nodiscard]] friend constexpr Compute operator-(const mixed& lhs, const mixed& rhs) noexcept { return lhs.value() - rhs.value(); }
+  [[nodiscard]] friend constexpr Compute operator*(const mixed& lhs, const mixed& rhs) noexcept { return lhs.value() * rhs.value(); }
+  [[nodiscard]] friend constexpr Compute operator/(const mixed& lhs, const mixed& rhs) { return lhs.value() / rhs.value(); }
+
+  template<detail::arithmetic_ T>
+  [[nodiscard]] friend constexpr auto operator+(const mixed& lhs, const T& rhs) noexcept { return promote<T>(lhs.value()) + promote<T>(rhs); }
+  template<detail::arithmetic_ T>
+  [[nodiscard]] friend constexpr auto operator+(const T& lhs, const mixed& rhs) noexcept { return promote<T>(lhs) + promote<T>(rhs.value()); }
+  template<detail::arithmetic_ T>
+  [[nodiscard]] friend constexpr auto operator-(const mixed& lhs, const T& rhs) noexcept { return promote<T>(lhs.value()) - promote<T>(rhs); }
+  template<detail::arithmetic_ T>
+  [[nodiscard]] friend constexpr auto operator-(const T& lhs, const mixed& rhs) noexcept { return promote<T>(lhs) - promote<T>(rhs.value()); }
+  template<detail::arithmetic_ T>
+  [[nodiscard]] friend constexpr auto operator*(const mixed& lhs, const T& rhs) noexcept { return promote<T>(lhs.value()) * promote<T>(rhs); }
+  template<detail::arithmetic_ T>
+  [[nodiscard]] friend constexpr auto operator*(const T& lhs, const mixed& rhs) noexcept { return promote<T>(lhs) * promote<T>(rhs.value()); }
+  template<detail::arithmetic_ T>
+  [[nodiscard]] friend constexpr auto operator/(const mixed& lhs, const T& rhs) { return promote<T>(lhs.value()) / promote<T>(rhs); }
+  template<detail::arithmetic_ T>
+  [[nodiscard]] friend constexpr auto operator/(const T& lhs, const mixed& rhs) { return promote<T>(lhs) / promote<T>(rhs.value()); }
+
+  [[nodiscard]] friend constexpr auto operator<=>(const mixed& lhs, const mixed& rhs) = default;
+  [[nodiscard]] friend constexpr bool operator==(const mixed& lhs, const mixed& rhs) = default;
+
+  template<detail::arithmetic_ T>
+  [[nodiscard]] friend constexpr auto operator<=>(const mixed& lhs, const T& rhs) noexcept { return promote<T>(lhs.value()) <=> promote<T>(rhs); }
+  template<detail::arithmetic_ T>
+  [[nodiscard]] friend constexpr bool operator==(const mixed& lhs, const T& rhs) noexcept { return promote<T>(lhs.value()) == promote<T>(rhs); }
+};
+
+template<typename Storage, typename Compute>
+inline constexpr bool treat_as_floating_point<mixed<Storage, Compute>> = true;
+
+template<typename Storage, typename Compute>
+struct quantity_values<mixed<Storage, Compute>> {
+  using rep = mixed<Storage, Compute>;
+  static constexpr rep zero() noexcept { return rep(quantity_values<Storage>::zero()); }
+  static constexpr rep one() noexcept { return rep(quantity_values<Storage>::one()); }
+  static constexpr rep min() noexcept { return rep(quantity_values<Storage>::min()); }
+  static constexpr rep max() noexcept { return rep(quantity_values<Storage>::max()); }
+};
+
+namespace detail {
+
+template<typename T>
+struct compute_type_of {
+  using type = widened_rep<T>;
+};
+
+template<typename Storage, typename Compute>
+struct compute_type_of<mixed<Storage, Compute>> {
+  using type = Compute;
+};
+
+// the value is scaled in the compute type and narrowed only when stored in the target
+template<typename From, typename To>
+struct mixed_cast_traits {
+  using ratio_type = std::common_type_t<typename compute_type_of<From>::type, typename compute_type_of<To>::type>;
+  using rep_type = ratio_type;
+};
+
+template<typename Storage, typename Compute, typename To>
+struct cast_traits<mixed<Storage, Compute>, To> : mixed_cast_traits<mixed<Storage, Compute>, To> {};
+
+template<typename From, typename Storage, typename Compute>
+struct cast_traits<From, mixed<Storage, Compute>> : mixed_cast_traits<From, mixed<Storage, Compute>> {};
+
+template<typename Storage1, typename Compute1, typename Storage2, typename Compute2>
+struct cast_traits<mixed<Storage1, Compute1>, mixed<Storage2, Compute2>> :
+    mixed_cast_traits<mixed<Storage1, Compute1>, mixed<Storage2, Compute2>> {};
+
+}  // namespace detail
+
+}  // namespace units
+
+namespace std {
+
+template<typename Storage1, typename Compute1, typename Storage2, typename Compute2>
+struct common_type<units::mixed<Storage1, Compute1>, units::mixed<Storage2, Compute2>> {
+  using type = units::mixed<common_type_t<Storage1, Storage2>, common_type_t<Compute1, Compute2>>;
+};
+
+template<typename Storage, typename Compute, typename T>
+  requires is_arithmetic_v<T>
+struct common_type<units::mixed<Storage, Compute>, T> {
+  using type = common_type_t<Compute, T>;
+};
+
+template<typename T, typename Storage, typename Compute>
+  requires is_arithmetic_v<T>
+struct common_type<T, units::mixed<Storage, Compute>> {
+  using type = common_type_t<T, Compute>;
+};
+
+}  // namespace std
@@ -0,0 +1,339 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/concepts.h>
+#include <units/generic/dimensionless.h>
+#include <units/math.h>
+#include <units/quantity.h>
+#include <units/quantity_cast.h>
+#include <gsl/gsl-lite.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <ranges>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace units::ode {
+
+/**
+ * @brief Checks if every quantity type is the derivative of the preceding one over @c T
+ *
+ * The same relationship as checked by @c kalman::state in the Kalman filter example but with
+ * an arbitrary independent variable (i.e. position, velocity, acceleration over time).
+ *
+ * @tparam T a quantity type of the independent variable
+ * @tparam Qs quantity types to check
+ */
+template<typename T, typename... Qs>
+inline constexpr bool are_derivatives = false;
+
+template<Quantity T, Quantity Q>
+inline constexpr bool are_derivatives<T, Q> = true;
+
+template<Quantity T, Quantity Q1, Quantity Q2, Quantity... Qs>
+inline constexpr bool are_derivatives<T, Q1, Q2, Qs...> =
+  equivalent<typename decltype(std::declval<Q1>() / std::declval<Q2>())::dimension, typename T::dimension> &&
+  are_derivatives<T, Q2, Qs...>;
+
+namespace detail {
+
+template<typename T>
+inline constexpr bool is_quantity_tuple = false;
+
+template<Quantity... Qs>
+inline constexpr bool is_quantity_tuple<std::tuple<Qs...>> = (sizeof...(Qs) > 0);
+
+template<typename T>
+struct derivative_impl;
+
+template<typename T, typename... Qs>
+struct derivative_impl<std::tuple<T, Qs...>> {
+  using type = std::tuple<decltype(std::declval<Qs>() / std::declval<T>())...>;
+};
+
+}  // namespace detail
+
+/**
+ * @brief A state of an ODE system expressed as a tuple of quantities
+ */
+template<typename T>
+concept State = detail::is_quantity_tuple<T>;
+
+/**
+ * @brief A tuple of the derivatives of all the quantities of the state @c S over @c T
+ */
+template<State S, Quantity T>
+using derivative = TYPENAME detail::derivative_impl<decltype(std::tuple_cat(std::declval<std::tuple<T>>(), std::declval<S>()))>::type;
+
+/**
+ * @brief A function returning the derivatives of the state @c S at the given point of @c T
+ *
+ * The returned tuple has to be convertible to @c derivative<S, T> so the dimensions of the
+ * derivatives are verified at compile time.
+ */
+template<typename F, typename S, typename T>
+concept SystemFunction = State<S> && Quantity<T> && std::regular_invocable<F&, const T&, const S&> &&
+                         std::convertible_to<std::invoke_result_t<F&, const T&, const S&>, derivative<S, T>>;
+
+namespace detail {
+
+template<std::size_t I, std::size_t N, typename... Ks>
+[[nodiscard]] constexpr auto weighted_sum(const std::array<double, N>& c, const Ks&... k)
+{
+  return [&]<std::size_t... Js>(std::index_sequence<Js...>) {
+    return ((c[Js] * std::get<I>(k)) + ...);
+  }(std::index_sequence_for<Ks...>{});
+}
+
+// y + h * (c[0] * k[0] + c[1] * k[1] + ...)
+template<State S, Quantity T, std::size_t N, typename... Ks>
+  requires (sizeof...(Ks) == N)
+[[nodiscard]] constexpr S advance(const S& y, const T& h, const std::array<double, N>& c, const Ks&... k)
+{
+  return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+    return S(static_cast<std::tuple_element_t<Is, S>>(std::get<Is>(y) + h * weighted_sum<Is>(c, k...))...);
+  }(std::make_index_sequence<std::tuple_size_v<S>>{});
+}
+
+template<Quantity T>
+[[nodiscard]] constexpr T at(const T& t, double c, const T& h)
+{
+  return static_cast<T>(t + c * h);
+}
+
+}  // namespace detail
+
+/**
+ * @brief Explicit Euler method (1st order)
+ */
+struct euler {
+  static constexpr int order = 1;
+
+  template<State S, Quantity T, SystemFunction<S, T> F>
+  [[nodiscard]] static constexpr S step(F&& f, const T& t, const S& y, const T& h)
+  {
+    const derivative<S, T> k1 = f(t, y);
+    return detail::advance(y, h, std::array{1.}, k1);
+  }
+};
+
+/**
+ * @brief Classic Runge-Kutta method (4th order)
+ */
+struct rk4 {
+  static constexpr int order = 4;
+
+  template<State S, Quantity T, SystemFunction<S, T> F>
+  [[nodiscard]] static constexpr S step(F&& f, const T& t, const S& y, const T& h)
+  {
+    using D = derivative<S, T>;
+    const D k1 = f(t, y);
+    const D k2 = f(detail::at(t, 0.5, h), detail::advance(y, h, std::array{0.5}, k1));
+    const D k3 = f(detail::at(t, 0.5, h), detail::advance(y, h, std::array{0.5}, k2));
+    const D k4 = f(detail::at(t, 1., h), detail::advance(y, h, std::array{1.}, k3));
+    return detail::advance(y, h, std::array{1. / 6, 1. / 3, 1. / 3, 1. / 6}, k1, k2, k3, k4);
+  }
+};
+
+/**
+ * @brief Dormand-Prince embedded Runge-Kutta method (5th order with a 4th order error estimate)
+ *
+ * @c step() returns the 5th order solution so the method may be used with a fixed step size.
+ * @c adaptive_step() additionally estimates the local error and proposes the next step size.
+ */
+struct rk45 {
+  static constexpr int order = 5;
+
+  template<State S, Quantity T>
+  struct adaptive_result {
+    S state;      ///< the state after the step (unchanged if the step was rejected)
+    T next_step;  ///< the step size proposed for the next step
+    bool accepted;
+  };
+
+private:
+  static constexpr std::array b = {35. / 384, 0., 500. / 1113, 125. / 192, -2187. / 6784, 11. / 84};
+  static constexpr std::array e = {71. / 57600, 0., -71. / 16695, 71. / 1920, -17253. / 339200, 22. / 525, -1. / 40};
+
+  // calls `fn` with the solution of the 5th order and all the 7 stages
+  template<State S, Quantity T, typename F, typename Fn>
+  static constexpr auto stages(F& f, const T& t, const S& y, const T& h, Fn fn)
+  {
+    using D = derivative<S, T>;
+    using detail::advance;
+    using detail::at;
+    const D k1 = f(t, y);
+    const D k2 = f(at(t, 1. / 5, h), advance(y, h, std::array{1. / 5}, k1));
+    const D k3 = f(at(t, 3. / 10, h), advance(y, h, std::array{3. / 40, 9. / 40}, k1, k2));
+    const D k4 = f(at(t, 4. / 5, h), advance(y, h, std::array{44. / 45, -56. / 15, 32. / 9}, k1, k2, k3));
+    const D k5 = f(at(t, 8. / 9, h),
+                   advance(y, h, std::array{19372. / 6561, -25360. / 2187, 64448. / 6561, -212. / 729}, k1, k2, k3, k4));
+    const D k6 = f(at(t, 1., h),
+                   advance(y, h, std::array{9017. / 3168, -355. / 33, 46732. / 5247, 49. / 176, -5103. / 18656}, k1, k2, k3, k4, k5));
+    const S next = advance(y, h, b, k1, k2, k3, k4, k5, k6);
+    return fn(next, k1, k2, k3, k4, k5, k6);
+  }
+
+public:
+  template<State S, Quantity T, SystemFunction<S, T> F>
+  [[nodiscard]] static constexpr S step(F&& f, const T& t, const S& y, const T& h)
+  {
+    return stages(f, t, y, h, [](const S& next, const auto&...) { return next; });
+  }
+
+  /**
+   * @brief Makes a single step with the local error control
+   *
+   * The error of every quantity of the state is compared with @c atol + @c rtol * |y| and the step
+   * is accepted if none of them is exceeded. A step with a non-finite error (i.e. when @c f produced
+   * a NaN or an infinity) is rejected and the smallest allowed step size is proposed.
+   *
+   * @param atol absolute tolerances of the quantities of the state
+   * @param rtol a relative tolerance
+   */
+  template<State S, Quantity T, SystemFunction<S, T> F>
+  [[nodiscard]] static adaptive_result<S, T> adaptive_step(F&& f, const T& t, const S& y, const T& h, const S& atol, double rtol)
+  {
+    return stages(f, t, y, h, [&](const S& next, const auto&... k) -> adaptive_result<S, T> {
+      // the 7th stage is evaluated at the 5th order solution (first same as last)
+      const derivative<S, T> k7 = f(detail::at(t, 1., h), next);
+      const double error = [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+        const auto ratio = [&]<std::size_t I>(std::integral_constant<std::size_t, I>) {
+          const auto err = h * detail::weighted_sum<I>(e, k..., k7);
+          const auto scale = std::get<I>(atol) + rtol * std::max(abs(std::get<I>(y)), abs(std::get<I>(next)));
+          return quantity_cast<one>(abs(err) / scale).number();
+        };
+        return std::max({ratio(std::integral_constant<std::size_t, Is>{})...});
+      }(std::make_index_sequence<std::tuple_size_v<S>>{});
+
+      constexpr double safety = 0.9;
+      if (!std::isfinite(error)) return {y, static_cast<T>(h * 0.2), false};
+      const double factor = error == 0. ? 5. : std::clamp(safety * std::pow(error, -1. / order), 0.2, 5.);
+      const T next_step = static_cast<T>(h * factor);
+      if (error <= 1.) return {next, next_step, true};
+      return {y, next_step, false};
+    });
+  }
+};
+
+/**
+ * @brief Integrates the system over [@c t0, @c t1] with fixed steps
+ *
+ * @tparam Method an integration method (i.e. @c euler or @c rk4)
+ * @param steps the number of steps to make
+ */
+template<typename Method, State S, Quantity T, SystemFunction<S, T> F>
+[[nodiscard]] constexpr S integrate(F&& f, const T& t0, const S& y0, const T& t1, std::size_t steps)
+{
+  gsl_Expects(steps > 0);
+  const T h = static_cast<T>((t1 - t0) / static_cast<double>(steps));
+  S y = y0;
+  for (std::size_t i = 0; i < steps; ++i) y = Method::step(f, static_cast<T>(t0 + static_cast<double>(i) * h), y, h);
+  return y;
+}
+
+/**
+ * @brief Integrates the system over [@c t0, @c t1] with the adaptive step size control of @c rk45
+ *
+ * @param h0 the initial step size
+ * @param atol absolute tolerances of the quantities of the state
+ * @param rtol a relative tolerance
+ * @param max_steps the maximum number of attempted (accepted and rejected) steps
+ *
+ * @throws std::runtime_error if @c t1 is not reached in @c max_steps steps (i.e. when @c f keeps
+ *         producing non-finite values or the step size underflows)
+ */
+template<State S, Quantity T, SystemFunction<S, T> F>
+[[nodiscard]] S integrate_adaptive(F&& f, const T& t0, const S& y0, const T& t1, const T& h0, const S& atol, double rtol,
+                                   std::size_t max_steps = 100'000)
+{
+  gsl_Expects(t1 > t0 && h0 > T::zero() && max_steps > 0);
+  T t = t0;
+  T h = h0;
+  S y = y0;
+  for (std::size_t i = 0; t < t1; ++i) {
+    if (i == max_steps) throw std::runtime_error("units::ode::integrate_adaptive: maximum number of steps exceeded");
+    const T step = std::min(h, static_cast<T>(t1 - t));
+    const auto result = rk45::adaptive_step(f, t, y, step, atol, rtol);
+    if (result.accepted) {
+      t = static_cast<T>(t + step);
+      y = result.state;
+    }
+    h = result.next_step;
+  }
+  return y;
+}
+
+/**
+ * @brief Makes one step of many independent systems stored as a structure of arrays
+ *
+ * Every range holds one quantity of the state of all the systems (i.e. positions and velocities
+ * of all the particles). The systems share the system function and the independent variable.
+ * The ranges are updated in place and nothing is allocated.
+ *
+ * @tparam Method an integration method (i.e. @c euler or @c rk4)
+ */
+template<typename Method, Quantity T, typename F, std::ranges::contiguous_range... Rs>
+  requires (sizeof...(Rs) > 0) && (std::ranges::sized_range<Rs> && ...) &&
+           SystemFunction<F, std::tuple<std::ranges::range_value_t<Rs>...>, T>
+constexpr void step_all(F&& f, const T& t, const T& h, Rs&&... columns)
+{
+  using S = std::tuple<std::ranges::range_value_t<Rs>...>;
+  const std::size_t size = std::ranges::size(std::get<0>(std::forward_as_tuple(columns...)));
+  gsl_Expects(((std::ranges::size(columns) == size) && ...));
+  const auto data = std::tuple(std::ranges::data(columns)...);
+  for (std::size_t i = 0; i < size; ++i) {
+    std::apply([&](auto*... d) { std::tie(d[i]...) = Method::step(f, t, S(d[i]...), h); }, data);
+  }
+}
+
+/**
+ * @brief Creates a system function of a state made of consecutive derivatives
+ *
+ * For a state of quantities where every one is a derivative of the previous one over @c T
+ * (i.e. position and velocity), only the derivative of the last quantity has to be provided
+ * (i.e. acceleration). The derivatives of all the other quantities are the next quantities of
+ * the state.
+ *
+ * @param f a function returning the derivative of the last quantity of the state
+ */
+template<typename F>
+[[nodiscard]] constexpr auto chain(F f)
+{
+  return [f]<Quantity T, Quantity... Qs>(const T& t, const std::tuple<Qs...>& y)
+    requires are_derivatives<T, Qs...> && std::regular_invocable<const F&, const T&, const std::tuple<Qs...>&>
+  {
+    return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      using D = derivative<std::tuple<Qs...>, T>;
+      return std::tuple_cat(std::tuple<std::tuple_element_t<Is, D>...>(std::get<Is + 1>(y)...), std::tuple(f(t, y)));
+    }(std::make_index_sequence<sizeof...(Qs) - 1>{});
+  };
+}
+
+}  // namespace units::ode
@@ -0,0 +1,281 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/customization_points.h>
+#include <units/quantity.h>
+
+// IWYU pragma: begin_exports
+#include <optional>
+// IWYU pragma: end_exports
+
+#include <gsl/gsl-lite.hpp>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace units {
+
+/**
+ * @brief A type trait that encodes an empty state of @c optional_quantity in the representation type
+ *
+ * @c empty() returns a value of the representation type that is reserved to mark an empty
+ * @c optional_quantity and @c is_empty(v) checks if @c v is that reserved value.
+ *
+ * The library provides specializations for IEEE 754 @c float and @c double (a quiet NaN with
+ * a reserved payload, so NaNs produced by arithmetic are still stored as values) and for
+ * integral types (the lowest representable value). This type can be specialized for custom
+ * representation types.
+ *
+ * @tparam Rep a representation type for which a type trait is defined
+ */
+template<typename Rep>
+struct optional_quantity_traits;
+
+/**
+ * @brief An @c optional_quantity empty state encoded with a user-provided sentinel value
+ *
+ * auto alt = units::optional_quantity<si::length<si::metre, std::uint16_t>, units::sentinel_value<std::uint16_t, 0xFFFF>>();
+ *
+ * @tparam Rep a representation type
+ * @tparam Sentinel a value of the representation type reserved to mark an empty state
+ */
+template<std::integral Rep, Rep Sentinel>
+struct sentinel_value {
+  [[nodiscard]] static constexpr Rep empty() noexcept { return Sentinel; }
+  [[nodiscard]] static constexpr bool is_empty(const Rep& v) noexcept { return v == Sentinel; }
+};
+
+template<std::integral Rep>
+struct optional_quantity_traits<Rep> : sentinel_value<Rep, std::numeric_limits<Rep>::lowest()> {};
+
+namespace detail {
+
+template<typename Rep>
+struct nan_payload;
+
+template<>
+struct nan_payload<float> {
+  using bits_type = std::uint32_t;
+  static constexpr bits_type value = 0x7FC0'DEADu;
+};
+
+template<>
+struct nan_payload<double> {
+  using bits_type = std::uint64_t;
+  static constexpr bits_type value = 0x7FF8'0000'DEAD'BEEFu;
+};
+
+}  // namespace detail
+
+template<std::floating_point Rep>
+  requires std::numeric_limits<Rep>::is_iec559 && requires { detail::nan_payload<Rep>::value; }
+struct optional_quantity_traits<Rep> {
+  [[nodiscard]] static constexpr Rep empty() noexcept { return std::bit_cast<Rep>(detail::nan_payload<Rep>::value); }
+  [[nodiscard]] static constexpr bool is_empty(const Rep& v) noexcept
+  {
+    return std::bit_cast<typename detail::nan_payload<Rep>::bits_type>(v) == detail::nan_payload<Rep>::value;
+  }
+};
+
+template<typename T, typename Rep>
+concept optional_quantity_traits_for_ = // exposition only
+  requires(const Rep& v) {
+    { T::empty() } -> std::same_as<Rep>;
+    { T::is_empty(v) } -> std::same_as<bool>;
+  };
+
+template<Quantity Q, optional_quantity_traits_for_<typename Q::rep> Traits = optional_quantity_traits<typename Q::rep>>
+class optional_quantity;
+
+namespace detail {
+
+template<typename T>
+struct optional_for {
+  using type = std::optional<T>;
+};
+
+template<Quantity Q>
+  requires optional_quantity_traits_for_<optional_quantity_traits<typename Q::rep>, typename Q::rep>
+struct optional_for<Q> {
+  using type = optional_quantity<Q>;
+};
+
+}  // namespace detail
+
+/**
+ * @brief A compact optional quantity
+ *
+ * Provides the interface of @c std::optional<Q> but, instead of storing an additional
+ * engaged flag, reserves one value of the representation type to mark an empty state.
+ * Thanks to that @c sizeof(optional_quantity<Q>) == sizeof(Q) which makes it a good fit
+ * for large columns of sparse data.
+ *
+ * @note Storing a value equal to the reserved empty value is a precondition violation.
+ *
+ * @tparam Q a quantity type to store
+ * @tparam Traits a type describing how an empty state is encoded in @c Q::rep
+ */
+template<Quantity Q, optional_quantity_traits_for_<typename Q::rep> Traits>
+class optional_quantity {
+  Q value_;
+public:
+  using value_type = Q;
+  using traits_type = Traits;
+
+  // construction, assignment, destruction
+  constexpr optional_quantity() noexcept : value_(Traits::empty()) {}
+  constexpr explicit(false) optional_quantity(std::nullopt_t) noexcept : optional_quantity() {}
+  optional_quantity(const optional_quantity&) = default;
+  optional_quantity(optional_quantity&&) = default;
+
+  template<typename Q2>
+    requires std::constructible_from<Q, const Q2&>
+  constexpr explicit(!std::convertible_to<const Q2&, Q>) optional_quantity(const Q2& q) : value_(q)
+  {
+    gsl_ExpectsAudit(!Traits::is_empty(value_.number()));
+  }
+
+  constexpr explicit(false) optional_quantity(const std::optional<Q>& opt) :
+    optional_quantity(opt ? optional_quantity(*opt) : optional_quantity())
+  {
+  }
+
+  optional_quantity& operator=(const optional_quantity&) = default;
+  optional_quantity& operator=(optional_quantity&&) = default;
+
+  constexpr optional_quantity& operator=(std::nullopt_t) noexcept
+  {
+    reset();
+    return *this;
+  }
+
+  template<typename Q2>
+    requires std::convertible_to<const Q2&, Q>
+  constexpr optional_quantity& operator=(const Q2& q)
+  {
+    emplace(q);
+    return *this;
+  }
+
+  // observers
+  [[nodiscard]] constexpr bool has_value() const noexcept { return !Traits::is_empty(value_.number()); }
+  [[nodiscard]] constexpr explicit operator bool() const noexcept { return has_value(); }
+
+  [[nodiscard]] constexpr const Q* operator->() const noexcept
+  {
+    gsl_ExpectsAudit(has_value());
+    return &value_;
+  }
+
+  [[nodiscard]] constexpr const Q& operator*() const noexcept
+  {
+    gsl_ExpectsAudit(has_value());
+    return value_;
+  }
+
+  [[nodiscard]] constexpr const Q& value() const
+  {
+    if (!has_value()) throw std::bad_optional_access();
+    return value_;
+  }
+
+  template<typename Q2>
+    requires std::convertible_to<Q2, Q>
+  [[nodiscard]] constexpr Q value_or(Q2&& default_value) const
+  {
+    return has_value() ? value_ : static_cast<Q>(std::forward<Q2>(default_value));
+  }
+
+  [[nodiscard]] constexpr explicit operator std::optional<Q>() const
+  {
+    return has_value() ? std::optional<Q>(value_) : std::nullopt;
+  }
+
+  // monadic operations
+  template<typename F>
+    requires std::invocable<F, const Q&>
+  [[nodiscard]] constexpr auto and_then(F&& f) const
+  {
+    using ret = std::remove_cvref_t<std::invoke_result_t<F, const Q&>>;
+    return has_value() ? std::invoke(std::forward<F>(f), value_) : ret();
+  }
+
+  template<typename F>
+    requires std::invocable<F, const Q&>
+  [[nodiscard]] constexpr auto transform(F&& f) const
+  {
+    using ret = TYPENAME detail::optional_for<std::remove_cv_t<std::invoke_result_t<F, const Q&>>>::type;
+    return has_value() ? ret(std::invoke(std::forward<F>(f), value_)) : ret();
+  }
+
+  template<typename F>
+    requires std::invocable<F> && std::convertible_to<std::invoke_result_t<F>, optional_quantity>
+  [[nodiscard]] constexpr optional_quantity or_else(F&& f) const
+  {
+    return has_value() ? *this : optional_quantity(std::invoke(std::forward<F>(f)));
+  }
+
+  // modifiers
+  constexpr void swap(optional_quantity& other) noexcept { std::swap(value_, other.value_); }
+  constexpr void reset() noexcept { value_ = Q(Traits::empty()); }
+
+  template<typename... Args>
+    requires std::constructible_from<Q, Args...>
+  constexpr Q& emplace(Args&&... args)
+  {
+    value_ = Q(std::forward<Args>(args)...);
+    gsl_ExpectsAudit(!Traits::is_empty(value_.number()));
+    return value_;
+  }
+
+  // Hidden Friends
+  // Below friend functions are to be found via argument-dependent lookup only
+  [[nodiscard]] friend constexpr bool operator==(const optional_quantity& lhs, const optional_quantity& rhs)
+  {
+    if (lhs.has_value() != rhs.has_value()) return false;
+    return !lhs.has_value() || lhs.value_ == rhs.value_;
+  }
+
+  [[nodiscard]] friend constexpr bool operator==(const optional_quantity& lhs, std::nullopt_t) noexcept
+  {
+    return !lhs.has_value();
+  }
+
+  [[nodiscard]] friend constexpr bool operator==(const optional_quantity& lhs, const Q& rhs)
+  {
+    return lhs.has_value() && lhs.value_ == rhs;
+  }
+
+  friend constexpr void swap(optional_quantity& lhs, optional_quantity& rhs) noexcept { lhs.swap(rhs); }
+};
+
+// CTAD
+template<Quantity Q>
+optional_quantity(Q) -> optional_quantity<Q>;
+
+}  // namespace units
@@ -0,0 +1,429 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/bits/external/hacks.h>
+#include <units/bits/pow.h>
+#include <units/customization_points.h>
+#include <units/quantity_cast.h>
+#include <units/ratio.h>
+#include <gsl/gsl-lite.hpp>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace units {
+
+/**
+ * @brief An overflow policy of @c overflow_checked throwing @c std::overflow_error
+ */
+struct throw_on_overflow {
+  template<std::integral Int>
+  [[noreturn]] static Int on_overflow(bool /* positive */)
+  {
+    throw std::overflow_error("units::checked: integer overflow");
+  }
+};
+
+/**
+ * @brief An overflow policy of @c overflow_checked clamping the result to the range of the integer type
+ */
+struct saturate_on_overflow {
+  template<std::integral Int>
+  [[nodiscard]] static constexpr Int on_overflow(bool positive) noexcept
+  {
+    return positive ? std::numeric_limits<Int>::max() : std::numeric_limits<Int>::lowest();
+  }
+};
+
+namespace detail {
+
+template<typename T>
+concept integer_ = std::integral<T> && (!std::same_as<std::remove_cv_t<T>, bool>);  // exposition only
+
+}  // namespace detail
+
+template<detail::integer_ Int, typename OverflowPolicy>
+class overflow_checked;
+
+/**
+ * @brief An integral representation type that throws @c std::overflow_error instead of overflowing
+ */
+template<detail::integer_ Int>
+using checked = overflow_checked<Int, throw_on_overflow>;
+
+/**
+ * @brief An integral representation type that clamps values to its range instead of overflowing
+ */
+template<detail::integer_ Int>
+using saturating = overflow_checked<Int, saturate_on_overflow>;
+
+namespace detail {
+
+template<typename T>
+inline constexpr bool is_overflow_checked = false;
+
+template<typename Int, typename OverflowPolicy>
+inline constexpr bool is_overflow_checked<overflow_checked<Int, OverflowPolicy>> = true;
+
+// The compiler builtins detect an overflow with a flag set by the arithmetic instruction itself,
+// which is much cheaper than checking the ranges of the arguments up front.
+template<integer_ Int>
+[[nodiscard]] constexpr bool add_overflow(Int a, Int b, Int& result) noexcept
+{
+#if UNITS_COMP_MSVC
+  constexpr Int min = std::numeric_limits<Int>::lowest();
+  constexpr Int max = std::numeric_limits<Int>::max();
+  if (b > 0 ? a > max - b : a < min - b) return true;
+  result = static_cast<Int>(a + b);
+  return false;
+#else
+  return __builtin_add_overflow(a, b, &result);
+#endif
+}
+
+template<integer_ Int>
+[[nodiscard]] constexpr bool sub_overflow(Int a, Int b, Int& result) noexcept
+{
+#if UNITS_COMP_MSVC
+  constexpr Int min = std::numeric_limits<Int>::lowest();
+  constexpr Int max = std::numeric_limits<Int>::max();
+  if (b > 0 ? a < min + b : a > max + b) return true;
+  result = static_cast<Int>(a - b);
+  return false;
+#else
+  return __builtin_sub_overflow(a, b, &result);
+#endif
+}
+
+template<integer_ Int>
+[[nodiscard]] constexpr bool mul_overflow(Int a, Int b, Int& result) noexcept
+{
+#if UNITS_COMP_MSVC
+  constexpr Int min = std::numeric_limits<Int>::lowest();
+  constexpr Int max = std::numeric_limits<Int>::max();
+  if (a != 0 && b != 0) {
+    if constexpr (std::is_signed_v<Int>) {
+      if (a > 0 ? (b > 0 ? a > max / b : b < min / a) : (b > 0 ? a < min / b : a < max / b)) return true;
+    }
+    else {
+      if (a > max / b) return true;
+    }
+  }
+  result = static_cast<Int>(a * b);
+  return false;
+#else
+  return __builtin_mul_overflow(a, b, &result);
+#endif
+}
+
+}  // namespace detail
+
+/**
+ * @brief An integral number that detects overflows
+ *
+ * All the arithmetic operations and conversions are checked for overflow. In case it happens
+ * the result is provided by @c OverflowPolicy (i.e. @c checked<Int> throws an exception while
+ * @c saturating<Int> clamps the value to the range of @c Int).
+ *
+ * When used as a representation type of a quantity, unit conversions are checked too. Checks of
+ * conversions for which the scaled range of the source integer type provably fits in the target
+ * one are removed at compile-time.
+ *
+ * @tparam Int an integral type used for storage
+ * @tparam OverflowPolicy a type providing the result of an overflowing operation
+ */
+template<detail::integer_ Int, typename OverflowPolicy>
+class overflow_checked {
+  Int value_;
+
+  struct raw_tag {};
+  constexpr overflow_checked(raw_tag, Int v) noexcept : value_(v) {}
+
+  [[nodiscard]] static constexpr overflow_checked overflow(bool positive)
+  {
+    return overflow_checked(raw_tag{}, OverflowPolicy::template on_overflow<Int>(positive));
+  }
+
+  template<detail::integer_ T>
+  [[nodiscard]] static constexpr Int narrow(T v)
+  {
+    if (std::in_range<Int>(v)) return static_cast<Int>(v);
+    return OverflowPolicy::template on_overflow<Int>(std::cmp_greater(v, 0));
+  }
+
+  template<std::floating_point T>
+  [[nodiscard]] static constexpr Int narrow(T v)
+  {
+    // 2^digits and lowest are powers of 2 so they are exactly representable in T
+    constexpr T upper = static_cast<T>(std::numeric_limits<Int>::max() / 2 + 1) * T(2);
+    constexpr T lower = std::is_signed_v<Int> ? static_cast<T>(std::numeric_limits<Int>::lowest()) : T(0);
+    if (v >= lower && v < upper) return static_cast<Int>(v);
+    return OverflowPolicy::template on_overflow<Int>(v > T(0));
+  }
+
+public:
+  using underlying_type = Int;
+  using overflow_policy = OverflowPolicy;
+
+  overflow_checked() = default;
+
+  template<detail::integer_ T>
+  constexpr explicit(false) overflow_checked(T v) : value_(narrow(v)) {}
+
+  template<std::floating_point T>
+  constexpr explicit overflow_checked(T v) : value_(narrow(v)) {}
+
+  template<typename Int2, typename OverflowPolicy2>
+    requires (!std::same_as<overflow_checked<Int2, OverflowPolicy2>, overflow_checked>)
+  constexpr explicit(!(std::same_as<OverflowPolicy2, OverflowPolicy> &&
+                       std::in_range<Int>(std::numeric_limits<Int2>::lowest()) &&
+                       std::in_range<Int>(std::numeric_limits<Int2>::max())))
+  overflow_checked(const overflow_checked<Int2, OverflowPolicy2>& v) : value_(narrow(v.value())) {}
+
+  [[nodiscard]] constexpr Int value() const noexcept { return value_; }
+
+  template<detail::integer_ T>
+  [[nodiscard]] constexpr explicit operator T() const
+  {
+    if (std::in_range<T>(value_)) return static_cast<T>(value_);
+    return OverflowPolicy::template on_overflow<T>(value_ > 0);
+  }
+
+  template<std::floating_point T>
+  [[nodiscard]] constexpr explicit operator T() const noexcept { return static_cast<T>(value_); }
+
+  [[nodiscard]] constexpr overflow_checked operator+() const noexcept { return *this; }
+  [[nodiscard]] constexpr overflow_checked operator-() const
+  {
+    Int result{};
+    if (detail::sub_overflow(Int(0), value_, result)) return overflow(std::cmp_less(value_, 0));
+    return overflow_checked(raw_tag{}, result);
+  }
+
+  constexpr overflow_checked& operator++() { return *this += overflow_checked(raw_tag{}, Int(1)); }
+  constexpr overflow_checked& operator--() { return *this -= overflow_checked(raw_tag{}, Int(1)); }
+  constexpr overflow_checked operator++(int) { const auto v = *this; ++*this; return v; }
+  constexpr overflow_checked operator--(int) { const auto v = *this; --*this; return v; }
+
+  constexpr overflow_checked& operator+=(const overflow_checked& rhs) { return *this = *this + rhs; }
+  constexpr overflow_checked& operator-=(const overflow_checked& rhs) { return *this = *this - rhs; }
+  constexpr overflow_checked& operator*=(const overflow_checked& rhs) { return *this = *this * rhs; }
+  constexpr overflow_checked& operator/=(const overflow_checked& rhs) { return *this = *this / rhs; }
+  constexpr overflow_checked& operator%=(const overflow_checked& rhs) { return *this = *this % rhs; }
+
+  // Hidden Friends
+  // Below friend functions are to be found via argument-dependent lookup only
+  [[nodiscard]] friend constexpr overflow_checked operator+(const overflow_checked& lhs, const overflow_checked& rhs)
+  {
+    Int result{};
+    if (detail::add_overflow(lhs.value_, rhs.value_, result)) return overflow(rhs.value_ > 0);
+    return overflow_checked(raw_tag{}, result);
+  }
+
+  [[nodiscard]] friend constexpr overflow_checked operator-(const overflow_checked& lhs, const overflow_checked& rhs)
+  {
+    Int result{};
+    if (detail::sub_overflow(lhs.value_, rhs.value_, result)) return overflow(std::cmp_less(rhs.value_, 0));
+    return overflow_checked(raw_tag{}, result);
+  }
+
+  [[nodiscard]] friend constexpr overflow_checked operator*(const overflow_checked& lhs, const overflow_checked& rhs)
+  {
+    Int result{};
+    if (detail::mul_overflow(lhs.value_, rhs.value_, result)) return overflow(std::cmp_less(lhs.value_, 0) == std::cmp_less(rhs.value_, 0));
+    return overflow_checked(raw_tag{}, result);
+  }
+
+  [[nodiscard]] friend constexpr overflow_checked operator/(const overflow_checked& lhs, const overflow_checked& rhs)
+  {
+    gsl_ExpectsAudit(rhs.value_ != 0);
+    if constexpr (std::is_signed_v<Int>)
+      if (lhs.value_ == std::numeric_limits<Int>::lowest() && rhs.value_ == -1) return overflow(true);
+    return overflow_checked(raw_tag{}, static_cast<Int>(lhs.value_ / rhs.value_));
+  }
+
+  [[nodiscard]] friend constexpr overflow_checked operator%(const overflow_checked& lhs, const overflow_checked& rhs)
+  {
+    gsl_ExpectsAudit(rhs.value_ != 0);
+    if constexpr (std::is_signed_v<Int>)
+      if (rhs.value_ == -1) return overflow_checked(raw_tag{}, Int(0));
+    return overflow_checked(raw_tag{}, static_cast<Int>(lhs.value_ % rhs.value_));
+  }
+
+  [[nodiscard]] friend constexpr auto operator<=>(const overflow_checked& lhs, const overflow_checked& rhs) = default;
+  [[nodiscard]] friend constexpr bool operator==(const overflow_checked& lhs, const overflow_checked& rhs) = default;
+};
+
+template<typename Int, typename OverflowPolicy>
+struct quantity_values<overflow_checked<Int, OverflowPolicy>> {
+  using rep = overflow_checked<Int, OverflowPolicy>;
+  static constexpr rep zero() noexcept { return rep(Int(0)); }
+  static constexpr rep one() noexcept { return rep(Int(1)); }
+  static constexpr rep min() noexcept { return rep(std::numeric_limits<Int>::lowest()); }
+  static constexpr rep max() noexcept { return rep(std::numeric_limits<Int>::max()); }
+};
+
+namespace detail {
+
+template<typename T>
+struct underlying_number {
+  using type = T;
+};
+
+template<typename Int, typename OverflowPolicy>
+struct underlying_number<overflow_checked<Int, OverflowPolicy>> {
+  using type = Int;
+};
+
+template<typename T>
+[[nodiscard]] constexpr auto underlying_value(const T& v) noexcept
+{
+  if constexpr (is_overflow_checked<T>)
+    return v.value();
+  else
+    return v;
+}
+
+template<typename T>
+struct overflow_policy_of {
+  using type = void;
+};
+
+template<typename Int, typename OverflowPolicy>
+struct overflow_policy_of<overflow_checked<Int, OverflowPolicy>> {
+  using type = OverflowPolicy;
+};
+
+/**
+ * @brief Describes the scaling of an integer of type @c FromInt by a ratio @c R into @c ToInt
+ *
+ * The multiplication by the numerator is done in a common calculation type before the division
+ * by the denominator, the same as in the default @c quantity_cast algorithm. @c always_fits is
+ * @c true when no value of @c FromInt can overflow neither the calculation nor the target type.
+ */
+template<typename FromInt, typename ToInt, ratio R>
+struct integer_scale {
+  using calc = conditional<std::is_unsigned_v<FromInt> && std::is_unsigned_v<ToInt>, std::uintmax_t, std::intmax_t>;
+  static constexpr calc num = static_cast<calc>(R.exp > 0 ? R.num * ipow10(R.exp) : R.num);
+  static constexpr calc den = static_cast<calc>(R.exp < 0 ? R.den * ipow10(-R.exp) : R.den);
+
+  static constexpr bool always_fits = [] {
+    constexpr FromInt lo = std::numeric_limits<FromInt>::lowest();
+    constexpr FromInt hi = std::numeric_limits<FromInt>::max();
+    if constexpr (!std::in_range<calc>(lo) || !std::in_range<calc>(hi)) return false;
+    else if constexpr (static_cast<calc>(hi) > std::numeric_limits<calc>::max() / num ||
+                       static_cast<calc>(lo) < std::numeric_limits<calc>::lowest() / num) return false;
+    else return std::in_range<ToInt>(static_cast<calc>(lo) * num / den) && std::in_range<ToInt>(static_cast<calc>(hi) * num / den);
+  }();
+};
+
+template<typename From, typename To>
+struct overflow_checked_cast_traits {
+  using ratio_type = std::common_type_t<typename underlying_number<From>::type, typename underlying_number<To>::type>;
+  using rep_type = ratio_type;
+};
+
+template<typename From, typename To>
+  requires std::integral<typename underlying_number<From>::type> && std::integral<typename underlying_number<To>::type>
+struct overflow_checked_cast_traits<From, To> {
+  using ratio_type = std::intmax_t;
+  using rep_type = std::intmax_t;
+
+  template<ratio R>
+  [[nodiscard]] static constexpr To scale(const From& v)
+  {
+    using from_int = TYPENAME underlying_number<From>::type;
+    using to_int = TYPENAME underlying_number<To>::type;
+    using policy = conditional<std::is_void_v<typename overflow_policy_of<To>::type>,
+                               typename overflow_policy_of<From>::type, typename overflow_policy_of<To>::type>;
+    using s = integer_scale<from_int, to_int, R>;
+    using calc = TYPENAME s::calc;
+
+    const from_int x = underlying_value(v);
+    if constexpr (s::always_fits) {
+      return To(static_cast<to_int>(static_cast<calc>(x) * s::num / s::den));
+    }
+    else {
+      calc scaled{};
+      if (!std::in_range<calc>(x) || mul_overflow(static_cast<calc>(x), s::num, scaled))
+        return To(policy::template on_overflow<to_int>(x > 0));
+      scaled /= s::den;
+      if (!std::in_range<to_int>(scaled)) return To(policy::template on_overflow<to_int>(scaled > 0));
+      return To(static_cast<to_int>(scaled));
+    }
+  }
+};
+
+template<typename Int, typename OverflowPolicy, typename To>
+struct cast_traits<overflow_checked<Int, OverflowPolicy>, To> :
+    overflow_checked_cast_traits<overflow_checked<Int, OverflowPolicy>, To> {};
+
+template<typename From, typename Int, typename OverflowPolicy>
+struct cast_traits<From, overflow_checked<Int, OverflowPolicy>> :
+    overflow_checked_cast_traits<From, overflow_checked<Int, OverflowPolicy>> {};
+
+template<typename Int1, typename OverflowPolicy1, typename Int2, typename OverflowPolicy2>
+struct cast_traits<overflow_checked<Int1, OverflowPolicy1>, overflow_checked<Int2, OverflowPolicy2>> :
+    overflow_checked_cast_traits<overflow_checked<Int1, OverflowPolicy1>, overflow_checked<Int2, OverflowPolicy2>> {};
+
+}  // namespace detail
+
+}  // namespace units
+
+namespace std {
+
+template<typename Int1, typename Int2, typename OverflowPolicy>
+struct common_type<units::overflow_checked<Int1, OverflowPolicy>, units::overflow_checked<Int2, OverflowPolicy>> {
+  using type = units::overflow_checked<common_type_t<Int1, Int2>, OverflowPolicy>;
+};
+
+template<typename Int, typename OverflowPolicy, typename T>
+  requires is_integral_v<T>
+struct common_type<units::overflow_checked<Int, OverflowPolicy>, T> {
+  using type = units::overflow_checked<common_type_t<Int, T>, OverflowPolicy>;
+};
+
+template<typename T, typename Int, typename OverflowPolicy>
+  requires is_integral_v<T>
+struct common_type<T, units::overflow_checked<Int, OverflowPolicy>> {
+  using type = units::overflow_checked<common_type_t<T, Int>, OverflowPolicy>;
+};
+
+template<typename Int, typename OverflowPolicy, typename T>
+  requires is_floating_point_v<T>
+struct common_type<units::overflow_checked<Int, OverflowPolicy>, T> {
+  using type = T;
+};
+
+template<typename T, typename Int, typename OverflowPolicy>
+  requires is_floating_point_v<T>
+struct common_type<T, units::overflow_checked<Int, OverflowPolicy>> {
+  using type = T;
+};
+
+}  // namespace std
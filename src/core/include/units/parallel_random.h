@@ -0,0 +1,364 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/concepts.h>
+#include <units/quantity.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+
+namespace units {
+
+/**
+ * @brief A counter-based Philox4x32-10 random number engine
+ *
+ * Every block of 4 output words is a bijection of a 128-bit counter under a 64-bit key
+ * (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3", SC'11). The engine has no state
+ * besides the key and the counter, so:
+ * - @c split(stream_id) creates an independent stream in O(1) (i.e. one per thread or per task),
+ * - @c discard(z) jumps ahead in O(1),
+ * - the results do not depend on how the work is distributed among threads.
+ *
+ * The upper 64 bits of the counter select the stream and the lower 64 bits the block within it,
+ * which gives 2^64 streams of 2^66 words each for every seed.
+ *
+ * Satisfies @c std::uniform_random_bit_generator so it can be used with all the distributions.
+ */
+class philox4x32 {
+public:
+  using result_type = std::uint32_t;
+  using block_type = std::array<result_type, 4>;
+
+  static constexpr std::size_t word_size = 32;
+  static constexpr std::size_t rounds = 10;
+  static constexpr std::uint64_t default_seed = 20111115u;
+
+  constexpr philox4x32() noexcept : philox4x32(default_seed) {}
+  constexpr explicit philox4x32(std::uint64_t seed, std::uint64_t stream_id = 0) noexcept :
+      key_{static_cast<result_type>(seed), static_cast<result_type>(seed >> 32)}, stream_(stream_id)
+  {
+  }
+
+  [[nodiscard]] static constexpr result_type min() noexcept { return 0; }
+  [[nodiscard]] static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+  constexpr void seed(std::uint64_t value = default_seed) noexcept { *this = philox4x32(value, stream_); }
+
+  [[nodiscard]] constexpr std::uint64_t stream() const noexcept { return stream_; }
+  [[nodiscard]] constexpr std::uint64_t position() const noexcept { return pos_; }
+
+  /**
+   * @brief Returns an engine generating the @c stream_id stream of the same seed
+   */
+  [[nodiscard]] constexpr philox4x32 split(std::uint64_t stream_id) const noexcept
+  {
+    philox4x32 result(*this);
+    result.stream_ = stream_id;
+    result.pos_ = 0;
+    return result;
+  }
+
+  constexpr result_type operator()() noexcept
+  {
+    if ((pos_ & 3) == 0) buffer_ = block(pos_ >> 2);
+    return buffer_[pos_++ & 3];
+  }
+
+  /**
+   * @brief Advances the engine by @c z words in O(1)
+   */
+  constexpr void discard(unsigned long long z) noexcept
+  {
+    pos_ += z;
+    if ((pos_ & 3) != 0) buffer_ = block(pos_ >> 2);
+  }
+
+  /**
+   * @brief Fills @c out with consecutive words of the stream
+   *
+   * Whole blocks are written directly to the output, which lets the compiler interleave
+   * the computation of independent blocks.
+   */
+  constexpr void fill(std::span<result_type> out) noexcept
+  {
+    std::size_t i = 0;
+    for (; i < out.size() && (pos_ & 3) != 0; ++i) out[i] = (*this)();
+    for (; i + 4 <= out.size(); i += 4) {
+      const block_type b = block(pos_ >> 2);
+      out[i] = b[0];
+      out[i + 1] = b[1];
+      out[i + 2] = b[2];
+      out[i + 3] = b[3];
+      pos_ += 4;
+    }
+    for (; i < out.size(); ++i) out[i] = (*this)();
+  }
+
+  /**
+   * @brief Computes the output block for a counter and a key
+   */
+  [[nodiscard]] static constexpr block_type bijection(block_type ctr, std::array<result_type, 2> key) noexcept
+  {
+    for (std::size_t r = 0; r < rounds; ++r) {
+      if (r != 0) {
+        key[0] += 0x9E3779B9;
+        key[1] += 0xBB67AE85;
+      }
+      const std::uint64_t p0 = std::uint64_t{0xD2511F53} * ctr[0];
+      const std::uint64_t p1 = std::uint64_t{0xCD9E8D57} * ctr[2];
+      ctr = {static_cast<result_type>(p1 >> 32) ^ ctr[1] ^ key[0], static_cast<result_type>(p1),
+             static_cast<result_type>(p0 >> 32) ^ ctr[3] ^ key[1], static_cast<result_type>(p0)};
+    }
+    return ctr;
+  }
+
+  [[nodiscard]] friend constexpr bool operator==(const philox4x32& lhs, const philox4x32& rhs) noexcept
+  {
+    return lhs.key_ == rhs.key_ && lhs.stream_ == rhs.stream_ && lhs.pos_ == rhs.pos_;
+  }
+
+private:
+  std::array<result_type, 2> key_;
+  std::uint64_t stream_;
+  std::uint64_t pos_ = 0;  // in words
+  block_type buffer_{};    // holds the block of pos_ when pos_ is not a multiple of 4
+
+  [[nodiscard]] constexpr block_type block(std::uint64_t index) const noexcept
+  {
+    return bijection({static_cast<result_type>(index), static_cast<result_type>(index >> 32),
+                      static_cast<result_type>(stream_), static_cast<result_type>(stream_ >> 32)}, key_);
+  }
+};
+
+namespace detail {
+
+template<typename G>
+concept full_range_urbg_ = std::uniform_random_bit_generator<G> && (G::min() == 0) &&  // exposition only
+    (G::max() == std::numeric_limits<std::uint32_t>::max() || G::max() == std::numeric_limits<std::uint64_t>::max());
+
+template<full_range_urbg_ G>
+[[nodiscard]] inline std::uint64_t random_bits64(G& g)
+{
+  if constexpr (G::max() == std::numeric_limits<std::uint64_t>::max()) {
+    return static_cast<std::uint64_t>(g());
+  }
+  else {
+    const auto hi = static_cast<std::uint64_t>(g());
+    return (hi << 32) | static_cast<std::uint64_t>(g());
+  }
+}
+
+// uniform on (0, 1) with 53 random bits; never returns 0 so it is safe to take a logarithm of it
+[[nodiscard]] inline double open_uniform(std::uint64_t bits) noexcept
+{
+  return (static_cast<double>(bits >> 11) + 0.5) * 0x1.0p-53;
+}
+
+// Ziggurat tables of Marsaglia & Tsang, "The Ziggurat Method for Generating Random Variables" (2000).
+// A layer is selected with the low bits and a value with the high 32 bits of a 64-bit draw so they
+// are independent of each other.
+struct ziggurat_normal_tables {
+  static constexpr std::size_t layers = 128;
+  static constexpr double r = 3.442619855899;
+  std::array<std::uint32_t, layers> k;
+  std::array<double, layers> w;
+  std::array<double, layers> f;
+
+  ziggurat_normal_tables()
+  {
+    constexpr double m = 0x1.0p31;
+    constexpr double v = 9.91256303526217e-3;
+    double dn = r;
+    double tn = dn;
+    const double q = v / std::exp(-0.5 * dn * dn);
+    k[0] = static_cast<std::uint32_t>((dn / q) * m);
+    k[1] = 0;
+    w[0] = q / m;
+    w[layers - 1] = dn / m;
+    f[0] = 1.0;
+    f[layers - 1] = std::exp(-0.5 * dn * dn);
+    for (std::size_t i = layers - 2; i >= 1; --i) {
+      dn = std::sqrt(-2.0 * std::log(v / dn + std::exp(-0.5 * dn * dn)));
+      k[i + 1] = static_cast<std::uint32_t>((dn / tn) * m);
+      tn = dn;
+      f[i] = std::exp(-0.5 * dn * dn);
+      w[i] = dn / m;
+    }
+  }
+};
+
+struct ziggurat_exponential_tables {
+  static constexpr std::size_t layers = 256;
+  static constexpr double r = 7.697117470131487;
+  std::array<std::uint64_t, layers> k;
+  std::array<double, layers> w;
+  std::array<double, layers> f;
+
+  ziggurat_exponential_tables()
+  {
+    constexpr double m = 0x1.0p32;
+    constexpr double v = 3.949659822581572e-3;
+    double de = r;
+    double te = de;
+    const double q = v / std::exp(-de);
+    k[0] = static_cast<std::uint64_t>((de / q) * m);
+    k[1] = 0;
+    w[0] = q / m;
+    w[layers - 1] = de / m;
+    f[0] = 1.0;
+    f[layers - 1] = std::exp(-de);
+    for (std::size_t i = layers - 2; i >= 1; --i) {
+      de = -std::log(v / de + std::exp(-de));
+      k[i + 1] = static_cast<std::uint64_t>((de / te) * m);
+      te = de;
+      f[i] = std::exp(-de);
+      w[i] = de / m;
+    }
+  }
+};
+
+[[nodiscard]] inline const ziggurat_normal_tables& normal_tables()
+{
+  static const ziggurat_normal_tables tables;
+  return tables;
+}
+
+[[nodiscard]] inline const ziggurat_exponential_tables& exponential_tables()
+{
+  static const ziggurat_exponential_tables tables;
+  return tables;
+}
+
+// a standard normal variate
+template<full_range_urbg_ G>
+[[nodiscard]] double ziggurat_normal(G& g, const ziggurat_normal_tables& t)
+{
+  for (;;) {
+    const std::uint64_t bits = random_bits64(g);
+    const std::size_t i = bits & (ziggurat_normal_tables::layers - 1);
+    const auto hz = static_cast<std::int32_t>(static_cast<std::uint32_t>(bits >> 32));
+    const double x = hz * t.w[i];
+    const std::uint32_t abs_hz = hz < 0 ? 0u - static_cast<std::uint32_t>(hz) : static_cast<std::uint32_t>(hz);
+    if (abs_hz < t.k[i]) return x;  // the fast path taken ~99% of the time
+
+    if (i == 0) {
+      // the tail beyond r
+      double xt = 0;
+      double y = 0;
+      do {
+        xt = -std::log(open_uniform(random_bits64(g))) / ziggurat_normal_tables::r;
+        y = -std::log(open_uniform(random_bits64(g)));
+      } while (y + y < xt * xt);
+      return hz > 0 ? ziggurat_normal_tables::r + xt : -ziggurat_normal_tables::r - xt;
+    }
+    if (t.f[i] + open_uniform(random_bits64(g)) * (t.f[i - 1] - t.f[i]) < std::exp(-0.5 * x * x)) return x;
+  }
+}
+
+// a standard exponential variate
+template<full_range_urbg_ G>
+[[nodiscard]] double ziggurat_exponential(G& g, const ziggurat_exponential_tables& t)
+{
+  for (;;) {
+    const std::uint64_t bits = random_bits64(g);
+    const std::size_t i = bits & (ziggurat_exponential_tables::layers - 1);
+    const std::uint64_t jz = bits >> 32;
+    const double x = static_cast<double>(jz) * t.w[i];
+    if (jz < t.k[i]) return x;  // the fast path taken ~99% of the time
+
+    if (i == 0) return ziggurat_exponential_tables::r - std::log(open_uniform(random_bits64(g)));
+    if (t.f[i] + open_uniform(random_bits64(g)) * (t.f[i - 1] - t.f[i]) < std::exp(-x)) return x;
+  }
+}
+
+template<typename Q>
+concept floating_point_quantity_ = Quantity<Q> && std::floating_point<typename Q::rep>;  // exposition only
+
+}  // namespace detail
+
+/**
+ * @brief Fills @c out with quantities uniformly distributed on [a, b)
+ *
+ * If the engine provides a @c fill(std::span<result_type>) member function (i.e. @c philox4x32),
+ * the random bits are generated in chunks and converted in a separate loop that can be vectorized.
+ */
+template<detail::floating_point_quantity_ Q, detail::full_range_urbg_ G>
+void generate_uniform(G& g, std::span<Q> out, const Q& a, const Q& b)
+{
+  using rep = TYPENAME Q::rep;
+  const double lo = static_cast<double>(a.number());
+  const double width = static_cast<double>(b.number()) - lo;
+  if constexpr (requires(std::span<typename G::result_type> s) { g.fill(s); }) {
+    constexpr std::size_t chunk = 256;
+    constexpr std::size_t words = G::max() == std::numeric_limits<std::uint32_t>::max() ? 2 : 1;
+    std::array<typename G::result_type, chunk * words> bits;
+    for (std::size_t i = 0; i < out.size(); i += chunk) {
+      const std::size_t n = std::min(chunk, out.size() - i);
+      g.fill(std::span(bits).first(n * words));
+      for (std::size_t j = 0; j < n; ++j) {
+        std::uint64_t u = bits[j * words];
+        if constexpr (words == 2) u = (u << 32) | bits[j * words + 1];
+        out[i + j] = Q(static_cast<rep>(lo + width * (static_cast<double>(u >> 11) * 0x1.0p-53)));
+      }
+    }
+  }
+  else {
+    for (Q& q : out) q = Q(static_cast<rep>(lo + width * (static_cast<double>(detail::random_bits64(g) >> 11) * 0x1.0p-53)));
+  }
+}
+
+/**
+ * @brief Fills @c out with normally distributed quantities using the Ziggurat method
+ */
+template<detail::floating_point_quantity_ Q, detail::full_range_urbg_ G>
+void generate_normal(G& g, std::span<Q> out, const Q& mean, const Q& stddev)
+{
+  using rep = TYPENAME Q::rep;
+  const auto& tables = detail::normal_tables();
+  const double mu = static_cast<double>(mean.number());
+  const double sigma = static_cast<double>(stddev.number());
+  for (Q& q : out) q = Q(static_cast<rep>(mu + sigma * detail::ziggurat_normal(g, tables)));
+}
+
+/**
+ * @brief Fills @c out with exponentially distributed quantities using the Ziggurat method
+ *
+ * @param mean the mean of the distribution (an inverse of the rate parameter)
+ */
+template<detail::floating_point_quantity_ Q, detail::full_range_urbg_ G>
+void generate_exponential(G& g, std::span<Q> out, const Q& mean)
+{
+  using rep = TYPENAME Q::rep;
+  const auto& tables = detail::exponential_tables();
+  const double beta = static_cast<double>(mean.number());
+  for (Q& q : out) q = Q(static_cast<rep>(beta * detail::ziggurat_exponential(g, tables)));
+}
+
+}  // namespace units
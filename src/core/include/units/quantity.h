@@ -27,6 +27,7 @@
 #include <units/generic/dimensionless.h>
 
 // IWYU pragma: begin_exports
+#include <units/fwd.h>
 #include <units/quantity_cast.h>
 #include <units/ratio.h>
 #include <compare>
@@ -103,7 +104,7 @@ using quantity_like_type = quantity<typename quantity_like_traits<Q>::dimension,
  * @tparam U a measurement unit of the quantity
  * @tparam Rep a type to be used to represent values of a quantity
  */
-template<Dimension D, UnitOf<D> U, Representation Rep = double>
+template<Dimension D, UnitOf<D> U, Representation Rep>
 class quantity {
   Rep number_;
 public:
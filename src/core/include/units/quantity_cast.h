@@ -27,6 +27,7 @@
 #include <units/bits/dimension_op.h>
 #include <units/bits/external/type_traits.h>
 #include <units/bits/pow.h>
+#include <units/fwd.h>
 #include <cassert>
 
 #ifdef _MSC_VER
@@ -36,18 +37,6 @@
 
 namespace units {
 
-template<Dimension D, UnitOf<D> U, Representation Rep>
-class quantity;
-
-template<PointOrigin O, UnitOf<typename O::dimension> U, Representation Rep>
-class quantity_point;
-
-template<Kind K, UnitOf<typename K::dimension> U, Representation Rep>
-class quantity_kind;
-
-template<PointKind PK, UnitOf<typename PK::dimension> U, Representation Rep>
-class quantity_point_kind;
-
 namespace detail {
 
 template<typename T>
@@ -77,18 +66,27 @@ inline constexpr ratio cast_ratio = []
   }
 }();
 
+/**
+ * @brief Describes how a value of representation type @c From is converted to @c To
+ *
+ * Besides @c ratio_type and @c rep_type used by the default conversion algorithm, a specialization
+ * may provide a static member function template @c scale<ratio R>(const From&) returning @c To.
+ * If present, it performs the whole conversion (including the multiplication by @c R) in one step.
+ */
 template<typename From, typename To>
 struct cast_traits;
 
 template<typename From, typename To>
-  requires common_type_with_<std::common_type_t<From, To>, std::intmax_t>
+  requires (!is_half_precision<From>) && (!is_half_precision<To>) &&
+           common_type_with_<std::common_type_t<From, To>, std::intmax_t>
 struct cast_traits<From, To> {
   using ratio_type = std::common_type_t<std::common_type_t<From, To>, std::intmax_t>;
   using rep_type = ratio_type;
 };
 
 template<typename From, typename To>
-  requires (!common_type_with_<std::common_type_t<From, To>, std::intmax_t>) &&
+  requires (!is_half_precision<From>) && (!is_half_precision<To>) &&
+          (!common_type_with_<std::common_type_t<From, To>, std::intmax_t>) &&
           scalable_number_<std::common_type_t<From, To>, std::intmax_t> &&
           requires { typename std::common_type_t<From, To>::value_type; } &&
           common_type_with_<typename std::common_type_t<From, To>::value_type, std::intmax_t>
@@ -97,6 +95,17 @@ struct cast_traits<From, To> {
   using rep_type = std::common_type_t<From, To>;
 };
 
+// half-precision values are scaled in at least single precision to not lose the ratio accuracy
+template<typename T>
+using widened_rep = conditional<is_half_precision<T>, float, T>;
+
+template<typename From, typename To>
+  requires is_half_precision<From> || is_half_precision<To>
+struct cast_traits<From, To> {
+  using ratio_type = std::common_type_t<widened_rep<From>, widened_rep<To>>;
+  using rep_type = ratio_type;
+};
+
 }  // namespace detail
 
 /**
@@ -120,7 +129,10 @@ template<Quantity To, typename D, typename U, scalable_with_<typename To::rep> R
   using rep_type = TYPENAME traits::rep_type;
   constexpr auto c_ratio = detail::cast_ratio<quantity<D, U, Rep>, To>;
 
-  if constexpr (treat_as_floating_point<rep_type>) {
+  if constexpr (requires { traits::template scale<c_ratio>(q.number()); }) {
+    return To(static_cast<TYPENAME To::rep>(traits::template scale<c_ratio>(q.number())));
+  }
+  else if constexpr (treat_as_floating_point<rep_type>) {
     return To(static_cast<TYPENAME To::rep>(static_cast<rep_type>(q.number()) *
                               (static_cast<ratio_type>(c_ratio.num) * detail::fpow10<ratio_type>(c_ratio.exp) / static_cast<ratio_type>(c_ratio.den))));
   }
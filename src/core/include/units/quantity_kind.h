@@ -75,7 +75,7 @@ concept QuantityKindRelatedTo = QuantityKind<QK1> && QuantityKind<QK2> &&
  * @tparam U the measurement unit of the quantity kind
  * @tparam Rep the type to be used to represent values of the quantity kind
  */
-template<Kind K, UnitOf<typename K::dimension> U, Representation Rep = double>
+template<Kind K, UnitOf<typename K::dimension> U, Representation Rep>
 class quantity_kind {
 public:
   using kind_type = K;
@@ -56,7 +56,7 @@ struct dynamic_origin : point_origin<D> {
  * @tparam U a measurement unit of the quantity point
  * @tparam Rep a type to be used to represent values of a quantity point
  */
-template<PointOrigin O, UnitOf<typename O::dimension> U, Representation Rep = double>
+template<PointOrigin O, UnitOf<typename O::dimension> U, Representation Rep>
 class quantity_point {
 public:
   using origin = O;
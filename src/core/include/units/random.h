@@ -23,8 +23,14 @@
 #pragma once
 
 #include <units/concepts.h>
-#include <random>
+#include <gsl/gsl-lite.hpp>
+#include <cstddef>
 #include <functional>
+#include <initializer_list>
+#include <random>
+#include <ranges>
+#include <span>
+#include <vector>
 
 namespace units {
 
@@ -38,13 +44,20 @@ namespace detail {
         return intervals_rep;
     }
     
+    struct rep_view_tag {};
+
+    // a view of the numbers of quantities that does not copy them
+    template <Quantity Q>
+    inline auto qty_to_rep_view(std::span<const Q> qty)
+    {
+        return std::views::transform(qty, [](const Q& q) { return q.number(); });
+    }
+
     template <Quantity Q>
-    static std::vector<typename Q::rep> bl_qty_to_rep(std::initializer_list<Q>& bl)
+    inline auto weights_begin(std::span<const Q> intervals, std::span<const typename Q::rep> weights, std::size_t count)
     {
-        std::vector<typename Q::rep> bl_rep;
-        bl_rep.reserve(bl.size());
-        for (const Q& qty : bl) { bl_rep.push_back(qty.number()); }
-        return bl_rep;
+        gsl_Expects(weights.size() >= count || intervals.size() < 2);
+        return weights.begin();
     }
 
     template <Quantity Q, typename UnaryOperation>
@@ -83,6 +96,12 @@ struct uniform_int_distribution : public std::uniform_int_distribution<typename
     
     template<typename Generator>
     Q operator()(Generator& g) { return Q(base::operator()(g)); }
+
+    template<typename Generator>
+    void generate(Generator& g, std::span<Q> out)
+    {
+        for (Q& q : out) { q = Q(base::operator()(g)); }
+    }
     
     Q a() const { return Q(base::a()); }
     Q b() const { return Q(base::b()); }
@@ -103,6 +122,12 @@ struct uniform_real_distribution : public std::uniform_real_distribution<typenam
     
     template<typename Generator>
     Q operator()(Generator& g) { return Q(base::operator()(g)); }
+
+    template<typename Generator>
+    void generate(Generator& g, std::span<Q> out)
+    {
+        for (Q& q : out) { q = Q(base::operator()(g)); }
+    }
     
     Q a() const { return Q(base::a()); }
     Q b() const { return Q(base::b()); }
@@ -123,6 +148,12 @@ struct binomial_distribution : public std::binomial_distribution<typename Q::rep
     
     template<typename Generator>
     Q operator()(Generator& g) { return Q(base::operator()(g)); }
+
+    template<typename Generator>
+    void generate(Generator& g, std::span<Q> out)
+    {
+        for (Q& q : out) { q = Q(base::operator()(g)); }
+    }
     
     Q t() const { return Q(base::t()); }
     
@@ -142,6 +173,12 @@ struct negative_binomial_distribution : public std::negative_binomial_distributi
     
     template<typename Generator>
     Q operator()(Generator& g) { return Q(base::operator()(g)); }
+
+    template<typename Generator>
+    void generate(Generator& g, std::span<Q> out)
+    {
+        for (Q& q : out) { q = Q(base::operator()(g)); }
+    }
     
     Q k() const { return Q(base::k()); }
     
@@ -162,6 +199,12 @@ struct geometric_distribution : public std::geometric_distribution<typename Q::r
     template<typename Generator>
     Q operator()(Generator& g) { return Q(base::operator()(g)); }
 
+    template<typename Generator>
+    void generate(Generator& g, std::span<Q> out)
+    {
+        for (Q& q : out) { q = Q(base::operator()(g)); }
+    }
+
     Q min() const { return Q(base::min()); }
     Q max() const { return Q(base::max()); }
 };
@@ -178,6 +221,12 @@ struct poisson_distribution : public std::poisson_distribution<typename Q::rep>
     
     template<typename Generator>
     Q operator()(Generator& g) { return Q(base::operator()(g)); }
+
+    template<typename Generator>
+    void generate(Generator& g, std::span<Q> out)
+    {
+        for (Q& q : out) { q = Q(base::operator()(g)); }
+    }
     
     Q min() const { return Q(base::min()); }
     Q max() const { return Q(base::max()); }
@@ -195,6 +244,12 @@ struct exponential_distribution : public std::exponential_distribution<typename
     
     template<typename Generator>
     Q operator()(Generator& g) { return Q(base::operator()(g)); }
+
+    template<typename Generator>
+    void generate(Generator& g, std::span<Q> out)
+    {
+        for (Q& q : out) { q = Q(base::operator()(g)); }
+    }
     
     Q min() const { return Q(base::min()); }
     Q max() const { return Q(base::max()); }
@@ -212,6 +267,12 @@ struct gamma_distribution : public std::gamma_distribution<typename Q::rep>
     
     template<typename Generator>
     Q operator()(Generator& g) { return Q(base::operator()(g)); }
+
+    template<typename Generator>
+    void generate(Generator& g, std::span<Q> out)
+    {
+        for (Q& q : out) { q = Q(base::operator()(g)); }
+    }
     
     Q min() const { return Q(base::min()); }
     Q max() const { return Q(base::max()); }
@@ -229,6 +290,12 @@ struct weibull_distribution : public std::weibull_distribution<typename Q::rep>
     
     template<typename Generator>
     Q operator()(Generator& g) { return Q(base::operator()(g)); }
+
+    template<typename Generator>
+    void generate(Generator& g, std::span<Q> out)
+    {
+        for (Q& q : out) { q = Q(base::operator()(g)); }
+    }
     
     Q min() const { return Q(base::min()); }
     Q max() const { return Q(base::max()); }
@@ -247,6 +314,12 @@ struct extreme_value_distribution : public std::extreme_value_distribution<typen
     template<typename Generator>
     Q operator()(Generator& g) { return Q(base::operator()(g)); }
 
+    template<typename Generator>
+    void generate(Generator& g, std::span<Q> out)
+    {
+        for (Q& q : out) { q = Q(base::operator()(g)); }
+    }
+
     Q a() const { return Q(base::a()); }
     
     Q min() const { return Q(base::min()); }
@@ -265,6 +338,12 @@ struct normal_distribution : public std::normal_distribution<typename Q::rep>
     
     template<typename Generator>
     Q operator()(Generator& g) { return Q(base::operator()(g)); }
+
+    template<typename Generator>
+    void generate(Generator& g, std::span<Q> out)
+    {
+        for (Q& q : out) { q = Q(base::operator()(g)); }
+    }
     
     Q mean() const { return Q(base::mean()); }
     Q stddev() const { return Q(base::stddev()); }
@@ -285,6 +364,12 @@ struct lognormal_distribution : public std::lognormal_distribution<typename Q::r
     
     template<typename Generator>
     Q operator()(Generator& g) { return Q(base::operator()(g)); }
+
+    template<typename Generator>
+    void generate(Generator& g, std::span<Q> out)
+    {
+        for (Q& q : out) { q = Q(base::operator()(g)); }
+    }
     
     Q m() const { return Q(base::m()); }
     Q s() const { return Q(base::s()); }
@@ -305,6 +390,12 @@ struct chi_squared_distribution : public std::chi_squared_distribution<typename
     
     template<typename Generator>
     Q operator()(Generator& g) { return Q(base::operator()(g)); }
+
+    template<typename Generator>
+    void generate(Generator& g, std::span<Q> out)
+    {
+        for (Q& q : out) { q = Q(base::operator()(g)); }
+    }
     
     Q min() const { return Q(base::min()); }
     Q max() const { return Q(base::max()); }
@@ -322,6 +413,12 @@ struct cauchy_distribution : public std::cauchy_distribution<typename Q::rep>
     
     template<typename Generator>
     Q operator()(Generator& g) { return Q(base::operator()(g)); }
+
+    template<typename Generator>
+    void generate(Generator& g, std::span<Q> out)
+    {
+        for (Q& q : out) { q = Q(base::operator()(g)); }
+    }
     
     Q a() const { return Q(base::a()); }
     Q b() const { return Q(base::b()); }
@@ -342,6 +439,12 @@ struct fisher_f_distribution : public std::fisher_f_distribution<typename Q::rep
     
     template<typename Generator>
     Q operator()(Generator& g) { return Q(base::operator()(g)); }
+
+    template<typename Generator>
+    void generate(Generator& g, std::span<Q> out)
+    {
+        for (Q& q : out) { q = Q(base::operator()(g)); }
+    }
     
     Q min() const { return Q(base::min()); }
     Q max() const { return Q(base::max()); }
@@ -359,6 +462,12 @@ struct student_t_distribution : public std::student_t_distribution<typename Q::r
     
     template<typename Generator>
     Q operator()(Generator& g) { return Q(base::operator()(g)); }
+
+    template<typename Generator>
+    void generate(Generator& g, std::span<Q> out)
+    {
+        for (Q& q : out) { q = Q(base::operator()(g)); }
+    }
     
     Q min() const { return Q(base::min()); }
     Q max() const { return Q(base::max()); }
@@ -384,6 +493,12 @@ struct discrete_distribution : public std::discrete_distribution<typename Q::rep
     
     template<typename Generator>
     Q operator()(Generator& g) { return Q(base::operator()(g)); }
+
+    template<typename Generator>
+    void generate(Generator& g, std::span<Q> out)
+    {
+        for (Q& q : out) { q = Q(base::operator()(g)); }
+    }
     
     Q min() const { return Q(base::min()); }
     Q max() const { return Q(base::max()); }
@@ -399,9 +514,10 @@ class piecewise_constant_distribution : public std::piecewise_constant_distribut
     template <typename InputIt>
     piecewise_constant_distribution(const std::vector<rep>& i, InputIt first_w) :
         base(i.cbegin(), i.cend(), first_w) {}
-    
-    piecewise_constant_distribution(const std::vector<rep>& bl, const std::vector<rep>& weights) :
-        base(bl.cbegin(), bl.cend(), weights.cbegin()) {}
+
+    template <std::ranges::common_range R, typename InputIt>
+    piecewise_constant_distribution(detail::rep_view_tag, const R& i, InputIt first_w) :
+        base(std::ranges::begin(i), std::ranges::end(i), first_w) {}
 
 public:
     piecewise_constant_distribution() : base() {}
@@ -410,9 +526,22 @@ public:
     piecewise_constant_distribution(InputIt1 first_i, InputIt1 last_i, InputIt2 first_w) :
         piecewise_constant_distribution(detail::i_qty_to_rep<Q>(first_i, last_i), first_w) {}
 
+    /**
+     * @brief Constructs a distribution from the boundaries and the weights of its intervals
+     *
+     * Neither the boundaries nor the weights are copied to temporary containers before they are
+     * passed to the underlying standard distribution.
+     *
+     * @param intervals the boundaries of the intervals
+     * @param weights the weights of the intervals (at least @c intervals.size() - 1)
+     */
+    piecewise_constant_distribution(std::span<const Q> intervals, std::span<const rep> weights) :
+        piecewise_constant_distribution(detail::rep_view_tag{}, detail::qty_to_rep_view(intervals),
+            detail::weights_begin(intervals, weights, intervals.size() - 1)) {}
+
     template <typename UnaryOperation>
     piecewise_constant_distribution(std::initializer_list<Q> bl, UnaryOperation fw) :
-        piecewise_constant_distribution(detail::bl_qty_to_rep(bl), detail::fw_bl_pwc(bl, fw)) {}
+        piecewise_constant_distribution(std::span<const Q>(bl.begin(), bl.size()), detail::fw_bl_pwc(bl, fw)) {}
 
     template <typename UnaryOperation>
     piecewise_constant_distribution(std::size_t nw, const Q& xmin, const Q& xmax, UnaryOperation fw) :
@@ -421,6 +550,18 @@ public:
     template<typename Generator>
     Q operator()(Generator& g) { return Q(base::operator()(g)); }
 
+    template<typename Generator>
+    void generate(Generator& g, std::span<Q> out)
+    {
+        for (Q& q : out) { q = Q(base::operator()(g)); }
+    }
+
+    /**
+     * @brief Returns the boundaries of the intervals
+     *
+     * The underlying standard distribution exposes its boundaries only as a @c std::vector<rep>
+     * allocated with the default allocator, so no allocator-aware overload is provided.
+     */
     std::vector<Q> intervals() const
     {
         std::vector<rep> intervals_rep = base::intervals();
@@ -444,9 +585,10 @@ class piecewise_linear_distribution : public std::piecewise_linear_distribution<
     template <typename InputIt>
     piecewise_linear_distribution(const std::vector<rep>& i, InputIt first_w) :
         base(i.cbegin(), i.cend(), first_w) {}
-    
-    piecewise_linear_distribution(const std::vector<rep>& bl, const std::vector<rep>& weights) :
-        base(bl.cbegin(), bl.cend(), weights.cbegin()) {}
+
+    template <std::ranges::common_range R, typename InputIt>
+    piecewise_linear_distribution(detail::rep_view_tag, const R& i, InputIt first_w) :
+        base(std::ranges::begin(i), std::ranges::end(i), first_w) {}
 
 public:
     piecewise_linear_distribution() : base() {}
@@ -455,9 +597,22 @@ public:
     piecewise_linear_distribution(InputIt1 first_i, InputIt1 last_i, InputIt2 first_w) :
         piecewise_linear_distribution(detail::i_qty_to_rep<Q>(first_i, last_i), first_w) {}
 
+    /**
+     * @brief Constructs a distribution from the boundaries and the weights of its intervals
+     *
+     * Neither the boundaries nor the weights are copied to temporary containers before they are
+     * passed to the underlying standard distribution.
+     *
+     * @param intervals the boundaries of the intervals
+     * @param weights the weights of the intervals (at least @c intervals.size())
+     */
+    piecewise_linear_distribution(std::span<const Q> intervals, std::span<const rep> weights) :
+        piecewise_linear_distribution(detail::rep_view_tag{}, detail::qty_to_rep_view(intervals),
+            detail::weights_begin(intervals, weights, intervals.size())) {}
+
     template <typename UnaryOperation>
     piecewise_linear_distribution(std::initializer_list<Q> bl, UnaryOperation fw) :
-        piecewise_linear_distribution(detail::bl_qty_to_rep(bl), detail::fw_bl_pwl(bl, fw)) {}
+        piecewise_linear_distribution(std::span<const Q>(bl.begin(), bl.size()), detail::fw_bl_pwl(bl, fw)) {}
 
     template <typename UnaryOperation>
     piecewise_linear_distribution(std::size_t nw, const Q& xmin, const Q& xmax, UnaryOperation fw) :
@@ -466,6 +621,18 @@ public:
     template<typename Generator>
     Q operator()(Generator& g) { return Q(base::operator()(g)); }
 
+    template<typename Generator>
+    void generate(Generator& g, std::span<Q> out)
+    {
+        for (Q& q : out) { q = Q(base::operator()(g)); }
+    }
+
+    /**
+     * @brief Returns the boundaries of the intervals
+     *
+     * The underlying standard distribution exposes its boundaries only as a @c std::vector<rep>
+     * allocated with the default allocator, so no allocator-aware overload is provided.
+     */
     std::vector<Q> intervals() const
     {
         std::vector<rep> intervals_rep = base::intervals();
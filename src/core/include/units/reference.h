@@ -24,15 +24,10 @@
 
 #include <units/bits/basic_concepts.h>
 #include <units/bits/dimension_op.h>
+#include <units/fwd.h>
 
 namespace units {
 
-template<Dimension D, UnitOf<D> U, Representation Rep>
-class quantity;
-
-template<Dimension D, UnitOf<D> U>
-struct reference;
-
 namespace detail {
 
 template<typename D, typename D1, typename U1, typename D2, typename U2>
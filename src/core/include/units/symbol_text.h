@@ -63,6 +63,8 @@ constexpr void validate_ascii_string([[maybe_unused]] const char (&s)[N + 1]) no
  */
 template<typename StandardCharT, std::size_t N, std::size_t M>
 struct basic_symbol_text {
+  using standard_char_type = StandardCharT;
+
   basic_fixed_string<StandardCharT, N> standard_;
   basic_fixed_string<char, M> ascii_;
 
@@ -160,4 +162,48 @@ template<typename StandardCharT, std::size_t N, std::size_t M>
 basic_symbol_text(const basic_fixed_string<StandardCharT, N>&,
                   const basic_fixed_string<char, M>&) -> basic_symbol_text<StandardCharT, N, M>;
 
+namespace detail {
+
+template<typename T>
+inline constexpr bool is_symbol_text = false;
+
+template<typename StandardCharT, std::size_t N, std::size_t M>
+inline constexpr bool is_symbol_text<basic_symbol_text<StandardCharT, N, M>> = true;
+
+template<typename StandardCharT, std::size_t N, std::size_t M>
+constexpr const basic_symbol_text<StandardCharT, N, M>& to_symbol_text(const basic_symbol_text<StandardCharT, N, M>& txt) noexcept
+{
+  return txt;
+}
+
+template<std::size_t N>
+constexpr basic_symbol_text<char, N, N> to_symbol_text(const basic_fixed_string<char, N>& txt) noexcept
+{
+  return basic_symbol_text<char, N, N>(txt);
+}
+
+template<typename StandardCharT, std::size_t... Ns, std::size_t... Ms>
+constexpr basic_symbol_text<StandardCharT, (Ns + ...), (Ms + ...)> concat_symbol_text(
+    const basic_symbol_text<StandardCharT, Ns, Ms>&... txts) noexcept
+{
+  return basic_symbol_text<StandardCharT, (Ns + ...), (Ms + ...)>(concat(txts.standard()...), concat(txts.ascii()...));
+}
+
+}  // namespace detail
+
+/**
+ * @brief Concatenates symbol texts and fixed strings
+ *
+ * Fixed strings are used for both the Unicode and the ASCII-only versions of the result.
+ * Each of the versions is written into a single preallocated buffer.
+ *
+ * @param txts symbol texts and fixed strings to concatenate (at least one symbol text is required)
+ */
+template<typename... Ts>
+  requires (... || detail::is_symbol_text<Ts>)
+[[nodiscard]] constexpr auto concat(const Ts&... txts) noexcept
+{
+  return detail::concat_symbol_text(detail::to_symbol_text(txts)...);
+}
+
 }  // namespace units
@@ -235,3 +235,5 @@ struct prefixed_alias_unit : U {
 struct unknown_coherent_unit : unit<unknown_coherent_unit> {};
 
 }  // namespace units
+
+UNITS_DOWNCAST_REGISTER(units::unknown_coherent_unit);
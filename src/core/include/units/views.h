@@ -0,0 +1,120 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/concepts.h>
+#include <units/quantity.h>
+#include <units/quantity_cast.h>
+#include <concepts>
+#include <ranges>
+#include <utility>
+
+namespace units {
+
+namespace detail {
+
+template<typename F>
+struct quantity_view_fn_ {
+  template<std::ranges::viewable_range R>
+    requires std::regular_invocable<const F&, std::ranges::range_reference_t<R>>
+  [[nodiscard]] constexpr auto operator()(R&& r) const
+  {
+    return std::views::transform(std::forward<R>(r), F{});
+  }
+
+  template<std::ranges::viewable_range R>
+    requires std::regular_invocable<const F&, std::ranges::range_reference_t<R>>
+  [[nodiscard]] friend constexpr auto operator|(R&& r, const quantity_view_fn_& fn)
+  {
+    return fn(std::forward<R>(r));
+  }
+};
+
+template<Unit ToU>
+struct as_unit_op_ {
+  template<Quantity Q>
+    requires UnitOf<ToU, typename Q::dimension>
+  [[nodiscard]] constexpr Quantity auto operator()(const Q& q) const
+  {
+    return quantity_cast<ToU>(q);
+  }
+};
+
+template<Representation ToRep>
+struct as_rep_op_ {
+  template<Quantity Q>
+    requires requires(const Q& q) { quantity_cast<ToRep>(q); }
+  [[nodiscard]] constexpr Quantity auto operator()(const Q& q) const
+  {
+    return quantity_cast<ToRep>(q);
+  }
+};
+
+struct numbers_op_ {
+  template<Quantity Q>
+  [[nodiscard]] constexpr TYPENAME Q::rep operator()(const Q& q) const
+  {
+    return q.number();
+  }
+};
+
+}  // namespace detail
+
+namespace views {
+
+/**
+ * @brief A range adaptor converting quantities to the unit @c ToU
+ *
+ * The resulting view is lazy: every element is converted with @c quantity_cast<ToU> when dereferenced,
+ * so no temporary container is allocated. The conversion ratio is folded at compile time and the view
+ * preserves the random access and sized properties of the underlying range, which allows consuming it
+ * with i.e. @c std::ranges::copy or @c std::ranges::transform in a vectorizable loop.
+ *
+ * auto m = km_values | units::views::as_unit<units::isq::si::metre>;
+ *
+ * @tparam ToU a unit to convert the quantities to
+ */
+template<Unit ToU>
+inline constexpr detail::quantity_view_fn_<detail::as_unit_op_<ToU>> as_unit{};
+
+/**
+ * @brief A range adaptor converting quantities to the representation type @c ToRep
+ *
+ * Like @c as_unit but the elements are converted with @c quantity_cast<ToRep>.
+ *
+ * @tparam ToRep a representation type to convert the quantities to
+ */
+template<Representation ToRep>
+inline constexpr detail::quantity_view_fn_<detail::as_rep_op_<ToRep>> as_rep{};
+
+/**
+ * @brief A range adaptor returning the numbers of quantities in their current units
+ *
+ * Useful to pass a range of quantities to an API expecting raw numbers, i.e.
+ * @c values | units::views::as_unit<units::isq::si::metre> | units::views::numbers.
+ */
+inline constexpr detail::quantity_view_fn_<detail::numbers_op_> numbers{};
+
+}  // namespace views
+
+}  // namespace units
@@ -0,0 +1,95 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// IWYU pragma: begin_exports
+#include <units/format.h>
+#include <units/generic/dimensionless.h>
+#include <units/isq/si/acceleration.h>
+#include <units/isq/si/area.h>
+#include <units/isq/si/electric_current.h>
+#include <units/isq/si/energy.h>
+#include <units/isq/si/force.h>
+#include <units/isq/si/frequency.h>
+#include <units/isq/si/length.h>
+#include <units/isq/si/mass.h>
+#include <units/isq/si/power.h>
+#include <units/isq/si/pressure.h>
+#include <units/isq/si/speed.h>
+#include <units/isq/si/thermodynamic_temperature.h>
+#include <units/isq/si/time.h>
+#include <units/isq/si/voltage.h>
+#include <units/isq/si/volume.h>
+#include <units/quantity_io.h>
+// IWYU pragma: end_exports
+
+#include <ostream>
+
+/**
+ * @file
+ * @brief Explicit instantiations of the most common SI quantity types
+ *
+ * Declares (`extern template`) the specializations of the @c double based SI quantities together
+ * with their @c operator<< and @c fmt::formatter. The definitions are compiled once into the
+ * `mp-units::instantiations` library (`UNITS_BUILD_INSTANTIATIONS` CMake option), so a translation
+ * unit including this header does not generate them again.
+ *
+ * The arithmetic operators and @c quantity_cast() are not covered. They have deduced return types
+ * and an explicit instantiation declaration does not prevent the instantiation of such a function
+ * that is needed to deduce its type ([dcl.spec.auto]). Comparisons and scaling by a number are
+ * provided by the hidden friends of @c quantity, which are not templates.
+ */
+
+#ifndef UNITS_INSTANTIATION
+#define UNITS_INSTANTIATION extern template
+#endif
+
+#define UNITS_INSTANTIATE_QUANTITY(D, U)                                                                     \
+  UNITS_INSTANTIATION class units::quantity<D, U, double>;                                                   \
+  UNITS_INSTANTIATION std::ostream& units::operator<<(std::ostream&, const units::quantity<D, U, double>&);  \
+  UNITS_INSTANTIATION struct fmt::formatter<units::quantity<D, U, double>>;                                 \
+  UNITS_INSTANTIATION fmt::format_context::iterator fmt::formatter<units::quantity<D, U, double>>::format(   \
+    const units::quantity<D, U, double>&, fmt::format_context&)
+
+UNITS_INSTANTIATE_QUANTITY(units::dim_one, units::one);
+UNITS_INSTANTIATE_QUANTITY(units::isq::si::dim_length, units::isq::si::metre);
+UNITS_INSTANTIATE_QUANTITY(units::isq::si::dim_length, units::isq::si::kilometre);
+UNITS_INSTANTIATE_QUANTITY(units::isq::si::dim_time, units::isq::si::second);
+UNITS_INSTANTIATE_QUANTITY(units::isq::si::dim_time, units::isq::si::hour);
+UNITS_INSTANTIATE_QUANTITY(units::isq::si::dim_mass, units::isq::si::kilogram);
+UNITS_INSTANTIATE_QUANTITY(units::isq::si::dim_thermodynamic_temperature, units::isq::si::kelvin);
+UNITS_INSTANTIATE_QUANTITY(units::isq::si::dim_electric_current, units::isq::si::ampere);
+UNITS_INSTANTIATE_QUANTITY(units::isq::si::dim_area, units::isq::si::square_metre);
+UNITS_INSTANTIATE_QUANTITY(units::isq::si::dim_volume, units::isq::si::cubic_metre);
+UNITS_INSTANTIATE_QUANTITY(units::isq::si::dim_frequency, units::isq::si::hertz);
+UNITS_INSTANTIATE_QUANTITY(units::isq::si::dim_speed, units::isq::si::metre_per_second);
+UNITS_INSTANTIATE_QUANTITY(units::isq::si::dim_speed, units::isq::si::kilometre_per_hour);
+UNITS_INSTANTIATE_QUANTITY(units::isq::si::dim_acceleration, units::isq::si::metre_per_second_sq);
+UNITS_INSTANTIATE_QUANTITY(units::isq::si::dim_force, units::isq::si::newton);
+UNITS_INSTANTIATE_QUANTITY(units::isq::si::dim_pressure, units::isq::si::pascal);
+UNITS_INSTANTIATE_QUANTITY(units::isq::si::dim_energy, units::isq::si::joule);
+UNITS_INSTANTIATE_QUANTITY(units::isq::si::dim_power, units::isq::si::watt);
+UNITS_INSTANTIATE_QUANTITY(units::isq::si::dim_voltage, units::isq::si::volt);
+
+#undef UNITS_INSTANTIATE_QUANTITY
+#undef UNITS_INSTANTIATION
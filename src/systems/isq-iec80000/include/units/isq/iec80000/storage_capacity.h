@@ -179,6 +179,36 @@ using namespace storage_capacity_references;
 
 }  // namespace units::isq::iec80000
 
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::bit);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::kilobit);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::megabit);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::gigabit);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::terabit);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::petabit);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::exabit);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::zettabit);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::yottabit);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::kibibit);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::mebibit);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::gibibit);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::tebibit);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::pebibit);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::exbibit);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::byte);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::kilobyte);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::megabyte);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::gigabyte);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::terabyte);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::petabyte);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::exabyte);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::zettabyte);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::yottabyte);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::kibibyte);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::mebibyte);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::gibibyte);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::tebibyte);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::pebibyte);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::iec80000::inline storage_capacity {
@@ -71,6 +71,8 @@ using namespace traffic_intensity_references;
 
 }  // namespace units::isq::iec80000
 
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::erlang);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::iec80000::inline traffic_intensity {
@@ -72,6 +72,17 @@ constexpr auto operator"" _q_YB_per_s(unsigned long long l) { gsl_ExpectsAudit(s
 
 }  // namespace units::isq::iec80000
 
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::byte_per_second);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::dim_transfer_rate);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::kilobyte_per_second);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::megabyte_per_second);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::gigabyte_per_second);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::terabyte_per_second);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::petabyte_per_second);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::exabyte_per_second);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::zettabyte_per_second);
+UNITS_DOWNCAST_REGISTER(units::isq::iec80000::yottabyte_per_second);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::iec80000::inline transfer_rate {
@@ -0,0 +1,333 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+module;
+
+#include <units/isq/iec80000/iec80000.h>
+
+export module mp_units.systems.iec80000;
+
+export import mp_units.systems.si;
+
+export namespace units::isq::iec80000 {
+
+using units::isq::iec80000::binary_prefix;
+using units::isq::iec80000::kibi;
+using units::isq::iec80000::mebi;
+using units::isq::iec80000::gibi;
+using units::isq::iec80000::tebi;
+using units::isq::iec80000::pebi;
+using units::isq::iec80000::exbi;
+using units::isq::iec80000::baud;
+using units::isq::iec80000::kilobaud;
+using units::isq::iec80000::megabaud;
+using units::isq::iec80000::gigabaud;
+using units::isq::iec80000::terabaud;
+using units::isq::iec80000::petabaud;
+using units::isq::iec80000::exabaud;
+using units::isq::iec80000::zettabaud;
+using units::isq::iec80000::yottabaud;
+using units::isq::iec80000::dim_modulation_rate;
+using units::isq::iec80000::modulation_rate;
+using units::isq::iec80000::bit;
+using units::isq::iec80000::kilobit;
+using units::isq::iec80000::megabit;
+using units::isq::iec80000::gigabit;
+using units::isq::iec80000::terabit;
+using units::isq::iec80000::petabit;
+using units::isq::iec80000::exabit;
+using units::isq::iec80000::zettabit;
+using units::isq::iec80000::yottabit;
+using units::isq::iec80000::binary_prefix_bit;
+using units::isq::iec80000::kibibit;
+using units::isq::iec80000::mebibit;
+using units::isq::iec80000::gibibit;
+using units::isq::iec80000::tebibit;
+using units::isq::iec80000::pebibit;
+using units::isq::iec80000::exbibit;
+using units::isq::iec80000::byte;
+using units::isq::iec80000::kilobyte;
+using units::isq::iec80000::megabyte;
+using units::isq::iec80000::gigabyte;
+using units::isq::iec80000::terabyte;
+using units::isq::iec80000::petabyte;
+using units::isq::iec80000::exabyte;
+using units::isq::iec80000::zettabyte;
+using units::isq::iec80000::yottabyte;
+using units::isq::iec80000::binary_prefix_byte;
+using units::isq::iec80000::kibibyte;
+using units::isq::iec80000::mebibyte;
+using units::isq::iec80000::gibibyte;
+using units::isq::iec80000::tebibyte;
+using units::isq::iec80000::pebibyte;
+using units::isq::iec80000::dim_storage_capacity;
+using units::isq::iec80000::StorageCapacity;
+using units::isq::iec80000::storage_capacity;
+using units::isq::iec80000::erlang;
+using units::isq::iec80000::dim_traffic_intensity;
+using units::isq::iec80000::TrafficIntensity;
+using units::isq::iec80000::traffic_intensity;
+using units::isq::iec80000::byte_per_second;
+using units::isq::iec80000::dim_transfer_rate;
+using units::isq::iec80000::kilobyte_per_second;
+using units::isq::iec80000::megabyte_per_second;
+using units::isq::iec80000::gigabyte_per_second;
+using units::isq::iec80000::terabyte_per_second;
+using units::isq::iec80000::petabyte_per_second;
+using units::isq::iec80000::exabyte_per_second;
+using units::isq::iec80000::zettabyte_per_second;
+using units::isq::iec80000::yottabyte_per_second;
+using units::isq::iec80000::TransferRate;
+using units::isq::iec80000::transfer_rate;
+
+}  // namespace units::isq::iec80000
+
+#ifndef UNITS_NO_LITERALS
+
+export namespace units::isq::iec80000::literals {
+
+using units::isq::iec80000::literals::operator""_q_Bd;
+using units::isq::iec80000::literals::operator""_q_kBd;
+using units::isq::iec80000::literals::operator""_q_MBd;
+using units::isq::iec80000::literals::operator""_q_GBd;
+using units::isq::iec80000::literals::operator""_q_TBd;
+using units::isq::iec80000::literals::operator""_q_PBd;
+using units::isq::iec80000::literals::operator""_q_EBd;
+using units::isq::iec80000::literals::operator""_q_ZBd;
+using units::isq::iec80000::literals::operator""_q_YBd;
+using units::isq::iec80000::literals::operator""_q_bit;
+using units::isq::iec80000::literals::operator""_q_kbit;
+using units::isq::iec80000::literals::operator""_q_Mbit;
+using units::isq::iec80000::literals::operator""_q_Gbit;
+using units::isq::iec80000::literals::operator""_q_Tbit;
+using units::isq::iec80000::literals::operator""_q_Pbit;
+using units::isq::iec80000::literals::operator""_q_Ebit;
+using units::isq::iec80000::literals::operator""_q_Zbit;
+using units::isq::iec80000::literals::operator""_q_Ybit;
+using units::isq::iec80000::literals::operator""_q_Kibit;
+using units::isq::iec80000::literals::operator""_q_Mibit;
+using units::isq::iec80000::literals::operator""_q_Gibit;
+using units::isq::iec80000::literals::operator""_q_Tibit;
+using units::isq::iec80000::literals::operator""_q_Pibit;
+using units::isq::iec80000::literals::operator""_q_Eibit;
+using units::isq::iec80000::literals::operator""_q_B;
+using units::isq::iec80000::literals::operator""_q_kB;
+using units::isq::iec80000::literals::operator""_q_MB;
+using units::isq::iec80000::literals::operator""_q_GB;
+using units::isq::iec80000::literals::operator""_q_TB;
+using units::isq::iec80000::literals::operator""_q_PB;
+using units::isq::iec80000::literals::operator""_q_EB;
+using units::isq::iec80000::literals::operator""_q_ZB;
+using units::isq::iec80000::literals::operator""_q_YB;
+using units::isq::iec80000::literals::operator""_q_KiB;
+using units::isq::iec80000::literals::operator""_q_MiB;
+using units::isq::iec80000::literals::operator""_q_GiB;
+using units::isq::iec80000::literals::operator""_q_TiB;
+using units::isq::iec80000::literals::operator""_q_PiB;
+using units::isq::iec80000::literals::operator""_q_E;
+using units::isq::iec80000::literals::operator""_q_B_per_s;
+using units::isq::iec80000::literals::operator""_q_kB_per_s;
+using units::isq::iec80000::literals::operator""_q_MB_per_s;
+using units::isq::iec80000::literals::operator""_q_GB_per_s;
+using units::isq::iec80000::literals::operator""_q_TB_per_s;
+using units::isq::iec80000::literals::operator""_q_PB_per_s;
+using units::isq::iec80000::literals::operator""_q_EB_per_s;
+using units::isq::iec80000::literals::operator""_q_ZB_per_s;
+using units::isq::iec80000::literals::operator""_q_YB_per_s;
+
+}  // namespace units::isq::iec80000::literals
+
+#endif // UNITS_NO_LITERALS
+
+#ifndef UNITS_NO_REFERENCES
+
+export namespace units::isq::iec80000::modulation_rate_references {
+
+using units::isq::iec80000::modulation_rate_references::Bd;
+using units::isq::iec80000::modulation_rate_references::kBd;
+using units::isq::iec80000::modulation_rate_references::MBd;
+using units::isq::iec80000::modulation_rate_references::GBd;
+using units::isq::iec80000::modulation_rate_references::TBd;
+using units::isq::iec80000::modulation_rate_references::PBd;
+using units::isq::iec80000::modulation_rate_references::EBd;
+using units::isq::iec80000::modulation_rate_references::ZBd;
+using units::isq::iec80000::modulation_rate_references::YBd;
+
+}  // namespace units::isq::iec80000::modulation_rate_references
+
+export namespace units::isq::iec80000::storage_capacity_references {
+
+using units::isq::iec80000::storage_capacity_references::bit;
+using units::isq::iec80000::storage_capacity_references::kbit;
+using units::isq::iec80000::storage_capacity_references::Mbit;
+using units::isq::iec80000::storage_capacity_references::Gbit;
+using units::isq::iec80000::storage_capacity_references::Tbit;
+using units::isq::iec80000::storage_capacity_references::Pbit;
+using units::isq::iec80000::storage_capacity_references::Ebit;
+using units::isq::iec80000::storage_capacity_references::Zbit;
+using units::isq::iec80000::storage_capacity_references::Ybit;
+using units::isq::iec80000::storage_capacity_references::Kibit;
+using units::isq::iec80000::storage_capacity_references::Mibit;
+using units::isq::iec80000::storage_capacity_references::Gibit;
+using units::isq::iec80000::storage_capacity_references::Tibit;
+using units::isq::iec80000::storage_capacity_references::Pibit;
+using units::isq::iec80000::storage_capacity_references::Eibit;
+using units::isq::iec80000::storage_capacity_references::B;
+using units::isq::iec80000::storage_capacity_references::kB;
+using units::isq::iec80000::storage_capacity_references::MB;
+using units::isq::iec80000::storage_capacity_references::GB;
+using units::isq::iec80000::storage_capacity_references::TB;
+using units::isq::iec80000::storage_capacity_references::PB;
+using units::isq::iec80000::storage_capacity_references::EB;
+using units::isq::iec80000::storage_capacity_references::ZB;
+using units::isq::iec80000::storage_capacity_references::YB;
+using units::isq::iec80000::storage_capacity_references::KiB;
+using units::isq::iec80000::storage_capacity_references::MiB;
+using units::isq::iec80000::storage_capacity_references::GiB;
+using units::isq::iec80000::storage_capacity_references::TiB;
+using units::isq::iec80000::storage_capacity_references::PiB;
+
+}  // namespace units::isq::iec80000::storage_capacity_references
+
+export namespace units::isq::iec80000::traffic_intensity_references {
+
+using units::isq::iec80000::traffic_intensity_references::E;
+
+}  // namespace units::isq::iec80000::traffic_intensity_references
+
+export namespace units::isq::iec80000::references {
+
+using units::isq::iec80000::references::Bd;
+using units::isq::iec80000::references::kBd;
+using units::isq::iec80000::references::MBd;
+using units::isq::iec80000::references::GBd;
+using units::isq::iec80000::references::TBd;
+using units::isq::iec80000::references::PBd;
+using units::isq::iec80000::references::EBd;
+using units::isq::iec80000::references::ZBd;
+using units::isq::iec80000::references::YBd;
+using units::isq::iec80000::references::bit;
+using units::isq::iec80000::references::kbit;
+using units::isq::iec80000::references::Mbit;
+using units::isq::iec80000::references::Gbit;
+using units::isq::iec80000::references::Tbit;
+using units::isq::iec80000::references::Pbit;
+using units::isq::iec80000::references::Ebit;
+using units::isq::iec80000::references::Zbit;
+using units::isq::iec80000::references::Ybit;
+using units::isq::iec80000::references::Kibit;
+using units::isq::iec80000::references::Mibit;
+using units::isq::iec80000::references::Gibit;
+using units::isq::iec80000::references::Tibit;
+using units::isq::iec80000::references::Pibit;
+using units::isq::iec80000::references::Eibit;
+using units::isq::iec80000::references::B;
+using units::isq::iec80000::references::kB;
+using units::isq::iec80000::references::MB;
+using units::isq::iec80000::references::GB;
+using units::isq::iec80000::references::TB;
+using units::isq::iec80000::references::PB;
+using units::isq::iec80000::references::EB;
+using units::isq::iec80000::references::ZB;
+using units::isq::iec80000::references::YB;
+using units::isq::iec80000::references::KiB;
+using units::isq::iec80000::references::MiB;
+using units::isq::iec80000::references::GiB;
+using units::isq::iec80000::references::TiB;
+using units::isq::iec80000::references::PiB;
+using units::isq::iec80000::references::E;
+
+}  // namespace units::isq::iec80000::references
+
+#endif // UNITS_NO_REFERENCES
+
+#ifndef UNITS_NO_ALIASES
+
+export namespace units::aliases::isq::iec80000::modulation_rate {
+
+using units::aliases::isq::iec80000::modulation_rate::Bd;
+using units::aliases::isq::iec80000::modulation_rate::kBd;
+using units::aliases::isq::iec80000::modulation_rate::MBd;
+using units::aliases::isq::iec80000::modulation_rate::GBd;
+using units::aliases::isq::iec80000::modulation_rate::TBd;
+using units::aliases::isq::iec80000::modulation_rate::PBd;
+using units::aliases::isq::iec80000::modulation_rate::EBd;
+using units::aliases::isq::iec80000::modulation_rate::ZBd;
+using units::aliases::isq::iec80000::modulation_rate::YBd;
+
+}  // namespace units::aliases::isq::iec80000::modulation_rate
+
+export namespace units::aliases::isq::iec80000::storage_capacity {
+
+using units::aliases::isq::iec80000::storage_capacity::bit;
+using units::aliases::isq::iec80000::storage_capacity::kbit;
+using units::aliases::isq::iec80000::storage_capacity::Mbit;
+using units::aliases::isq::iec80000::storage_capacity::Gbit;
+using units::aliases::isq::iec80000::storage_capacity::Tbit;
+using units::aliases::isq::iec80000::storage_capacity::Pbit;
+using units::aliases::isq::iec80000::storage_capacity::Ebit;
+using units::aliases::isq::iec80000::storage_capacity::Zbit;
+using units::aliases::isq::iec80000::storage_capacity::Ybit;
+using units::aliases::isq::iec80000::storage_capacity::Kibit;
+using units::aliases::isq::iec80000::storage_capacity::Mibit;
+using units::aliases::isq::iec80000::storage_capacity::Gibit;
+using units::aliases::isq::iec80000::storage_capacity::Tibit;
+using units::aliases::isq::iec80000::storage_capacity::Pibit;
+using units::aliases::isq::iec80000::storage_capacity::Eibit;
+using units::aliases::isq::iec80000::storage_capacity::B;
+using units::aliases::isq::iec80000::storage_capacity::kB;
+using units::aliases::isq::iec80000::storage_capacity::MB;
+using units::aliases::isq::iec80000::storage_capacity::GB;
+using units::aliases::isq::iec80000::storage_capacity::TB;
+using units::aliases::isq::iec80000::storage_capacity::PB;
+using units::aliases::isq::iec80000::storage_capacity::EB;
+using units::aliases::isq::iec80000::storage_capacity::ZB;
+using units::aliases::isq::iec80000::storage_capacity::YB;
+using units::aliases::isq::iec80000::storage_capacity::KiB;
+using units::aliases::isq::iec80000::storage_capacity::MiB;
+using units::aliases::isq::iec80000::storage_capacity::GiB;
+using units::aliases::isq::iec80000::storage_capacity::TiB;
+using units::aliases::isq::iec80000::storage_capacity::PiB;
+
+}  // namespace units::aliases::isq::iec80000::storage_capacity
+
+export namespace units::aliases::isq::iec80000::traffic_intensity {
+
+using units::aliases::isq::iec80000::traffic_intensity::E;
+
+}  // namespace units::aliases::isq::iec80000::traffic_intensity
+
+export namespace units::aliases::isq::iec80000::transfer_rate {
+
+using units::aliases::isq::iec80000::transfer_rate::B_per_s;
+using units::aliases::isq::iec80000::transfer_rate::kB_per_s;
+using units::aliases::isq::iec80000::transfer_rate::MB_per_s;
+using units::aliases::isq::iec80000::transfer_rate::GB_per_s;
+using units::aliases::isq::iec80000::transfer_rate::TB_per_s;
+using units::aliases::isq::iec80000::transfer_rate::PB_per_s;
+using units::aliases::isq::iec80000::transfer_rate::EB_per_s;
+using units::aliases::isq::iec80000::transfer_rate::ZB_per_s;
+using units::aliases::isq::iec80000::transfer_rate::YB_per_s;
+
+}  // namespace units::aliases::isq::iec80000::transfer_rate
+
+#endif // UNITS_NO_ALIASES
@@ -58,6 +58,8 @@ using namespace energy_references;
 
 }  // namespace units::isq::natural
 
+UNITS_DOWNCAST_REGISTER(units::isq::natural::dim_energy);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::natural::inline energy {
@@ -58,6 +58,8 @@ using namespace force_references;
 
 }  // namespace units::isq::natural
 
+UNITS_DOWNCAST_REGISTER(units::isq::natural::dim_force);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::natural::inline force {
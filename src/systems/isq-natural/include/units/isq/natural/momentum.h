@@ -58,6 +58,8 @@ using namespace momentum_references;
 
 }  // namespace units::isq::natural
 
+UNITS_DOWNCAST_REGISTER(units::isq::natural::dim_momentum);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::natural::inline momentum {
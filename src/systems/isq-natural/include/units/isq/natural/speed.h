@@ -42,3 +42,5 @@ template<UnitOf<dim_speed> U, Representation Rep = double>
 using speed = quantity<dim_speed, U, Rep>;
 
 }  // namespace units::isq::natural
+
+UNITS_DOWNCAST_REGISTER(units::isq::natural::dim_speed);
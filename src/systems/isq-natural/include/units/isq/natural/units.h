@@ -42,3 +42,8 @@ struct square_gigaelectronvolt : named_unit<square_gigaelectronvolt, basic_symbo
 // the maths a lot?
 
 }  // namespace units::isq::natural
+
+UNITS_DOWNCAST_REGISTER(units::isq::natural::electronvolt);
+UNITS_DOWNCAST_REGISTER(units::isq::natural::gigaelectronvolt);
+UNITS_DOWNCAST_REGISTER(units::isq::natural::inverted_gigaelectronvolt);
+UNITS_DOWNCAST_REGISTER(units::isq::natural::square_gigaelectronvolt);
@@ -0,0 +1,153 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+module;
+
+#include <units/isq/natural/natural.h>
+
+export module mp_units.systems.natural;
+
+export import mp_units.systems.isq;
+
+export namespace units::isq::natural {
+
+using units::isq::natural::dim_acceleration;
+using units::isq::natural::acceleration;
+using units::isq::natural::speed_of_light;
+using units::isq::natural::dim_energy;
+using units::isq::natural::energy;
+using units::isq::natural::dim_force;
+using units::isq::natural::force;
+using units::isq::natural::dim_length;
+using units::isq::natural::length;
+using units::isq::natural::dim_mass;
+using units::isq::natural::mass;
+using units::isq::natural::dim_momentum;
+using units::isq::natural::momentum;
+using units::isq::natural::dim_speed;
+using units::isq::natural::speed;
+using units::isq::natural::dim_time;
+using units::isq::natural::time;
+using units::isq::natural::electronvolt;
+using units::isq::natural::gigaelectronvolt;
+using units::isq::natural::inverted_gigaelectronvolt;
+using units::isq::natural::square_gigaelectronvolt;
+
+}  // namespace units::isq::natural
+
+#ifndef UNITS_NO_REFERENCES
+
+export namespace units::isq::natural::acceleration_references {
+
+using units::isq::natural::acceleration_references::GeV;
+
+}  // namespace units::isq::natural::acceleration_references
+
+export namespace units::isq::natural::energy_references {
+
+using units::isq::natural::energy_references::GeV;
+
+}  // namespace units::isq::natural::energy_references
+
+export namespace units::isq::natural::force_references {
+
+using units::isq::natural::force_references::GeV2;
+
+}  // namespace units::isq::natural::force_references
+
+export namespace units::isq::natural::length_references {
+
+using units::isq::natural::length_references::inv_GeV;
+
+}  // namespace units::isq::natural::length_references
+
+export namespace units::isq::natural::mass_references {
+
+using units::isq::natural::mass_references::GeV;
+
+}  // namespace units::isq::natural::mass_references
+
+export namespace units::isq::natural::momentum_references {
+
+using units::isq::natural::momentum_references::GeV;
+
+}  // namespace units::isq::natural::momentum_references
+
+export namespace units::isq::natural::time_references {
+
+using units::isq::natural::time_references::inv_GeV;
+
+}  // namespace units::isq::natural::time_references
+
+export namespace units::isq::natural::references {
+
+using units::isq::natural::references::GeV2;
+
+}  // namespace units::isq::natural::references
+
+#endif // UNITS_NO_REFERENCES
+
+#ifndef UNITS_NO_ALIASES
+
+export namespace units::aliases::isq::natural::acceleration {
+
+using units::aliases::isq::natural::acceleration::GeV;
+
+}  // namespace units::aliases::isq::natural::acceleration
+
+export namespace units::aliases::isq::natural::energy {
+
+using units::aliases::isq::natural::energy::GeV;
+
+}  // namespace units::aliases::isq::natural::energy
+
+export namespace units::aliases::isq::natural::force {
+
+using units::aliases::isq::natural::force::GeV2;
+
+}  // namespace units::aliases::isq::natural::force
+
+export namespace units::aliases::isq::natural::length {
+
+using units::aliases::isq::natural::length::inv_GeV;
+
+}  // namespace units::aliases::isq::natural::length
+
+export namespace units::aliases::isq::natural::mass {
+
+using units::aliases::isq::natural::mass::GeV;
+
+}  // namespace units::aliases::isq::natural::mass
+
+export namespace units::aliases::isq::natural::momentum {
+
+using units::aliases::isq::natural::momentum::GeV;
+
+}  // namespace units::aliases::isq::natural::momentum
+
+export namespace units::aliases::isq::natural::time {
+
+using units::aliases::isq::natural::time::inv_GeV;
+
+}  // namespace units::aliases::isq::natural::time
+
+#endif // UNITS_NO_ALIASES
@@ -0,0 +1,124 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+module;
+
+#include <units/isq/dimensions.h>
+
+export module mp_units.systems.isq;
+
+export import mp_units.core;
+
+export namespace units::isq {
+
+using units::isq::dim_absorbed_dose;
+using units::isq::AbsorbedDose;
+using units::isq::dim_acceleration;
+using units::isq::Acceleration;
+using units::isq::dim_amount_of_substance;
+using units::isq::AmountOfSubstance;
+using units::isq::dim_angular_velocity;
+using units::isq::AngularVelocity;
+using units::isq::dim_area;
+using units::isq::Area;
+using units::isq::dim_capacitance;
+using units::isq::Capacitance;
+using units::isq::dim_catalytic_activity;
+using units::isq::CatalyticActivity;
+using units::isq::dim_charge_density;
+using units::isq::dim_surface_charge_density;
+using units::isq::ChargeDensity;
+using units::isq::SurfaceChargeDensity;
+using units::isq::dim_concentration;
+using units::isq::Concentration;
+using units::isq::dim_conductance;
+using units::isq::Conductance;
+using units::isq::dim_current_density;
+using units::isq::CurrentDensity;
+using units::isq::dim_density;
+using units::isq::Density;
+using units::isq::dim_dynamic_viscosity;
+using units::isq::DynamicViscosity;
+using units::isq::dim_electric_charge;
+using units::isq::ElectricCharge;
+using units::isq::dim_electric_current;
+using units::isq::ElectricCurrent;
+using units::isq::dim_electric_field_strength;
+using units::isq::ElectricFieldStrength;
+using units::isq::dim_energy;
+using units::isq::Energy;
+using units::isq::dim_force;
+using units::isq::Force;
+using units::isq::dim_frequency;
+using units::isq::Frequency;
+using units::isq::dim_heat_capacity;
+using units::isq::dim_specific_heat_capacity;
+using units::isq::dim_molar_heat_capacity;
+using units::isq::HeatCapacity;
+using units::isq::SpecificHeatCapacity;
+using units::isq::MolarHeatCapacity;
+using units::isq::dim_inductance;
+using units::isq::Inductance;
+using units::isq::dim_length;
+using units::isq::Length;
+using units::isq::dim_luminance;
+using units::isq::Luminance;
+using units::isq::dim_luminous_intensity;
+using units::isq::LuminousIntensity;
+using units::isq::dim_magnetic_flux;
+using units::isq::MagneticFlux;
+using units::isq::dim_magnetic_induction;
+using units::isq::MagneticInduction;
+using units::isq::dim_mass;
+using units::isq::Mass;
+using units::isq::dim_molar_energy;
+using units::isq::MolarEnergy;
+using units::isq::dim_momentum;
+using units::isq::Momentum;
+using units::isq::dim_permeability;
+using units::isq::Permeability;
+using units::isq::dim_permittivity;
+using units::isq::Permittivity;
+using units::isq::dim_power;
+using units::isq::Power;
+using units::isq::dim_pressure;
+using units::isq::Pressure;
+using units::isq::dim_resistance;
+using units::isq::Resistance;
+using units::isq::dim_speed;
+using units::isq::Speed;
+using units::isq::dim_surface_tension;
+using units::isq::SurfaceTension;
+using units::isq::dim_thermal_conductivity;
+using units::isq::ThermalConductivity;
+using units::isq::dim_thermodynamic_temperature;
+using units::isq::ThermodynamicTemperature;
+using units::isq::dim_time;
+using units::isq::Time;
+using units::isq::dim_torque;
+using units::isq::Torque;
+using units::isq::dim_voltage;
+using units::isq::Voltage;
+using units::isq::dim_volume;
+using units::isq::Volume;
+
+}  // namespace units::isq
@@ -70,6 +70,9 @@ using namespace acceleration_references;
 
 }  // namespace units::isq::si::cgs
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::cgs::gal);
+UNITS_DOWNCAST_REGISTER(units::isq::si::cgs::dim_acceleration);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::cgs::inline acceleration {
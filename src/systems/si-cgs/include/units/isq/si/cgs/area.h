@@ -72,6 +72,8 @@ using namespace area_references;
 
 }  // namespace units::isq::si::cgs
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::cgs::dim_area);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::cgs::inline area {
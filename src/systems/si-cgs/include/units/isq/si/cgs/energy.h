@@ -72,6 +72,9 @@ using namespace energy_references;
 
 }  // namespace units::isq::si::cgs
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::cgs::erg);
+UNITS_DOWNCAST_REGISTER(units::isq::si::cgs::dim_energy);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::cgs::inline energy {
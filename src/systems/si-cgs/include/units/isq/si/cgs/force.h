@@ -73,6 +73,9 @@ using namespace force_references;
 
 }  // namespace units::isq::si::cgs
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::cgs::dyne);
+UNITS_DOWNCAST_REGISTER(units::isq::si::cgs::dim_force);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::cgs::inline force {
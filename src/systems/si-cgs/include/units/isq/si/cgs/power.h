@@ -55,6 +55,9 @@ constexpr auto operator"" _q_erg_per_s(long double l) { return power<erg_per_sec
 
 }  // namespace units::isq::si::cgs
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::cgs::erg_per_second);
+UNITS_DOWNCAST_REGISTER(units::isq::si::cgs::dim_power);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::cgs::inline power {
@@ -73,6 +73,9 @@ using namespace pressure_references;
 
 }  // namespace units::isq::si::cgs
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::cgs::barye);
+UNITS_DOWNCAST_REGISTER(units::isq::si::cgs::dim_pressure);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::cgs::inline pressure {
@@ -54,6 +54,9 @@ constexpr auto operator"" _q_cm_per_s(long double l) { return speed<centimetre_p
 
 }  // namespace units::isq::si::cgs
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::cgs::centimetre_per_second);
+UNITS_DOWNCAST_REGISTER(units::isq::si::cgs::dim_speed);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::cgs::inline speed {
@@ -0,0 +1,192 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+module;
+
+#include <units/isq/si/cgs/cgs.h>
+
+export module mp_units.systems.si.cgs;
+
+export import mp_units.systems.si;
+
+export namespace units::isq::si::cgs {
+
+using units::isq::si::cgs::gal;
+using units::isq::si::cgs::dim_acceleration;
+using units::isq::si::cgs::acceleration;
+using units::isq::si::cgs::dim_area;
+using units::isq::si::cgs::area;
+using units::isq::si::cgs::erg;
+using units::isq::si::cgs::dim_energy;
+using units::isq::si::cgs::energy;
+using units::isq::si::cgs::dyne;
+using units::isq::si::cgs::dim_force;
+using units::isq::si::cgs::force;
+using units::isq::si::cgs::dim_length;
+using units::isq::si::cgs::length;
+using units::isq::si::cgs::dim_mass;
+using units::isq::si::cgs::mass;
+using units::isq::si::cgs::erg_per_second;
+using units::isq::si::cgs::dim_power;
+using units::isq::si::cgs::power;
+using units::isq::si::cgs::barye;
+using units::isq::si::cgs::dim_pressure;
+using units::isq::si::cgs::pressure;
+using units::isq::si::cgs::centimetre_per_second;
+using units::isq::si::cgs::dim_speed;
+using units::isq::si::cgs::speed;
+
+}  // namespace units::isq::si::cgs
+
+#ifndef UNITS_NO_LITERALS
+
+export namespace units::isq::si::cgs::literals {
+
+using units::isq::si::cgs::literals::operator""_q_Gal;
+using units::isq::si::cgs::literals::operator""_q_cm2;
+using units::isq::si::cgs::literals::operator""_q_erg;
+using units::isq::si::cgs::literals::operator""_q_dyn;
+using units::isq::si::cgs::literals::operator""_q_cm;
+using units::isq::si::cgs::literals::operator""_q_g;
+using units::isq::si::cgs::literals::operator""_q_erg_per_s;
+using units::isq::si::cgs::literals::operator""_q_Ba;
+using units::isq::si::cgs::literals::operator""_q_cm_per_s;
+
+}  // namespace units::isq::si::cgs::literals
+
+#endif // UNITS_NO_LITERALS
+
+#ifndef UNITS_NO_REFERENCES
+
+export namespace units::isq::si::cgs::acceleration_references {
+
+using units::isq::si::cgs::acceleration_references::Gal;
+
+}  // namespace units::isq::si::cgs::acceleration_references
+
+export namespace units::isq::si::cgs::area_references {
+
+using units::isq::si::cgs::area_references::cm2;
+
+}  // namespace units::isq::si::cgs::area_references
+
+export namespace units::isq::si::cgs::energy_references {
+
+using units::isq::si::cgs::energy_references::erg;
+
+}  // namespace units::isq::si::cgs::energy_references
+
+export namespace units::isq::si::cgs::force_references {
+
+using units::isq::si::cgs::force_references::dyn;
+
+}  // namespace units::isq::si::cgs::force_references
+
+export namespace units::isq::si::cgs::length_references {
+
+using units::isq::si::cgs::length_references::cm;
+
+}  // namespace units::isq::si::cgs::length_references
+
+export namespace units::isq::si::cgs::mass_references {
+
+using units::isq::si::cgs::mass_references::g;
+
+}  // namespace units::isq::si::cgs::mass_references
+
+export namespace units::isq::si::cgs::pressure_references {
+
+using units::isq::si::cgs::pressure_references::Ba;
+
+}  // namespace units::isq::si::cgs::pressure_references
+
+export namespace units::isq::si::cgs::references {
+
+using units::isq::si::cgs::references::Gal;
+using units::isq::si::cgs::references::cm2;
+using units::isq::si::cgs::references::erg;
+using units::isq::si::cgs::references::dyn;
+using units::isq::si::cgs::references::cm;
+using units::isq::si::cgs::references::g;
+using units::isq::si::cgs::references::Ba;
+
+}  // namespace units::isq::si::cgs::references
+
+#endif // UNITS_NO_REFERENCES
+
+#ifndef UNITS_NO_ALIASES
+
+export namespace units::aliases::isq::si::cgs::acceleration {
+
+using units::aliases::isq::si::cgs::acceleration::Gal;
+
+}  // namespace units::aliases::isq::si::cgs::acceleration
+
+export namespace units::aliases::isq::si::cgs::area {
+
+using units::aliases::isq::si::cgs::area::cm2;
+
+}  // namespace units::aliases::isq::si::cgs::area
+
+export namespace units::aliases::isq::si::cgs::energy {
+
+using units::aliases::isq::si::cgs::energy::erg;
+
+}  // namespace units::aliases::isq::si::cgs::energy
+
+export namespace units::aliases::isq::si::cgs::force {
+
+using units::aliases::isq::si::cgs::force::dyn;
+
+}  // namespace units::aliases::isq::si::cgs::force
+
+export namespace units::aliases::isq::si::cgs::length {
+
+using units::aliases::isq::si::cgs::length::cm;
+
+}  // namespace units::aliases::isq::si::cgs::length
+
+export namespace units::aliases::isq::si::cgs::mass {
+
+using units::aliases::isq::si::cgs::mass::g;
+
+}  // namespace units::aliases::isq::si::cgs::mass
+
+export namespace units::aliases::isq::si::cgs::power {
+
+using units::aliases::isq::si::cgs::power::erg_per_s;
+
+}  // namespace units::aliases::isq::si::cgs::power
+
+export namespace units::aliases::isq::si::cgs::pressure {
+
+using units::aliases::isq::si::cgs::pressure::Ba;
+
+}  // namespace units::aliases::isq::si::cgs::pressure
+
+export namespace units::aliases::isq::si::cgs::speed {
+
+using units::aliases::isq::si::cgs::speed::cm_per_s;
+
+}  // namespace units::aliases::isq::si::cgs::speed
+
+#endif // UNITS_NO_ALIASES
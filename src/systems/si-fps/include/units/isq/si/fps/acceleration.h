@@ -53,6 +53,9 @@ constexpr auto operator"" _q_ft_per_s2(long double l) { return acceleration<foot
 
 }  // namespace units::isq::si::fps
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::foot_per_second_sq);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::dim_acceleration);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::fps::inline acceleration {
@@ -71,6 +71,9 @@ using namespace area_references;
 
 }  // namespace units::isq::si::fps
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::square_foot);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::dim_area);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::fps::inline area {
@@ -55,6 +55,9 @@ constexpr auto operator"" _q_lb_per_ft3(long double l) { return density<pound_pe
 
 }  // namespace units::isq::si::fps
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::pound_per_foot_cub);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::dim_density);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::fps::inline density {
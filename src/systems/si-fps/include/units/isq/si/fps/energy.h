@@ -40,7 +40,7 @@ struct foot_poundal : unit<foot_poundal> {};
 struct dim_energy : isq::dim_energy<dim_energy, foot_poundal, dim_length, dim_force> {};
 
 // https://en.wikipedia.org/wiki/Foot-pound_(energy)
- struct foot_pound_force : derived_unit<foot_pound_force, dim_energy, foot, pound_force> {};
+struct foot_pound_force : derived_unit<foot_pound_force, dim_energy, foot, pound_force> {};
 
 template<UnitOf<dim_energy> U, Representation Rep = double>
 using energy = quantity<dim_energy, U, Rep>;
@@ -63,6 +63,10 @@ constexpr auto operator"" _q_ft_lbf(long double l) { return energy<foot_pound_fo
 
 }  // namespace units::isq::si::fps
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::foot_poundal);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::dim_energy);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::foot_pound_force);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::fps::inline energy {
@@ -92,6 +92,11 @@ using namespace force_references;
 
 }  // namespace units::isq::si::fps
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::poundal);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::pound_force);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::kilopound_force);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::dim_force);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::fps::inline force {
@@ -129,6 +129,15 @@ using namespace length_references;
 
 }  // namespace units::isq::si::fps
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::foot);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::inch);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::thousandth);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::yard);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::fathom);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::kiloyard);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::mile);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::nautical_mile);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::fps::inline length {
@@ -128,6 +128,16 @@ using namespace mass_references;
 
 }  // namespace units::isq::si::fps
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::pound);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::grain);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::dram);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::ounce);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::stone);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::quarter);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::hundredweight);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::short_ton);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::long_ton);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::fps::inline mass {
@@ -84,6 +84,11 @@ using namespace power_references;
 
 }  // namespace units::isq::si::fps
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::foot_poundal_per_second);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::dim_power);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::foot_pound_force_per_second);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::horse_power);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::fps::inline power {
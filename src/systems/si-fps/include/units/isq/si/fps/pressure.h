@@ -88,6 +88,12 @@ using namespace pressure_references;
 
 }  // namespace units::isq::si::fps
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::poundal_per_foot_sq);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::dim_pressure);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::pound_force_per_foot_sq);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::pound_force_per_inch_sq);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::kilopound_force_per_inch_sq);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::fps::inline pressure {
@@ -84,6 +84,11 @@ using namespace speed_references;
 
 }  // namespace units::isq::si::fps
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::foot_per_second);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::dim_speed);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::mile_per_hour);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::nautical_mile_per_hour);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::fps::inline speed {
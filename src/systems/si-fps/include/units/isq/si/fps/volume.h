@@ -77,6 +77,10 @@ using namespace volume_references;
 
 }  // namespace units::isq::si::fps
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::cubic_foot);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::dim_volume);
+UNITS_DOWNCAST_REGISTER(units::isq::si::fps::cubic_yard);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::fps::inline volume {
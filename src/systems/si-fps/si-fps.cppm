@@ -0,0 +1,346 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+module;
+
+#include <units/isq/si/fps/fps.h>
+
+export module mp_units.systems.si.fps;
+
+export import mp_units.systems.si;
+
+export namespace units::isq::si::fps {
+
+using units::isq::si::fps::foot_per_second_sq;
+using units::isq::si::fps::dim_acceleration;
+using units::isq::si::fps::acceleration;
+using units::isq::si::fps::square_foot;
+using units::isq::si::fps::dim_area;
+using units::isq::si::fps::area;
+using units::isq::si::fps::pound_per_foot_cub;
+using units::isq::si::fps::dim_density;
+using units::isq::si::fps::density;
+using units::isq::si::fps::foot_poundal;
+using units::isq::si::fps::dim_energy;
+using units::isq::si::fps::foot_pound_force;
+using units::isq::si::fps::energy;
+using units::isq::si::fps::poundal;
+using units::isq::si::fps::pound_force;
+using units::isq::si::fps::kilopound_force;
+using units::isq::si::fps::kip;
+using units::isq::si::fps::dim_force;
+using units::isq::si::fps::force;
+using units::isq::si::fps::foot;
+using units::isq::si::fps::inch;
+using units::isq::si::fps::thousandth;
+using units::isq::si::fps::thou;
+using units::isq::si::fps::mil;
+using units::isq::si::fps::yard;
+using units::isq::si::fps::fathom;
+using units::isq::si::fps::kiloyard;
+using units::isq::si::fps::mile;
+using units::isq::si::fps::nautical_mile;
+using units::isq::si::fps::dim_length;
+using units::isq::si::fps::length;
+using units::isq::si::fps::pound;
+using units::isq::si::fps::dim_mass;
+using units::isq::si::fps::mass;
+using units::isq::si::fps::grain;
+using units::isq::si::fps::dram;
+using units::isq::si::fps::ounce;
+using units::isq::si::fps::stone;
+using units::isq::si::fps::quarter;
+using units::isq::si::fps::hundredweight;
+using units::isq::si::fps::short_ton;
+using units::isq::si::fps::long_ton;
+using units::isq::si::fps::foot_poundal_per_second;
+using units::isq::si::fps::dim_power;
+using units::isq::si::fps::foot_pound_force_per_second;
+using units::isq::si::fps::horse_power;
+using units::isq::si::fps::power;
+using units::isq::si::fps::poundal_per_foot_sq;
+using units::isq::si::fps::dim_pressure;
+using units::isq::si::fps::pressure;
+using units::isq::si::fps::pound_force_per_foot_sq;
+using units::isq::si::fps::pound_force_per_inch_sq;
+using units::isq::si::fps::kilopound_force_per_inch_sq;
+using units::isq::si::fps::foot_per_second;
+using units::isq::si::fps::dim_speed;
+using units::isq::si::fps::speed;
+using units::isq::si::fps::mile_per_hour;
+using units::isq::si::fps::nautical_mile_per_hour;
+using units::isq::si::fps::knot;
+using units::isq::si::fps::cubic_foot;
+using units::isq::si::fps::dim_volume;
+using units::isq::si::fps::cubic_yard;
+using units::isq::si::fps::volume;
+
+}  // namespace units::isq::si::fps
+
+#ifndef UNITS_NO_LITERALS
+
+export namespace units::isq::si::fps::literals {
+
+using units::isq::si::fps::literals::operator""_q_ft_per_s2;
+using units::isq::si::fps::literals::operator""_q_ft2;
+using units::isq::si::fps::literals::operator""_q_lb_per_ft3;
+using units::isq::si::fps::literals::operator""_q_ft_pdl;
+using units::isq::si::fps::literals::operator""_q_ft_lbf;
+using units::isq::si::fps::literals::operator""_q_pdl;
+using units::isq::si::fps::literals::operator""_q_lbf;
+using units::isq::si::fps::literals::operator""_q_klbf;
+using units::isq::si::fps::literals::operator""_q_thou;
+using units::isq::si::fps::literals::operator""_q_mil;
+using units::isq::si::fps::literals::operator""_q_in;
+using units::isq::si::fps::literals::operator""_q_ft;
+using units::isq::si::fps::literals::operator""_q_yd;
+using units::isq::si::fps::literals::operator""_q_ftm;
+using units::isq::si::fps::literals::operator""_q_kyd;
+using units::isq::si::fps::literals::operator""_q_mile;
+using units::isq::si::fps::literals::operator""_q_naut_mi;
+using units::isq::si::fps::literals::operator""_q_gr;
+using units::isq::si::fps::literals::operator""_q_dr;
+using units::isq::si::fps::literals::operator""_q_oz;
+using units::isq::si::fps::literals::operator""_q_lb;
+using units::isq::si::fps::literals::operator""_q_st;
+using units::isq::si::fps::literals::operator""_q_qr;
+using units::isq::si::fps::literals::operator""_q_cwt;
+using units::isq::si::fps::literals::operator""_q_ston;
+using units::isq::si::fps::literals::operator""_q_lton;
+using units::isq::si::fps::literals::operator""_q_ft_pdl_per_s;
+using units::isq::si::fps::literals::operator""_q_ft_lbf_per_s;
+using units::isq::si::fps::literals::operator""_q_hp;
+using units::isq::si::fps::literals::operator""_q_pdl_per_ft2;
+using units::isq::si::fps::literals::operator""_q_psi;
+using units::isq::si::fps::literals::operator""_q_kpsi;
+using units::isq::si::fps::literals::operator""_q_ft_per_s;
+using units::isq::si::fps::literals::operator""_q_mph;
+using units::isq::si::fps::literals::operator""_q_knot;
+using units::isq::si::fps::literals::operator""_q_ft3;
+using units::isq::si::fps::literals::operator""_q_yd3;
+
+}  // namespace units::isq::si::fps::literals
+
+#endif // UNITS_NO_LITERALS
+
+#ifndef UNITS_NO_REFERENCES
+
+export namespace units::isq::si::fps::area_references {
+
+using units::isq::si::fps::area_references::ft2;
+
+}  // namespace units::isq::si::fps::area_references
+
+export namespace units::isq::si::fps::force_references {
+
+using units::isq::si::fps::force_references::pdl;
+using units::isq::si::fps::force_references::lbf;
+using units::isq::si::fps::force_references::klbf;
+
+}  // namespace units::isq::si::fps::force_references
+
+export namespace units::isq::si::fps::length_references {
+
+using units::isq::si::fps::length_references::thou;
+using units::isq::si::fps::length_references::mil;
+using units::isq::si::fps::length_references::in;
+using units::isq::si::fps::length_references::ft;
+using units::isq::si::fps::length_references::yd;
+using units::isq::si::fps::length_references::ftm;
+using units::isq::si::fps::length_references::kyd;
+using units::isq::si::fps::length_references::mile;
+using units::isq::si::fps::length_references::naut_mi;
+
+}  // namespace units::isq::si::fps::length_references
+
+export namespace units::isq::si::fps::mass_references {
+
+using units::isq::si::fps::mass_references::gr;
+using units::isq::si::fps::mass_references::dr;
+using units::isq::si::fps::mass_references::oz;
+using units::isq::si::fps::mass_references::lb;
+using units::isq::si::fps::mass_references::st;
+using units::isq::si::fps::mass_references::qr;
+using units::isq::si::fps::mass_references::cwt;
+using units::isq::si::fps::mass_references::ston;
+using units::isq::si::fps::mass_references::lton;
+
+}  // namespace units::isq::si::fps::mass_references
+
+export namespace units::isq::si::fps::power_references {
+
+using units::isq::si::fps::power_references::hp;
+
+}  // namespace units::isq::si::fps::power_references
+
+export namespace units::isq::si::fps::pressure_references {
+
+using units::isq::si::fps::pressure_references::psi;
+using units::isq::si::fps::pressure_references::kpsi;
+
+}  // namespace units::isq::si::fps::pressure_references
+
+export namespace units::isq::si::fps::speed_references {
+
+using units::isq::si::fps::speed_references::mph;
+using units::isq::si::fps::speed_references::knot;
+
+}  // namespace units::isq::si::fps::speed_references
+
+export namespace units::isq::si::fps::volume_references {
+
+using units::isq::si::fps::volume_references::ft3;
+using units::isq::si::fps::volume_references::yd3;
+
+}  // namespace units::isq::si::fps::volume_references
+
+export namespace units::isq::si::fps::references {
+
+using units::isq::si::fps::references::ft2;
+using units::isq::si::fps::references::pdl;
+using units::isq::si::fps::references::lbf;
+using units::isq::si::fps::references::klbf;
+using units::isq::si::fps::references::thou;
+using units::isq::si::fps::references::mil;
+using units::isq::si::fps::references::in;
+using units::isq::si::fps::references::ft;
+using units::isq::si::fps::references::yd;
+using units::isq::si::fps::references::ftm;
+using units::isq::si::fps::references::kyd;
+using units::isq::si::fps::references::mile;
+using units::isq::si::fps::references::naut_mi;
+using units::isq::si::fps::references::gr;
+using units::isq::si::fps::references::dr;
+using units::isq::si::fps::references::oz;
+using units::isq::si::fps::references::lb;
+using units::isq::si::fps::references::st;
+using units::isq::si::fps::references::qr;
+using units::isq::si::fps::references::cwt;
+using units::isq::si::fps::references::ston;
+using units::isq::si::fps::references::lton;
+using units::isq::si::fps::references::hp;
+using units::isq::si::fps::references::psi;
+using units::isq::si::fps::references::kpsi;
+using units::isq::si::fps::references::mph;
+using units::isq::si::fps::references::knot;
+using units::isq::si::fps::references::ft3;
+using units::isq::si::fps::references::yd3;
+
+}  // namespace units::isq::si::fps::references
+
+#endif // UNITS_NO_REFERENCES
+
+#ifndef UNITS_NO_ALIASES
+
+export namespace units::aliases::isq::si::fps::acceleration {
+
+using units::aliases::isq::si::fps::acceleration::ft_per_s2;
+
+}  // namespace units::aliases::isq::si::fps::acceleration
+
+export namespace units::aliases::isq::si::fps::area {
+
+using units::aliases::isq::si::fps::area::ft2;
+
+}  // namespace units::aliases::isq::si::fps::area
+
+export namespace units::aliases::isq::si::fps::density {
+
+using units::aliases::isq::si::fps::density::lb_per_ft3;
+
+}  // namespace units::aliases::isq::si::fps::density
+
+export namespace units::aliases::isq::si::fps::energy {
+
+using units::aliases::isq::si::fps::energy::ft_pdl;
+using units::aliases::isq::si::fps::energy::ft_lbf;
+
+}  // namespace units::aliases::isq::si::fps::energy
+
+export namespace units::aliases::isq::si::fps::force {
+
+using units::aliases::isq::si::fps::force::pdl;
+using units::aliases::isq::si::fps::force::lbf;
+using units::aliases::isq::si::fps::force::klbf;
+
+}  // namespace units::aliases::isq::si::fps::force
+
+export namespace units::aliases::isq::si::fps::length {
+
+using units::aliases::isq::si::fps::length::thou;
+using units::aliases::isq::si::fps::length::mil;
+using units::aliases::isq::si::fps::length::in;
+using units::aliases::isq::si::fps::length::ft;
+using units::aliases::isq::si::fps::length::yd;
+using units::aliases::isq::si::fps::length::ftm;
+using units::aliases::isq::si::fps::length::kyd;
+using units::aliases::isq::si::fps::length::mile;
+using units::aliases::isq::si::fps::length::naut_mi;
+
+}  // namespace units::aliases::isq::si::fps::length
+
+export namespace units::aliases::isq::si::fps::mass {
+
+using units::aliases::isq::si::fps::mass::gr;
+using units::aliases::isq::si::fps::mass::dr;
+using units::aliases::isq::si::fps::mass::oz;
+using units::aliases::isq::si::fps::mass::lb;
+using units::aliases::isq::si::fps::mass::st;
+using units::aliases::isq::si::fps::mass::qr;
+using units::aliases::isq::si::fps::mass::cwt;
+using units::aliases::isq::si::fps::mass::ston;
+using units::aliases::isq::si::fps::mass::lton;
+
+}  // namespace units::aliases::isq::si::fps::mass
+
+export namespace units::aliases::isq::si::fps::power {
+
+using units::aliases::isq::si::fps::power::ft_pdl_per_s;
+using units::aliases::isq::si::fps::power::ft_lbf_per_s;
+using units::aliases::isq::si::fps::power::hp;
+
+}  // namespace units::aliases::isq::si::fps::power
+
+export namespace units::aliases::isq::si::fps::pressure {
+
+using units::aliases::isq::si::fps::pressure::pdl_per_ft2;
+using units::aliases::isq::si::fps::pressure::psi;
+using units::aliases::isq::si::fps::pressure::kpsi;
+
+}  // namespace units::aliases::isq::si::fps::pressure
+
+export namespace units::aliases::isq::si::fps::speed {
+
+using units::aliases::isq::si::fps::speed::ft_per_s;
+using units::aliases::isq::si::fps::speed::mph;
+using units::aliases::isq::si::fps::speed::knot;
+
+}  // namespace units::aliases::isq::si::fps::speed
+
+export namespace units::aliases::isq::si::fps::volume {
+
+using units::aliases::isq::si::fps::volume::ft3;
+using units::aliases::isq::si::fps::volume::yd3;
+
+}  // namespace units::aliases::isq::si::fps::volume
+
+#endif // UNITS_NO_ALIASES
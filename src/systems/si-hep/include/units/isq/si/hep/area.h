@@ -29,6 +29,7 @@
 #include <units/symbol_text.h>
 // IWYU pragma: end_exports
 
+#include <units/isq/si/area.h>
 #include <units/isq/si/length.h>
 #include <units/unit.h>
 
@@ -90,6 +91,16 @@ using namespace area_references;
 
 }  // namespace units::isq::si::hep
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::barn);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::yocto_barn);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::zepto_barn);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::atto_barn);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::femto_barn);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::pico_barn);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::nano_barn);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::micro_barn);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::milli_barn);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::hep::inline area {
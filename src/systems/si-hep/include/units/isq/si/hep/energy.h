@@ -111,6 +111,22 @@ using namespace energy_references;
 
 }  // namespace units::isq::si::hep
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::yeV);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::zeV);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::aeV);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::feV);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::peV);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::neV);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::ueV);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::meV);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::keV);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::MeV);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::TeV);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::PeV);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::EeV);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::ZeV);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::YeV);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::hep::inline energy {
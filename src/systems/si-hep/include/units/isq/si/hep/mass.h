@@ -47,9 +47,9 @@ struct TeV_per_c2 : prefixed_unit<TeV_per_c2, tera, eV_per_c2> {};
 struct PeV_per_c2 : prefixed_unit<PeV_per_c2, peta, eV_per_c2> {};
 struct EeV_per_c2 : prefixed_unit<EeV_per_c2, exa, eV_per_c2> {};
 struct YeV_per_c2 : prefixed_unit<YeV_per_c2, yotta, eV_per_c2> {};
-struct electron_mass : named_scaled_unit<eV_per_c2, "m_e", prefix, ratio(9'109'383'701'528, 1'000'000'000'000, -31), kilogram> {};
-struct proton_mass : named_scaled_unit<eV_per_c2, "m_p", prefix, ratio(1'672'621'923'695, 1'000'000'000'000, -27), kilogram> {};
-struct neutron_mass : named_scaled_unit<eV_per_c2, "m_n", prefix, ratio(1'674'927'498'049, 1'000'000'000'000, -27), kilogram> {};
+struct electron_mass : named_scaled_unit<electron_mass, "m_e", prefix, ratio(9'109'383'701'528, 1'000'000'000'000, -31), kilogram> {};
+struct proton_mass : named_scaled_unit<proton_mass, "m_p", prefix, ratio(1'672'621'923'695, 1'000'000'000'000, -27), kilogram> {};
+struct neutron_mass : named_scaled_unit<neutron_mass, "m_n", prefix, ratio(1'674'927'498'049, 1'000'000'000'000, -27), kilogram> {};
 
 struct dim_mass : isq::dim_mass<eV_per_c2> {};
 
@@ -118,6 +118,23 @@ using namespace mass_references;
 
 }  // namespace units::isq::si::hep
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::eV_per_c2);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::feV_per_c2);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::peV_per_c2);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::neV_per_c2);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::ueV_per_c2);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::meV_per_c2);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::keV_per_c2);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::MeV_per_c2);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::GeV_per_c2);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::TeV_per_c2);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::PeV_per_c2);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::EeV_per_c2);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::YeV_per_c2);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::electron_mass);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::proton_mass);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::neutron_mass);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::hep::inline mass {
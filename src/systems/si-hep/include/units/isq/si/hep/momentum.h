@@ -94,6 +94,21 @@ constexpr auto operator"" _q_YeV_per_c(long double l) { return momentum<YeV_per_
 
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::eV_per_c);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::feV_per_c);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::peV_per_c);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::neV_per_c);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::ueV_per_c);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::meV_per_c);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::keV_per_c);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::MeV_per_c);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::GeV_per_c);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::TeV_per_c);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::PeV_per_c);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::EeV_per_c);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::YeV_per_c);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hep::dim_momentum);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline momentum {
@@ -0,0 +1,229 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+module;
+
+#include <units/isq/si/hep/hep.h>
+
+export module mp_units.systems.si.hep;
+
+export import mp_units.systems.si;
+
+export namespace units::isq::si::hep {
+
+using units::isq::si::hep::barn;
+using units::isq::si::hep::yocto_barn;
+using units::isq::si::hep::zepto_barn;
+using units::isq::si::hep::atto_barn;
+using units::isq::si::hep::femto_barn;
+using units::isq::si::hep::pico_barn;
+using units::isq::si::hep::nano_barn;
+using units::isq::si::hep::micro_barn;
+using units::isq::si::hep::milli_barn;
+using units::isq::si::hep::yeV;
+using units::isq::si::hep::zeV;
+using units::isq::si::hep::aeV;
+using units::isq::si::hep::feV;
+using units::isq::si::hep::peV;
+using units::isq::si::hep::neV;
+using units::isq::si::hep::ueV;
+using units::isq::si::hep::meV;
+using units::isq::si::hep::eV;
+using units::isq::si::hep::keV;
+using units::isq::si::hep::MeV;
+using units::isq::si::hep::GeV;
+using units::isq::si::hep::TeV;
+using units::isq::si::hep::PeV;
+using units::isq::si::hep::EeV;
+using units::isq::si::hep::ZeV;
+using units::isq::si::hep::YeV;
+using units::isq::si::hep::energy;
+using units::isq::si::hep::eV_per_c2;
+using units::isq::si::hep::feV_per_c2;
+using units::isq::si::hep::peV_per_c2;
+using units::isq::si::hep::neV_per_c2;
+using units::isq::si::hep::ueV_per_c2;
+using units::isq::si::hep::meV_per_c2;
+using units::isq::si::hep::keV_per_c2;
+using units::isq::si::hep::MeV_per_c2;
+using units::isq::si::hep::GeV_per_c2;
+using units::isq::si::hep::TeV_per_c2;
+using units::isq::si::hep::PeV_per_c2;
+using units::isq::si::hep::EeV_per_c2;
+using units::isq::si::hep::YeV_per_c2;
+using units::isq::si::hep::electron_mass;
+using units::isq::si::hep::proton_mass;
+using units::isq::si::hep::neutron_mass;
+using units::isq::si::hep::dim_mass;
+using units::isq::si::hep::mass;
+using units::isq::si::hep::eV_per_c;
+using units::isq::si::hep::feV_per_c;
+using units::isq::si::hep::peV_per_c;
+using units::isq::si::hep::neV_per_c;
+using units::isq::si::hep::ueV_per_c;
+using units::isq::si::hep::meV_per_c;
+using units::isq::si::hep::keV_per_c;
+using units::isq::si::hep::MeV_per_c;
+using units::isq::si::hep::GeV_per_c;
+using units::isq::si::hep::TeV_per_c;
+using units::isq::si::hep::PeV_per_c;
+using units::isq::si::hep::EeV_per_c;
+using units::isq::si::hep::YeV_per_c;
+using units::isq::si::hep::dim_momentum;
+using units::isq::si::hep::momentum;
+
+}  // namespace units::isq::si::hep
+
+#ifndef UNITS_NO_LITERALS
+
+export namespace units::isq::si::hep::literals {
+
+using units::isq::si::hep::literals::operator""_q_yb;
+using units::isq::si::hep::literals::operator""_q_zb;
+using units::isq::si::hep::literals::operator""_q_ab;
+using units::isq::si::hep::literals::operator""_q_fb;
+using units::isq::si::hep::literals::operator""_q_pb;
+using units::isq::si::hep::literals::operator""_q_nb;
+using units::isq::si::hep::literals::operator""_q_ub;
+using units::isq::si::hep::literals::operator""_q_mb;
+using units::isq::si::hep::literals::operator""_q_b;
+using units::isq::si::hep::literals::operator""_q_feV;
+using units::isq::si::hep::literals::operator""_q_peV;
+using units::isq::si::hep::literals::operator""_q_neV;
+using units::isq::si::hep::literals::operator""_q_ueV;
+using units::isq::si::hep::literals::operator""_q_meV;
+using units::isq::si::hep::literals::operator""_q_eV;
+using units::isq::si::hep::literals::operator""_q_keV;
+using units::isq::si::hep::literals::operator""_q_MeV;
+using units::isq::si::hep::literals::operator""_q_GeV;
+using units::isq::si::hep::literals::operator""_q_TeV;
+using units::isq::si::hep::literals::operator""_q_PeV;
+using units::isq::si::hep::literals::operator""_q_EeV;
+using units::isq::si::hep::literals::operator""_q_ZeV;
+using units::isq::si::hep::literals::operator""_q_YeV;
+using units::isq::si::hep::literals::operator""_q_feV_per_c2;
+using units::isq::si::hep::literals::operator""_q_peV_per_c2;
+using units::isq::si::hep::literals::operator""_q_neV_per_c2;
+using units::isq::si::hep::literals::operator""_q_ueV_per_c2;
+using units::isq::si::hep::literals::operator""_q_meV_per_c2;
+using units::isq::si::hep::literals::operator""_q_eV_per_c2;
+using units::isq::si::hep::literals::operator""_q_keV_per_c2;
+using units::isq::si::hep::literals::operator""_q_MeV_per_c2;
+using units::isq::si::hep::literals::operator""_q_GeV_per_c2;
+using units::isq::si::hep::literals::operator""_q_TeV_per_c2;
+using units::isq::si::hep::literals::operator""_q_PeV_per_c2;
+using units::isq::si::hep::literals::operator""_q_EeV_per_c2;
+using units::isq::si::hep::literals::operator""_q_YeV_per_c2;
+using units::isq::si::hep::literals::operator""_q_electron_mass;
+using units::isq::si::hep::literals::operator""_q_proton_mass;
+using units::isq::si::hep::literals::operator""_q_neutron_mass;
+using units::isq::si::hep::literals::operator""_q_feV_per_c;
+using units::isq::si::hep::literals::operator""_q_peV_per_c;
+using units::isq::si::hep::literals::operator""_q_neV_per_c;
+using units::isq::si::hep::literals::operator""_q_ueV_per_c;
+using units::isq::si::hep::literals::operator""_q_meV_per_c;
+using units::isq::si::hep::literals::operator""_q_eV_per_c;
+using units::isq::si::hep::literals::operator""_q_keV_per_c;
+using units::isq::si::hep::literals::operator""_q_MeV_per_c;
+using units::isq::si::hep::literals::operator""_q_GeV_per_c;
+using units::isq::si::hep::literals::operator""_q_TeV_per_c;
+using units::isq::si::hep::literals::operator""_q_PeV_per_c;
+using units::isq::si::hep::literals::operator""_q_EeV_per_c;
+using units::isq::si::hep::literals::operator""_q_YeV_per_c;
+
+}  // namespace units::isq::si::hep::literals
+
+#endif // UNITS_NO_LITERALS
+
+#ifndef UNITS_NO_REFERENCES
+
+export namespace units::isq::si::hep::area_references {
+
+using units::isq::si::hep::area_references::barn;
+
+}  // namespace units::isq::si::hep::area_references
+
+export namespace units::isq::si::hep::energy_references {
+
+using units::isq::si::hep::energy_references::eV;
+
+}  // namespace units::isq::si::hep::energy_references
+
+export namespace units::isq::si::hep::mass_references {
+
+using units::isq::si::hep::mass_references::eV_per_c2;
+
+}  // namespace units::isq::si::hep::mass_references
+
+export namespace units::isq::si::hep::references {
+
+using units::isq::si::hep::references::barn;
+using units::isq::si::hep::references::eV;
+using units::isq::si::hep::references::eV_per_c2;
+
+}  // namespace units::isq::si::hep::references
+
+#endif // UNITS_NO_REFERENCES
+
+#ifndef UNITS_NO_ALIASES
+
+export namespace units::aliases::isq::si::hep::area {
+
+using units::aliases::isq::si::hep::area::barn;
+
+}  // namespace units::aliases::isq::si::hep::area
+
+export namespace units::aliases::isq::si::hep::energy {
+
+using units::aliases::isq::si::hep::energy::yeV;
+using units::aliases::isq::si::hep::energy::zeV;
+using units::aliases::isq::si::hep::energy::aeV;
+using units::aliases::isq::si::hep::energy::feV;
+using units::aliases::isq::si::hep::energy::peV;
+using units::aliases::isq::si::hep::energy::neV;
+using units::aliases::isq::si::hep::energy::ueV;
+using units::aliases::isq::si::hep::energy::meV;
+using units::aliases::isq::si::hep::energy::eV;
+using units::aliases::isq::si::hep::energy::keV;
+using units::aliases::isq::si::hep::energy::MeV;
+using units::aliases::isq::si::hep::energy::GeV;
+using units::aliases::isq::si::hep::energy::TeV;
+using units::aliases::isq::si::hep::energy::PeV;
+using units::aliases::isq::si::hep::energy::EeV;
+using units::aliases::isq::si::hep::energy::ZeV;
+using units::aliases::isq::si::hep::energy::YeV;
+
+}  // namespace units::aliases::isq::si::hep::energy
+
+export namespace units::aliases::isq::si::hep::mass {
+
+using units::aliases::isq::si::hep::mass::eV_per_c2g;
+
+}  // namespace units::aliases::isq::si::hep::mass
+
+export namespace units::aliases::isq::si::momentum {
+
+using units::aliases::isq::si::momentum::eV_per_c;
+
+}  // namespace units::aliases::isq::si::momentum
+
+#endif // UNITS_NO_ALIASES
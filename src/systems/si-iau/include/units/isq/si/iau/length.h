@@ -84,6 +84,10 @@ using namespace length_references;
 
 }  // namespace units::isq::si::iau
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::iau::light_year);
+UNITS_DOWNCAST_REGISTER(units::isq::si::iau::parsec);
+UNITS_DOWNCAST_REGISTER(units::isq::si::iau::angstrom);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::iau::inline length {
@@ -0,0 +1,81 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+module;
+
+#include <units/isq/si/iau/iau.h>
+
+export module mp_units.systems.si.iau;
+
+export import mp_units.systems.si;
+
+export namespace units::isq::si::iau {
+
+using units::isq::si::iau::light_year;
+using units::isq::si::iau::parsec;
+using units::isq::si::iau::angstrom;
+
+}  // namespace units::isq::si::iau
+
+#ifndef UNITS_NO_LITERALS
+
+export namespace units::isq::si::iau::literals {
+
+using units::isq::si::iau::literals::operator""_q_ly;
+using units::isq::si::iau::literals::operator""_q_pc;
+using units::isq::si::iau::literals::operator""_q_angstrom;
+
+}  // namespace units::isq::si::iau::literals
+
+#endif // UNITS_NO_LITERALS
+
+#ifndef UNITS_NO_REFERENCES
+
+export namespace units::isq::si::iau::length_references {
+
+using units::isq::si::iau::length_references::ly;
+using units::isq::si::iau::length_references::pc;
+using units::isq::si::iau::length_references::angstrom;
+
+}  // namespace units::isq::si::iau::length_references
+
+export namespace units::isq::si::iau::references {
+
+using units::isq::si::iau::references::ly;
+using units::isq::si::iau::references::pc;
+using units::isq::si::iau::references::angstrom;
+
+}  // namespace units::isq::si::iau::references
+
+#endif // UNITS_NO_REFERENCES
+
+#ifndef UNITS_NO_ALIASES
+
+export namespace units::aliases::isq::si::iau::length {
+
+using units::aliases::isq::si::iau::length::ly;
+using units::aliases::isq::si::iau::length::pc;
+using units::aliases::isq::si::iau::length::angstrom;
+
+}  // namespace units::aliases::isq::si::iau::length
+
+#endif // UNITS_NO_ALIASES
@@ -75,6 +75,9 @@ using namespace length_references;
 
 }  // namespace units::isq::si::imperial
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::imperial::chain);
+UNITS_DOWNCAST_REGISTER(units::isq::si::imperial::rod);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::imperial::inline length {
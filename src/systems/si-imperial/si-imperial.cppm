@@ -0,0 +1,76 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+module;
+
+#include <units/isq/si/imperial/imperial.h>
+
+export module mp_units.systems.si.imperial;
+
+export import mp_units.systems.si.international;
+
+export namespace units::isq::si::imperial {
+
+using units::isq::si::imperial::chain;
+using units::isq::si::imperial::rod;
+
+}  // namespace units::isq::si::imperial
+
+#ifndef UNITS_NO_LITERALS
+
+export namespace units::isq::si::imperial::literals {
+
+using units::isq::si::imperial::literals::operator""_q_ch;
+using units::isq::si::imperial::literals::operator""_q_rd;
+
+}  // namespace units::isq::si::imperial::literals
+
+#endif // UNITS_NO_LITERALS
+
+#ifndef UNITS_NO_REFERENCES
+
+export namespace units::isq::si::imperial::length_references {
+
+using units::isq::si::imperial::length_references::ch;
+using units::isq::si::imperial::length_references::rd;
+
+}  // namespace units::isq::si::imperial::length_references
+
+export namespace units::isq::si::imperial::references {
+
+using units::isq::si::imperial::references::ch;
+using units::isq::si::imperial::references::rd;
+
+}  // namespace units::isq::si::imperial::references
+
+#endif // UNITS_NO_REFERENCES
+
+#ifndef UNITS_NO_ALIASES
+
+export namespace units::aliases::isq::si::imperial::length {
+
+using units::aliases::isq::si::imperial::length::ch;
+using units::aliases::isq::si::imperial::length::rd;
+
+}  // namespace units::aliases::isq::si::imperial::length
+
+#endif // UNITS_NO_ALIASES
@@ -67,6 +67,8 @@ using namespace area_references;
 
 }  // namespace units::isq::si::international
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::international::square_foot);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::international::inline area {
@@ -131,6 +131,14 @@ using namespace length_references;
 
 }  // namespace units::isq::si::international
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::international::yard);
+UNITS_DOWNCAST_REGISTER(units::isq::si::international::foot);
+UNITS_DOWNCAST_REGISTER(units::isq::si::international::fathom);
+UNITS_DOWNCAST_REGISTER(units::isq::si::international::inch);
+UNITS_DOWNCAST_REGISTER(units::isq::si::international::mile);
+UNITS_DOWNCAST_REGISTER(units::isq::si::international::nautical_mile);
+UNITS_DOWNCAST_REGISTER(units::isq::si::international::thou);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::international::inline length {
@@ -50,6 +50,8 @@ constexpr auto operator"" _q_mi_per_h(long double l) { return si::speed<mile_per
 
 }  // namespace units::isq::si::international
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::international::mile_per_hour);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::international::inline speed {
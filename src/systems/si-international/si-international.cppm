@@ -0,0 +1,144 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+module;
+
+#include <units/isq/si/international/international.h>
+
+export module mp_units.systems.si.international;
+
+export import mp_units.systems.si;
+
+export namespace units::isq::si::international {
+
+using units::isq::si::international::square_foot;
+using units::isq::si::international::yard;
+using units::isq::si::international::foot;
+using units::isq::si::international::fathom;
+using units::isq::si::international::inch;
+using units::isq::si::international::mile;
+using units::isq::si::international::nautical_mile;
+using units::isq::si::international::thou;
+using units::isq::si::international::mil;
+using units::isq::si::international::mile_per_hour;
+using units::isq::si::international::cubic_foot;
+
+}  // namespace units::isq::si::international
+
+#ifndef UNITS_NO_LITERALS
+
+export namespace units::isq::si::international::literals {
+
+using units::isq::si::international::literals::operator""_q_ft2;
+using units::isq::si::international::literals::operator""_q_yd;
+using units::isq::si::international::literals::operator""_q_ft;
+using units::isq::si::international::literals::operator""_q_fathom;
+using units::isq::si::international::literals::operator""_q_in;
+using units::isq::si::international::literals::operator""_q_mi;
+using units::isq::si::international::literals::operator""_q_naut_mi;
+using units::isq::si::international::literals::operator""_q_thou;
+using units::isq::si::international::literals::operator""_q_mil;
+using units::isq::si::international::literals::operator""_q_mi_per_h;
+using units::isq::si::international::literals::operator""_q_ft3;
+
+}  // namespace units::isq::si::international::literals
+
+#endif // UNITS_NO_LITERALS
+
+#ifndef UNITS_NO_REFERENCES
+
+export namespace units::isq::si::international::area_references {
+
+using units::isq::si::international::area_references::ft2;
+
+}  // namespace units::isq::si::international::area_references
+
+export namespace units::isq::si::international::length_references {
+
+using units::isq::si::international::length_references::yd;
+using units::isq::si::international::length_references::ft;
+using units::isq::si::international::length_references::fathom;
+using units::isq::si::international::length_references::in;
+using units::isq::si::international::length_references::mi;
+using units::isq::si::international::length_references::mi_naut;
+using units::isq::si::international::length_references::thou;
+using units::isq::si::international::length_references::mil;
+
+}  // namespace units::isq::si::international::length_references
+
+export namespace units::isq::si::international::volume_references {
+
+using units::isq::si::international::volume_references::ft3;
+
+}  // namespace units::isq::si::international::volume_references
+
+export namespace units::isq::si::international::references {
+
+using units::isq::si::international::references::ft2;
+using units::isq::si::international::references::yd;
+using units::isq::si::international::references::ft;
+using units::isq::si::international::references::fathom;
+using units::isq::si::international::references::in;
+using units::isq::si::international::references::mi;
+using units::isq::si::international::references::mi_naut;
+using units::isq::si::international::references::thou;
+using units::isq::si::international::references::mil;
+using units::isq::si::international::references::ft3;
+
+}  // namespace units::isq::si::international::references
+
+#endif // UNITS_NO_REFERENCES
+
+#ifndef UNITS_NO_ALIASES
+
+export namespace units::aliases::isq::si::international::area {
+
+using units::aliases::isq::si::international::area::ft2;
+
+}  // namespace units::aliases::isq::si::international::area
+
+export namespace units::aliases::isq::si::international::length {
+
+using units::aliases::isq::si::international::length::yd;
+using units::aliases::isq::si::international::length::ft;
+using units::aliases::isq::si::international::length::fathom;
+using units::aliases::isq::si::international::length::in;
+using units::aliases::isq::si::international::length::mi;
+using units::aliases::isq::si::international::length::mi_naut;
+using units::aliases::isq::si::international::length::thou;
+using units::aliases::isq::si::international::length::mil;
+
+}  // namespace units::aliases::isq::si::international::length
+
+export namespace units::aliases::isq::si::international::speed {
+
+using units::aliases::isq::si::international::speed::mi_per_h;
+
+}  // namespace units::aliases::isq::si::international::speed
+
+export namespace units::aliases::isq::si::international::volume {
+
+using units::aliases::isq::si::international::volume::ft3;
+
+}  // namespace units::aliases::isq::si::international::volume
+
+#endif // UNITS_NO_ALIASES
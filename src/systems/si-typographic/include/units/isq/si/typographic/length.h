@@ -86,6 +86,11 @@ using namespace length_references;
 
 }  // namespace units::isq::si::typographic
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::typographic::pica_comp);
+UNITS_DOWNCAST_REGISTER(units::isq::si::typographic::pica_prn);
+UNITS_DOWNCAST_REGISTER(units::isq::si::typographic::point_comp);
+UNITS_DOWNCAST_REGISTER(units::isq::si::typographic::point_prn);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::typographic::inline length {
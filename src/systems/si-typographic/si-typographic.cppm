@@ -0,0 +1,86 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+module;
+
+#include <units/isq/si/typographic/typographic.h>
+
+export module mp_units.systems.si.typographic;
+
+export import mp_units.systems.si;
+
+export namespace units::isq::si::typographic {
+
+using units::isq::si::typographic::pica_comp;
+using units::isq::si::typographic::pica_prn;
+using units::isq::si::typographic::point_comp;
+using units::isq::si::typographic::point_prn;
+
+}  // namespace units::isq::si::typographic
+
+#ifndef UNITS_NO_LITERALS
+
+export namespace units::isq::si::typographic::literals {
+
+using units::isq::si::typographic::literals::operator""_q_pica_comp;
+using units::isq::si::typographic::literals::operator""_q_pica_prn;
+using units::isq::si::typographic::literals::operator""_q_point_comp;
+using units::isq::si::typographic::literals::operator""_q_point_prn;
+
+}  // namespace units::isq::si::typographic::literals
+
+#endif // UNITS_NO_LITERALS
+
+#ifndef UNITS_NO_REFERENCES
+
+export namespace units::isq::si::typographic::length_references {
+
+using units::isq::si::typographic::length_references::pica_comp;
+using units::isq::si::typographic::length_references::pica_prn;
+using units::isq::si::typographic::length_references::point_comp;
+using units::isq::si::typographic::length_references::point_prn;
+
+}  // namespace units::isq::si::typographic::length_references
+
+export namespace units::isq::si::typographic::references {
+
+using units::isq::si::typographic::references::pica_comp;
+using units::isq::si::typographic::references::pica_prn;
+using units::isq::si::typographic::references::point_comp;
+using units::isq::si::typographic::references::point_prn;
+
+}  // namespace units::isq::si::typographic::references
+
+#endif // UNITS_NO_REFERENCES
+
+#ifndef UNITS_NO_ALIASES
+
+export namespace units::aliases::isq::si::typographic::length {
+
+using units::aliases::isq::si::typographic::length::pica_comp;
+using units::aliases::isq::si::typographic::length::pica_prn;
+using units::aliases::isq::si::typographic::length::point_comp;
+using units::aliases::isq::si::typographic::length::point_prn;
+
+}  // namespace units::aliases::isq::si::typographic::length
+
+#endif // UNITS_NO_ALIASES
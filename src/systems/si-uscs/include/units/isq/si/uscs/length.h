@@ -85,6 +85,10 @@ using namespace length_references;
 
 }  // namespace units::isq::si::uscs
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::uscs::foot);
+UNITS_DOWNCAST_REGISTER(units::isq::si::uscs::fathom);
+UNITS_DOWNCAST_REGISTER(units::isq::si::uscs::mile);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::uscs::inline length {
@@ -0,0 +1,81 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+module;
+
+#include <units/isq/si/uscs/uscs.h>
+
+export module mp_units.systems.si.uscs;
+
+export import mp_units.systems.si;
+
+export namespace units::isq::si::uscs {
+
+using units::isq::si::uscs::foot;
+using units::isq::si::uscs::fathom;
+using units::isq::si::uscs::mile;
+
+}  // namespace units::isq::si::uscs
+
+#ifndef UNITS_NO_LITERALS
+
+export namespace units::isq::si::uscs::literals {
+
+using units::isq::si::uscs::literals::operator""_q_ft_us;
+using units::isq::si::uscs::literals::operator""_q_fathom_us;
+using units::isq::si::uscs::literals::operator""_q_mi_us;
+
+}  // namespace units::isq::si::uscs::literals
+
+#endif // UNITS_NO_LITERALS
+
+#ifndef UNITS_NO_REFERENCES
+
+export namespace units::isq::si::uscs::length_references {
+
+using units::isq::si::uscs::length_references::ft;
+using units::isq::si::uscs::length_references::fathom;
+using units::isq::si::uscs::length_references::mi;
+
+}  // namespace units::isq::si::uscs::length_references
+
+export namespace units::isq::si::uscs::references {
+
+using units::isq::si::uscs::references::ft;
+using units::isq::si::uscs::references::fathom;
+using units::isq::si::uscs::references::mi;
+
+}  // namespace units::isq::si::uscs::references
+
+#endif // UNITS_NO_REFERENCES
+
+#ifndef UNITS_NO_ALIASES
+
+export namespace units::aliases::isq::si::uscs::length {
+
+using units::aliases::isq::si::uscs::length::ft;
+using units::aliases::isq::si::uscs::length::fathom;
+using units::aliases::isq::si::uscs::length::mi;
+
+}  // namespace units::aliases::isq::si::uscs::length
+
+#endif // UNITS_NO_ALIASES
@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/absorbed_dose.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/reference.h>
 #include <units/symbol_text.h>
@@ -59,139 +60,31 @@ struct yottagray : prefixed_unit<yottagray, yotta, gray> {};
 
 struct dim_absorbed_dose : isq::dim_absorbed_dose<dim_absorbed_dose, gray, dim_energy, dim_mass> {};
 
-template<UnitOf<dim_absorbed_dose> U, Representation Rep = double>
-using absorbed_dose = quantity<dim_absorbed_dose, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// Gy
-constexpr auto operator"" _q_Gy(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return absorbed_dose<gray, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_Gy(long double l) { return absorbed_dose<gray, long double>(l); }
-
-// yGy
-constexpr auto operator"" _q_yGy(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return absorbed_dose<yoctogray, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_yGy(long double l) { return absorbed_dose<yoctogray, long double>(l); }
-
-// zGy
-constexpr auto operator"" _q_zGy(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return absorbed_dose<zeptogray, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_zGy(long double l) { return absorbed_dose<zeptogray, long double>(l); }
-
-// aGy
-constexpr auto operator"" _q_aGy(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return absorbed_dose<attogray, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_aGy(long double l) { return absorbed_dose<attogray, long double>(l); }
-
-// fGy
-constexpr auto operator"" _q_fGy(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return absorbed_dose<femtogray, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_fGy(long double l) { return absorbed_dose<femtogray, long double>(l); }
-
-// pGy
-constexpr auto operator"" _q_pGy(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return absorbed_dose<picogray, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_pGy(long double l) { return absorbed_dose<picogray, long double>(l); }
-
-// nGy
-constexpr auto operator"" _q_nGy(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return absorbed_dose<nanogray, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_nGy(long double l) { return absorbed_dose<nanogray, long double>(l); }
-
-// uGy
-constexpr auto operator"" _q_uGy(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return absorbed_dose<microgray, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_uGy(long double l) { return absorbed_dose<microgray, long double>(l); }
-
-// mGy
-constexpr auto operator"" _q_mGy(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return absorbed_dose<milligray, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_mGy(long double l) { return absorbed_dose<milligray, long double>(l); }
-
-// cGy
-constexpr auto operator"" _q_cGy(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return absorbed_dose<centigray, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_cGy(long double l) { return absorbed_dose<centigray, long double>(l); }
-
-// dGy
-constexpr auto operator"" _q_dGy(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return absorbed_dose<decigray, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_dGy(long double l) { return absorbed_dose<decigray, long double>(l); }
-
-// daGy
-constexpr auto operator"" _q_daGy(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return absorbed_dose<decagray, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_daGy(long double l) { return absorbed_dose<decagray, long double>(l); }
-
-// hGy
-constexpr auto operator"" _q_hGy(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return absorbed_dose<hectogray, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_hGy(long double l) { return absorbed_dose<hectogray, long double>(l); }
-
-// kGy
-constexpr auto operator"" _q_kGy(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return absorbed_dose<kilogray, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_kGy(long double l) { return absorbed_dose<kilogray, long double>(l); }
-
-// MGy
-constexpr auto operator"" _q_MGy(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return absorbed_dose<megagray, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_MGy(long double l) { return absorbed_dose<megagray, long double>(l); }
-
-// GGy
-constexpr auto operator"" _q_GGy(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return absorbed_dose<gigagray, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_GGy(long double l) { return absorbed_dose<gigagray, long double>(l); }
-
-// TGy
-constexpr auto operator"" _q_TGy(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return absorbed_dose<teragray, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_TGy(long double l) { return absorbed_dose<teragray, long double>(l); }
-
-// PGy
-constexpr auto operator"" _q_PGy(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return absorbed_dose<petagray, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_PGy(long double l) { return absorbed_dose<petagray, long double>(l); }
-
-// EGy
-constexpr auto operator"" _q_EGy(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return absorbed_dose<exagray, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_EGy(long double l) { return absorbed_dose<exagray, long double>(l); }
-
-// ZGy
-constexpr auto operator"" _q_ZGy(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return absorbed_dose<zettagray, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_ZGy(long double l) { return absorbed_dose<zettagray, long double>(l); }
-
-// YGy
-constexpr auto operator"" _q_YGy(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return absorbed_dose<yottagray, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_YGy(long double l) { return absorbed_dose<yottagray, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
-#ifndef UNITS_NO_REFERENCES
-
-namespace absorbed_dose_references {
-
-inline constexpr auto Gy = reference<dim_absorbed_dose, gray>{};
-inline constexpr auto yGy = reference<dim_absorbed_dose, yoctogray>{};
-inline constexpr auto zGy = reference<dim_absorbed_dose, zeptogray>{};
-inline constexpr auto aGy = reference<dim_absorbed_dose, attogray>{};
-inline constexpr auto fGy = reference<dim_absorbed_dose, femtogray>{};
-inline constexpr auto pGy = reference<dim_absorbed_dose, picogray>{};
-inline constexpr auto nGy = reference<dim_absorbed_dose, nanogray>{};
-inline constexpr auto uGy = reference<dim_absorbed_dose, microgray>{};
-inline constexpr auto mGy = reference<dim_absorbed_dose, milligray>{};
-inline constexpr auto cGy = reference<dim_absorbed_dose, centigray>{};
-inline constexpr auto dGy = reference<dim_absorbed_dose, decigray>{};
-inline constexpr auto daGy = reference<dim_absorbed_dose, decagray>{};
-inline constexpr auto hGy = reference<dim_absorbed_dose, hectogray>{};
-inline constexpr auto kGy = reference<dim_absorbed_dose, kilogray>{};
-inline constexpr auto MGy = reference<dim_absorbed_dose, megagray>{};
-inline constexpr auto GGy = reference<dim_absorbed_dose, gigagray>{};
-inline constexpr auto TGy = reference<dim_absorbed_dose, teragray>{};
-inline constexpr auto PGy = reference<dim_absorbed_dose, petagray>{};
-inline constexpr auto EGy = reference<dim_absorbed_dose, exagray>{};
-inline constexpr auto ZGy = reference<dim_absorbed_dose, zettagray>{};
-inline constexpr auto YGy = reference<dim_absorbed_dose, yottagray>{};
-
-}  // namespace absorbed_dose_references
-
-namespace references {
-
-using namespace absorbed_dose_references;
-
-}  // namespace references
-
-#endif // UNITS_NO_REFERENCES
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::gray);
+UNITS_DOWNCAST_REGISTER(units::isq::si::yoctogray);
+UNITS_DOWNCAST_REGISTER(units::isq::si::zeptogray);
+UNITS_DOWNCAST_REGISTER(units::isq::si::attogray);
+UNITS_DOWNCAST_REGISTER(units::isq::si::femtogray);
+UNITS_DOWNCAST_REGISTER(units::isq::si::picogray);
+UNITS_DOWNCAST_REGISTER(units::isq::si::nanogray);
+UNITS_DOWNCAST_REGISTER(units::isq::si::microgray);
+UNITS_DOWNCAST_REGISTER(units::isq::si::milligray);
+UNITS_DOWNCAST_REGISTER(units::isq::si::centigray);
+UNITS_DOWNCAST_REGISTER(units::isq::si::decigray);
+UNITS_DOWNCAST_REGISTER(units::isq::si::decagray);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hectogray);
+UNITS_DOWNCAST_REGISTER(units::isq::si::kilogray);
+UNITS_DOWNCAST_REGISTER(units::isq::si::megagray);
+UNITS_DOWNCAST_REGISTER(units::isq::si::gigagray);
+UNITS_DOWNCAST_REGISTER(units::isq::si::teragray);
+UNITS_DOWNCAST_REGISTER(units::isq::si::petagray);
+UNITS_DOWNCAST_REGISTER(units::isq::si::exagray);
+UNITS_DOWNCAST_REGISTER(units::isq::si::zettagray);
+UNITS_DOWNCAST_REGISTER(units::isq::si::yottagray);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_absorbed_dose);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline absorbed_dose {
@@ -221,3 +114,11 @@ template<Representation Rep = double> using YGy = units::isq::si::absorbed_dose<
 }  // namespace units::aliases::isq::si::inline absorbed_dose
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/absorbed_dose.h>
+#endif // UNITS_NO_LITERALS
+
+#ifndef UNITS_NO_REFERENCES
+#include <units/isq/si/references/absorbed_dose.h>
+#endif // UNITS_NO_REFERENCES
@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/acceleration.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/symbol_text.h>
 #include <units/unit.h>
@@ -36,23 +37,11 @@ namespace units::isq::si {
 struct metre_per_second_sq : unit<metre_per_second_sq> {};
 struct dim_acceleration : isq::dim_acceleration<dim_acceleration, metre_per_second_sq, dim_length, dim_time> {};
 
-template<UnitOf<dim_acceleration> U, Representation Rep = double>
-using acceleration = quantity<dim_acceleration, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// m/s2
-constexpr auto operator"" _q_m_per_s2(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return acceleration<metre_per_second_sq, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_m_per_s2(long double l) { return acceleration<metre_per_second_sq, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::metre_per_second_sq);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_acceleration);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline acceleration {
@@ -62,3 +51,7 @@ template<Representation Rep = double> using m_per_s2 = units::isq::si::accelerat
 }  // namespace units::aliases::isq::si::inline acceleration
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/acceleration.h>
+#endif // UNITS_NO_LITERALS
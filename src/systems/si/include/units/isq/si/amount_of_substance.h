@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/amount_of_substance.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/reference.h>
 #include <units/symbol_text.h>
@@ -38,39 +39,10 @@ struct mole : named_unit<mole, "mol", prefix> {};
 
 struct dim_amount_of_substance : isq::dim_amount_of_substance<mole> {};
 
-template<UnitOf<dim_amount_of_substance> U, Representation Rep = double>
-using amount_of_substance = quantity<dim_amount_of_substance, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// mol
-constexpr auto operator"" _q_mol(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return amount_of_substance<mole, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_mol(long double l) { return amount_of_substance<mole, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
-#ifndef UNITS_NO_REFERENCES
-
-namespace amount_of_substance_references {
-
-inline constexpr auto mol = reference<dim_amount_of_substance, mole>{};
-
-}  // namespace amount_of_substance_references
-
-namespace references {
-
-using namespace amount_of_substance_references;
-
-}  // namespace references
-
-#endif // UNITS_NO_REFERENCES
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::mole);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline amount_of_substance {
@@ -80,3 +52,11 @@ template<Representation Rep = double> using mol = units::isq::si::amount_of_subs
 }  // namespace units::aliases::isq::si::inline amount_of_substance
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/amount_of_substance.h>
+#endif // UNITS_NO_LITERALS
+
+#ifndef UNITS_NO_REFERENCES
+#include <units/isq/si/references/amount_of_substance.h>
+#endif // UNITS_NO_REFERENCES
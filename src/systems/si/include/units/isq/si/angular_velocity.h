@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/angular_velocity.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/symbol_text.h>
 // IWYU pragma: end_exports
@@ -38,23 +39,11 @@ struct radian_per_second : named_unit<radian_per_second, basic_symbol_text{"ω",
 
 struct dim_angular_velocity : isq::dim_angular_velocity<dim_angular_velocity, radian_per_second, dim_angle<>, dim_time> {};
 
-template<UnitOf<dim_angular_velocity> U, Representation Rep = double>
-using angular_velocity = quantity<dim_angular_velocity, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// rad / s
-constexpr auto operator"" _q_rad_per_s(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return angular_velocity<radian_per_second, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_rad_per_s(long double l) { return angular_velocity<radian_per_second, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::radian_per_second);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_angular_velocity);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline angular_velocity {
@@ -64,3 +53,7 @@ template<Representation Rep = double> using rad_per_s = units::isq::si::angular_
 }  // namespace units::aliases::isq::si::inline angular_velocity
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/angular_velocity.h>
+#endif // UNITS_NO_LITERALS
@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/area.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/reference.h>
 #include <units/symbol_text.h>
@@ -60,145 +61,31 @@ struct square_yottametre : derived_unit<square_yottametre, dim_area, yottametre>
 
 struct hectare : alias_unit<square_hectometre, "ha", no_prefix> {};
 
-template<UnitOf<dim_area> U, Representation Rep = double>
-using area = quantity<dim_area, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// m2
-constexpr auto operator"" _q_m2(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return area<square_metre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_m2(long double l) { return area<square_metre, long double>(l); }
-
-// ym2
-constexpr auto operator"" _q_ym2(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return area<square_yoctometre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_ym2(long double l) { return area<square_yoctometre, long double>(l); }
-
-// zm2
-constexpr auto operator"" _q_zm2(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return area<square_zeptometre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_zm2(long double l) { return area<square_zeptometre, long double>(l); }
-
-// am2
-constexpr auto operator"" _q_am2(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return area<square_attometre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_am2(long double l) { return area<square_attometre, long double>(l); }
-
-// fm2
-constexpr auto operator"" _q_fm2(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return area<square_femtometre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_fm2(long double l) { return area<square_femtometre, long double>(l); }
-
-// pm2
-constexpr auto operator"" _q_pm2(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return area<square_picometre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_pm2(long double l) { return area<square_picometre, long double>(l); }
-
-// nm2
-constexpr auto operator"" _q_nm2(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return area<square_nanometre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_nm2(long double l) { return area<square_nanometre, long double>(l); }
-
-// um2
-constexpr auto operator"" _q_um2(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return area<square_micrometre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_um2(long double l) { return area<square_micrometre, long double>(l); }
-
-// mm2
-constexpr auto operator"" _q_mm2(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return area<square_millimetre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_mm2(long double l) { return area<square_millimetre, long double>(l); }
-
-// cm2
-constexpr auto operator"" _q_cm2(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return area<square_centimetre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_cm2(long double l) { return area<square_centimetre, long double>(l); }
-
-// dm2
-constexpr auto operator"" _q_dm2(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return area<square_decimetre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_dm2(long double l) { return area<square_decimetre, long double>(l); }
-
-// dam2
-constexpr auto operator"" _q_dam2(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return area<square_decametre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_dam2(long double l) { return area<square_decametre, long double>(l); }
-
-// hm2
-constexpr auto operator"" _q_hm2(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return area<square_hectometre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_hm2(long double l) { return area<square_hectometre, long double>(l); }
-
-// km2
-constexpr auto operator"" _q_km2(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return area<square_kilometre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_km2(long double l) { return area<square_kilometre, long double>(l); }
-
-// Mm2
-constexpr auto operator"" _q_Mm2(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return area<square_megametre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_Mm2(long double l) { return area<square_megametre, long double>(l); }
-
-// Gm2
-constexpr auto operator"" _q_Gm2(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return area<square_gigametre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_Gm2(long double l) { return area<square_gigametre, long double>(l); }
-
-// Tm2
-constexpr auto operator"" _q_Tm2(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return area<square_terametre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_Tm2(long double l) { return area<square_terametre, long double>(l); }
-
-// Pm2
-constexpr auto operator"" _q_Pm2(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return area<square_petametre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_Pm2(long double l) { return area<square_petametre, long double>(l); }
-
-// Em2
-constexpr auto operator"" _q_Em2(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return area<square_exametre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_Em2(long double l) { return area<square_exametre, long double>(l); }
-
-// Zm2
-constexpr auto operator"" _q_Zm2(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return area<square_zettametre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_Zm2(long double l) { return area<square_zettametre, long double>(l); }
-
-// Ym2
-constexpr auto operator"" _q_Ym2(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return area<square_yottametre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_Ym2(long double l) { return area<square_yottametre, long double>(l); }
-
-// ha
-constexpr auto operator"" _q_ha(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return area<hectare, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_ha(long double l) { return area<hectare, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
-#ifndef UNITS_NO_REFERENCES
-
-namespace area_references {
-
-inline constexpr auto m2 = reference<dim_area, square_metre>{};
-inline constexpr auto ym2 = reference<dim_area, square_yoctometre>{};
-inline constexpr auto zm2 = reference<dim_area, square_zeptometre>{};
-inline constexpr auto am2 = reference<dim_area, square_attometre>{};
-inline constexpr auto fm2 = reference<dim_area, square_femtometre>{};
-inline constexpr auto pm2 = reference<dim_area, square_picometre>{};
-inline constexpr auto nm2 = reference<dim_area, square_nanometre>{};
-inline constexpr auto um2 = reference<dim_area, square_micrometre>{};
-inline constexpr auto mm2 = reference<dim_area, square_millimetre>{};
-inline constexpr auto cm2 = reference<dim_area, square_centimetre>{};
-inline constexpr auto dm2 = reference<dim_area, square_decimetre>{};
-inline constexpr auto dam2 = reference<dim_area, square_decametre>{};
-inline constexpr auto hm2 = reference<dim_area, square_hectometre>{};
-inline constexpr auto km2 = reference<dim_area, square_kilometre>{};
-inline constexpr auto Mm2 = reference<dim_area, square_megametre>{};
-inline constexpr auto Gm2 = reference<dim_area, square_gigametre>{};
-inline constexpr auto Tm2 = reference<dim_area, square_terametre>{};
-inline constexpr auto Pm2 = reference<dim_area, square_petametre>{};
-inline constexpr auto Em2 = reference<dim_area, square_exametre>{};
-inline constexpr auto Zm2 = reference<dim_area, square_zettametre>{};
-inline constexpr auto Ym2 = reference<dim_area, square_yottametre>{};
-
-inline constexpr auto ha = reference<dim_area, hectare>{};
-
-}  // namespace area_references
-
-namespace references {
-
-using namespace area_references;
-
-}  // namespace references
-
-#endif // UNITS_NO_REFERENCES
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::square_metre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_area);
+UNITS_DOWNCAST_REGISTER(units::isq::si::square_yoctometre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::square_zeptometre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::square_attometre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::square_femtometre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::square_picometre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::square_nanometre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::square_micrometre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::square_millimetre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::square_centimetre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::square_decimetre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::square_decametre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::square_hectometre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::square_kilometre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::square_megametre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::square_gigametre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::square_terametre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::square_petametre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::square_exametre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::square_zettametre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::square_yottametre);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline area {
@@ -230,3 +117,11 @@ template<Representation Rep = double> using ha = units::isq::si::area<units::isq
 }  // namespace units::aliases::isq::si::inline area
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/area.h>
+#endif // UNITS_NO_LITERALS
+
+#ifndef UNITS_NO_REFERENCES
+#include <units/isq/si/references/area.h>
+#endif // UNITS_NO_REFERENCES
@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/capacitance.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/reference.h>
 #include <units/symbol_text.h>
@@ -60,139 +61,31 @@ struct yottafarad : prefixed_unit<yottafarad, yotta, farad> {};
 
 struct dim_capacitance : isq::dim_capacitance<dim_capacitance, farad, dim_electric_charge, dim_voltage> {};
 
-template<UnitOf<dim_capacitance> U, Representation Rep = double>
-using capacitance = quantity<dim_capacitance, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// F
-constexpr auto operator"" _q_F(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return capacitance<farad, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_F(long double l) { return capacitance<farad, long double>(l); }
-
-// yF
-constexpr auto operator"" _q_yF(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return capacitance<yoctofarad, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_yF(long double l) { return capacitance<yoctofarad, long double>(l); }
-
-// zF
-constexpr auto operator"" _q_zF(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return capacitance<zeptofarad, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_zF(long double l) { return capacitance<zeptofarad, long double>(l); }
-
-// aF
-constexpr auto operator"" _q_aF(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return capacitance<attofarad, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_aF(long double l) { return capacitance<attofarad, long double>(l); }
-
-// fF
-constexpr auto operator"" _q_fF(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return capacitance<femtofarad, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_fF(long double l) { return capacitance<femtofarad, long double>(l); }
-
-// pF
-constexpr auto operator"" _q_pF(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return capacitance<picofarad, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_pF(long double l) { return capacitance<picofarad, long double>(l); }
-
-// nF
-constexpr auto operator"" _q_nF(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return capacitance<nanofarad, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_nF(long double l) { return capacitance<nanofarad, long double>(l); }
-
-// uF
-constexpr auto operator"" _q_uF(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return capacitance<microfarad, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_uF(long double l) { return capacitance<microfarad, long double>(l); }
-
-// mF
-constexpr auto operator"" _q_mF(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return capacitance<millifarad, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_mF(long double l) { return capacitance<millifarad, long double>(l); }
-
-// cF
-constexpr auto operator"" _q_cF(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return capacitance<centifarad, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_cF(long double l) { return capacitance<centifarad, long double>(l); }
-
-// dF
-constexpr auto operator"" _q_dF(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return capacitance<decifarad, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_dF(long double l) { return capacitance<decifarad, long double>(l); }
-
-// daF
-constexpr auto operator"" _q_daF(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return capacitance<decafarad, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_daF(long double l) { return capacitance<decafarad, long double>(l); }
-
-// hF
-constexpr auto operator"" _q_hF(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return capacitance<hectofarad, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_hF(long double l) { return capacitance<hectofarad, long double>(l); }
-
-// kF
-constexpr auto operator"" _q_kF(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return capacitance<kilofarad, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_kF(long double l) { return capacitance<kilofarad, long double>(l); }
-
-// MF
-constexpr auto operator"" _q_MF(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return capacitance<megafarad, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_MF(long double l) { return capacitance<megafarad, long double>(l); }
-
-// GF
-constexpr auto operator"" _q_GF(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return capacitance<gigafarad, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_GF(long double l) { return capacitance<gigafarad, long double>(l); }
-
-// TF
-constexpr auto operator"" _q_TF(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return capacitance<terafarad, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_TF(long double l) { return capacitance<terafarad, long double>(l); }
-
-// PF
-constexpr auto operator"" _q_PF(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return capacitance<petafarad, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_PF(long double l) { return capacitance<petafarad, long double>(l); }
-
-// EF
-constexpr auto operator"" _q_EF(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return capacitance<exafarad, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_EF(long double l) { return capacitance<exafarad, long double>(l); }
-
-// ZF
-constexpr auto operator"" _q_ZF(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return capacitance<zettafarad, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_ZF(long double l) { return capacitance<zettafarad, long double>(l); }
-
-// YF
-constexpr auto operator"" _q_YF(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return capacitance<yottafarad, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_YF(long double l) { return capacitance<yottafarad, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
-#ifndef UNITS_NO_REFERENCES
-
-namespace capacitance_references {
-
-inline constexpr auto F = reference<dim_capacitance, farad>{};
-inline constexpr auto yF = reference<dim_capacitance, yoctofarad>{};
-inline constexpr auto zF = reference<dim_capacitance, zeptofarad>{};
-inline constexpr auto aF = reference<dim_capacitance, attofarad>{};
-inline constexpr auto fF = reference<dim_capacitance, femtofarad>{};
-inline constexpr auto pF = reference<dim_capacitance, picofarad>{};
-inline constexpr auto nF = reference<dim_capacitance, nanofarad>{};
-inline constexpr auto uF = reference<dim_capacitance, microfarad>{};
-inline constexpr auto mF = reference<dim_capacitance, millifarad>{};
-inline constexpr auto cF = reference<dim_capacitance, centifarad>{};
-inline constexpr auto dF = reference<dim_capacitance, decifarad>{};
-inline constexpr auto daF = reference<dim_capacitance, decafarad>{};
-inline constexpr auto hF = reference<dim_capacitance, hectofarad>{};
-inline constexpr auto kF = reference<dim_capacitance, kilofarad>{};
-inline constexpr auto MF = reference<dim_capacitance, megafarad>{};
-inline constexpr auto GF = reference<dim_capacitance, gigafarad>{};
-inline constexpr auto TF = reference<dim_capacitance, terafarad>{};
-inline constexpr auto PF = reference<dim_capacitance, petafarad>{};
-inline constexpr auto EF = reference<dim_capacitance, exafarad>{};
-inline constexpr auto ZF = reference<dim_capacitance, zettafarad>{};
-inline constexpr auto YF = reference<dim_capacitance, yottafarad>{};
-
-}  // namespace capacitance_references
-
-namespace references {
-
-using namespace capacitance_references;
-
-}  // namespace references
-
-#endif // UNITS_NO_REFERENCES
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::farad);
+UNITS_DOWNCAST_REGISTER(units::isq::si::yoctofarad);
+UNITS_DOWNCAST_REGISTER(units::isq::si::zeptofarad);
+UNITS_DOWNCAST_REGISTER(units::isq::si::attofarad);
+UNITS_DOWNCAST_REGISTER(units::isq::si::femtofarad);
+UNITS_DOWNCAST_REGISTER(units::isq::si::picofarad);
+UNITS_DOWNCAST_REGISTER(units::isq::si::nanofarad);
+UNITS_DOWNCAST_REGISTER(units::isq::si::microfarad);
+UNITS_DOWNCAST_REGISTER(units::isq::si::millifarad);
+UNITS_DOWNCAST_REGISTER(units::isq::si::centifarad);
+UNITS_DOWNCAST_REGISTER(units::isq::si::decifarad);
+UNITS_DOWNCAST_REGISTER(units::isq::si::decafarad);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hectofarad);
+UNITS_DOWNCAST_REGISTER(units::isq::si::kilofarad);
+UNITS_DOWNCAST_REGISTER(units::isq::si::megafarad);
+UNITS_DOWNCAST_REGISTER(units::isq::si::gigafarad);
+UNITS_DOWNCAST_REGISTER(units::isq::si::terafarad);
+UNITS_DOWNCAST_REGISTER(units::isq::si::petafarad);
+UNITS_DOWNCAST_REGISTER(units::isq::si::exafarad);
+UNITS_DOWNCAST_REGISTER(units::isq::si::zettafarad);
+UNITS_DOWNCAST_REGISTER(units::isq::si::yottafarad);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_capacitance);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline capacitance {
@@ -222,3 +115,11 @@ template<Representation Rep = double> using YF = units::isq::si::capacitance<uni
 }  // namespace units::aliases::isq::si::inline capacitance
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/capacitance.h>
+#endif // UNITS_NO_LITERALS
+
+#ifndef UNITS_NO_REFERENCES
+#include <units/isq/si/references/capacitance.h>
+#endif // UNITS_NO_REFERENCES
@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/catalytic_activity.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/reference.h>
 #include <units/symbol_text.h>
@@ -62,144 +63,32 @@ struct enzyme_unit : named_scaled_unit<enzyme_unit, "U", prefix, ratio(1, 60, -6
 
 struct dim_catalytic_activity : isq::dim_catalytic_activity<dim_catalytic_activity, katal, dim_time, dim_amount_of_substance> {};
 
-template<UnitOf<dim_catalytic_activity> U, Representation Rep = double>
-using catalytic_activity = quantity<dim_catalytic_activity, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// kat
-constexpr auto operator"" _q_kat(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return catalytic_activity<katal, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_kat(long double l) { return catalytic_activity<katal, long double>(l); }
-
-// ykat
-constexpr auto operator"" _q_ykat(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return catalytic_activity<yoctokatal, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_ykat(long double l) { return catalytic_activity<yoctokatal, long double>(l); }
-
-// zkat
-constexpr auto operator"" _q_zkat(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return catalytic_activity<zeptokatal, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_zkat(long double l) { return catalytic_activity<zeptokatal, long double>(l); }
-
-// akat
-constexpr auto operator"" _q_akat(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return catalytic_activity<attokatal, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_akat(long double l) { return catalytic_activity<attokatal, long double>(l); }
-
-// fkat
-constexpr auto operator"" _q_fkat(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return catalytic_activity<femtokatal, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_fkat(long double l) { return catalytic_activity<femtokatal, long double>(l); }
-
-// pkat
-constexpr auto operator"" _q_pkat(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return catalytic_activity<picokatal, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_pkat(long double l) { return catalytic_activity<picokatal, long double>(l); }
-
-// nkat
-constexpr auto operator"" _q_nkat(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return catalytic_activity<nanokatal, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_nkat(long double l) { return catalytic_activity<nanokatal, long double>(l); }
-
-// ukat
-constexpr auto operator"" _q_ukat(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return catalytic_activity<microkatal, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_ukat(long double l) { return catalytic_activity<microkatal, long double>(l); }
-
-// mkat
-constexpr auto operator"" _q_mkat(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return catalytic_activity<millikatal, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_mkat(long double l) { return catalytic_activity<millikatal, long double>(l); }
-
-// ckat
-constexpr auto operator"" _q_ckat(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return catalytic_activity<centikatal, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_ckat(long double l) { return catalytic_activity<centikatal, long double>(l); }
-
-// dkat
-constexpr auto operator"" _q_dkat(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return catalytic_activity<decikatal, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_dkat(long double l) { return catalytic_activity<decikatal, long double>(l); }
-
-// dakat
-constexpr auto operator"" _q_dakat(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return catalytic_activity<decakatal, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_dakat(long double l) { return catalytic_activity<decakatal, long double>(l); }
-
-// hkat
-constexpr auto operator"" _q_hkat(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return catalytic_activity<hectokatal, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_hkat(long double l) { return catalytic_activity<hectokatal, long double>(l); }
-
-// kkat
-constexpr auto operator"" _q_kkat(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return catalytic_activity<kilokatal, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_kkat(long double l) { return catalytic_activity<kilokatal, long double>(l); }
-
-// Mkat
-constexpr auto operator"" _q_Mkat(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return catalytic_activity<megakatal, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_Mkat(long double l) { return catalytic_activity<megakatal, long double>(l); }
-
-// Gkat
-constexpr auto operator"" _q_Gkat(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return catalytic_activity<gigakatal, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_Gkat(long double l) { return catalytic_activity<gigakatal, long double>(l); }
-
-// Tkat
-constexpr auto operator"" _q_Tkat(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return catalytic_activity<terakatal, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_Tkat(long double l) { return catalytic_activity<terakatal, long double>(l); }
-
-// Pkat
-constexpr auto operator"" _q_Pkat(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return catalytic_activity<petakatal, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_Pkat(long double l) { return catalytic_activity<petakatal, long double>(l); }
-
-// Ekat
-constexpr auto operator"" _q_Ekat(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return catalytic_activity<exakatal, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_Ekat(long double l) { return catalytic_activity<exakatal, long double>(l); }
-
-// Zkat
-constexpr auto operator"" _q_Zkat(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return catalytic_activity<zettakatal, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_Zkat(long double l) { return catalytic_activity<zettakatal, long double>(l); }
-
-// Ykat
-constexpr auto operator"" _q_Ykat(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return catalytic_activity<yottakatal, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_Ykat(long double l) { return catalytic_activity<yottakatal, long double>(l); }
-
-// U
-constexpr auto operator"" _q_U(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return catalytic_activity<enzyme_unit, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_U(long double l) { return catalytic_activity<enzyme_unit, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
-#ifndef UNITS_NO_REFERENCES
-
-namespace catalytic_activity_references {
-
-inline constexpr auto kat = reference<dim_catalytic_activity, katal>{};
-inline constexpr auto ykat = reference<dim_catalytic_activity, yoctokatal>{};
-inline constexpr auto zkat = reference<dim_catalytic_activity, zeptokatal>{};
-inline constexpr auto akat = reference<dim_catalytic_activity, attokatal>{};
-inline constexpr auto fkat = reference<dim_catalytic_activity, femtokatal>{};
-inline constexpr auto pkat = reference<dim_catalytic_activity, picokatal>{};
-inline constexpr auto nkat = reference<dim_catalytic_activity, nanokatal>{};
-inline constexpr auto ukat = reference<dim_catalytic_activity, microkatal>{};
-inline constexpr auto mkat = reference<dim_catalytic_activity, millikatal>{};
-inline constexpr auto ckat = reference<dim_catalytic_activity, centikatal>{};
-inline constexpr auto dkat = reference<dim_catalytic_activity, decikatal>{};
-inline constexpr auto dakat = reference<dim_catalytic_activity, decakatal>{};
-inline constexpr auto hkat = reference<dim_catalytic_activity, hectokatal>{};
-inline constexpr auto kkat = reference<dim_catalytic_activity, kilokatal>{};
-inline constexpr auto Mkat = reference<dim_catalytic_activity, megakatal>{};
-inline constexpr auto Gkat = reference<dim_catalytic_activity, gigakatal>{};
-inline constexpr auto Tkat = reference<dim_catalytic_activity, terakatal>{};
-inline constexpr auto Pkat = reference<dim_catalytic_activity, petakatal>{};
-inline constexpr auto Ekat = reference<dim_catalytic_activity, exakatal>{};
-inline constexpr auto Zkat = reference<dim_catalytic_activity, zettakatal>{};
-inline constexpr auto Ykat = reference<dim_catalytic_activity, yottakatal>{};
-inline constexpr auto U = reference<dim_catalytic_activity, enzyme_unit>{};
-
-}  // namespace catalytic_activity_references
-
-namespace references {
-
-using namespace catalytic_activity_references;
-
-}  // namespace references
-
-#endif // UNITS_NO_REFERENCES
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::katal);
+UNITS_DOWNCAST_REGISTER(units::isq::si::yoctokatal);
+UNITS_DOWNCAST_REGISTER(units::isq::si::zeptokatal);
+UNITS_DOWNCAST_REGISTER(units::isq::si::attokatal);
+UNITS_DOWNCAST_REGISTER(units::isq::si::femtokatal);
+UNITS_DOWNCAST_REGISTER(units::isq::si::picokatal);
+UNITS_DOWNCAST_REGISTER(units::isq::si::nanokatal);
+UNITS_DOWNCAST_REGISTER(units::isq::si::microkatal);
+UNITS_DOWNCAST_REGISTER(units::isq::si::millikatal);
+UNITS_DOWNCAST_REGISTER(units::isq::si::centikatal);
+UNITS_DOWNCAST_REGISTER(units::isq::si::decikatal);
+UNITS_DOWNCAST_REGISTER(units::isq::si::decakatal);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hectokatal);
+UNITS_DOWNCAST_REGISTER(units::isq::si::kilokatal);
+UNITS_DOWNCAST_REGISTER(units::isq::si::megakatal);
+UNITS_DOWNCAST_REGISTER(units::isq::si::gigakatal);
+UNITS_DOWNCAST_REGISTER(units::isq::si::terakatal);
+UNITS_DOWNCAST_REGISTER(units::isq::si::petakatal);
+UNITS_DOWNCAST_REGISTER(units::isq::si::exakatal);
+UNITS_DOWNCAST_REGISTER(units::isq::si::zettakatal);
+UNITS_DOWNCAST_REGISTER(units::isq::si::yottakatal);
+UNITS_DOWNCAST_REGISTER(units::isq::si::enzyme_unit);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_catalytic_activity);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline catalytic_activity {
@@ -230,3 +119,11 @@ template<Representation Rep = double> using U = units::isq::si::catalytic_activi
 }  // namespace units::aliases::isq::si::inline catalytic_activity
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/catalytic_activity.h>
+#endif // UNITS_NO_LITERALS
+
+#ifndef UNITS_NO_REFERENCES
+#include <units/isq/si/references/catalytic_activity.h>
+#endif // UNITS_NO_REFERENCES
@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/charge_density.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/symbol_text.h>
 // IWYU pragma: end_exports
@@ -41,30 +42,13 @@ struct coulomb_per_metre_sq : unit<coulomb_per_metre_sq> {};
 struct dim_charge_density : isq::dim_charge_density<dim_charge_density, coulomb_per_metre_cub, dim_electric_charge, dim_length> {};
 struct dim_surface_charge_density : isq::dim_surface_charge_density<dim_surface_charge_density, coulomb_per_metre_sq, dim_electric_charge, dim_length> {};
 
-template<UnitOf<dim_charge_density> U, Representation Rep = double>
-using charge_density = quantity<dim_charge_density, U, Rep>;
-
-template<UnitOf<dim_surface_charge_density> U, Representation Rep = double>
-using surface_charge_density = quantity<dim_surface_charge_density, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// C/m³
-constexpr auto operator"" _q_C_per_m3(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return charge_density<coulomb_per_metre_cub, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_C_per_m3(long double l) { return charge_density<coulomb_per_metre_cub, long double>(l); }
-
-// C/m²
-constexpr auto operator"" _q_C_per_m2(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return surface_charge_density<coulomb_per_metre_sq, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_C_per_m2(long double l) { return surface_charge_density<coulomb_per_metre_sq, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::coulomb_per_metre_cub);
+UNITS_DOWNCAST_REGISTER(units::isq::si::coulomb_per_metre_sq);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_charge_density);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_surface_charge_density);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline charge_density {
@@ -75,3 +59,7 @@ template<Representation Rep = double> using C_per_m2 = units::isq::si::surface_c
 }  // namespace units::aliases::isq::si::inline charge_density
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/charge_density.h>
+#endif // UNITS_NO_LITERALS
@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/concentration.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/symbol_text.h>
 // IWYU pragma: end_exports
@@ -37,23 +38,11 @@ namespace units::isq::si {
 struct mol_per_metre_cub : unit<mol_per_metre_cub> {};
 struct dim_concentration : isq::dim_concentration<dim_concentration, mol_per_metre_cub, dim_amount_of_substance, dim_length> {};
 
-template<UnitOf<dim_concentration> U, Representation Rep = double>
-using concentration = quantity<dim_concentration, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// mol/m³
-constexpr auto operator"" _q_mol_per_m3(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return concentration<mol_per_metre_cub, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_mol_per_m3(long double l) { return concentration<mol_per_metre_cub, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::mol_per_metre_cub);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_concentration);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline concentration {
@@ -63,3 +52,7 @@ template<Representation Rep = double> using mol_per_m3 = units::isq::si::concent
 }  // namespace units::aliases::isq::si::inline concentration
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/concentration.h>
+#endif // UNITS_NO_LITERALS
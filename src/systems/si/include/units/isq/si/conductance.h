@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/conductance.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/reference.h>
 #include <units/symbol_text.h>
@@ -55,119 +56,27 @@ struct yottasiemens : prefixed_unit<yottasiemens, yotta, siemens> {};
 
 struct dim_conductance : isq::dim_conductance<dim_conductance, siemens, dim_resistance> {};
 
-template<UnitOf<dim_conductance> U, Representation Rep = double>
-using conductance = quantity<dim_conductance, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// R
-constexpr auto operator"" _q_S(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return conductance<siemens, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_S(long double l) { return conductance<siemens, long double>(l); }
-
-// yS
-constexpr auto operator"" _q_yS(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return conductance<yoctosiemens, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_yS(long double l) { return conductance<yoctosiemens, long double>(l); }
-
-// zS
-constexpr auto operator"" _q_zS(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return conductance<zeptosiemens, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_zS(long double l) { return conductance<zeptosiemens, long double>(l); }
-
-// aS
-constexpr auto operator"" _q_aS(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return conductance<attosiemens, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_aS(long double l) { return conductance<attosiemens, long double>(l); }
-
-// fS
-constexpr auto operator"" _q_fS(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return conductance<femtosiemens, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_fS(long double l) { return conductance<femtosiemens, long double>(l); }
-
-// pS
-constexpr auto operator"" _q_pS(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return conductance<picosiemens, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_pS(long double l) { return conductance<picosiemens, long double>(l); }
-
-// nS
-constexpr auto operator"" _q_nS(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return conductance<nanosiemens, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_nS(long double l) { return conductance<nanosiemens, long double>(l); }
-
-// µS
-constexpr auto operator"" _q_uS(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return conductance<microsiemens, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_uS(long double l) { return conductance<microsiemens, long double>(l); }
-
-// mS
-constexpr auto operator"" _q_mS(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return conductance<millisiemens, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_mS(long double l) { return conductance<millisiemens, long double>(l); }
-
-// kS
-constexpr auto operator"" _q_kS(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return conductance<kilosiemens, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_kS(long double l) { return conductance<kilosiemens, long double>(l); }
-
-// MS
-constexpr auto operator"" _q_MS(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return conductance<megasiemens, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_MS(long double l) { return conductance<megasiemens, long double>(l); }
-
-// GS
-constexpr auto operator"" _q_GS(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return conductance<gigasiemens, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_GS(long double l) { return conductance<gigasiemens, long double>(l); }
-
-// TS
-constexpr auto operator"" _q_TS(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return conductance<terasiemens, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_TS(long double l) { return conductance<terasiemens, long double>(l); }
-
-// PS
-constexpr auto operator"" _q_PS(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return conductance<petasiemens, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_PS(long double l) { return conductance<petasiemens, long double>(l); }
-
-// ES
-constexpr auto operator"" _q_ES(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return conductance<exasiemens, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_ES(long double l) { return conductance<exasiemens, long double>(l); }
-
-// ZS
-constexpr auto operator"" _q_ZS(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return conductance<zettasiemens, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_ZS(long double l) { return conductance<zettasiemens, long double>(l); }
-
-// YS
-constexpr auto operator"" _q_YS(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return conductance<yottasiemens, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_YS(long double l) { return conductance<yottasiemens, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
-#ifndef UNITS_NO_REFERENCES
-
-namespace conductance_references {
-
-inline constexpr auto S = reference<dim_conductance, siemens>{};
-inline constexpr auto yS = reference<dim_conductance, yoctosiemens>{};
-inline constexpr auto zS = reference<dim_conductance, zeptosiemens>{};
-inline constexpr auto aS = reference<dim_conductance, attosiemens>{};
-inline constexpr auto fS = reference<dim_conductance, femtosiemens>{};
-inline constexpr auto pS = reference<dim_conductance, picosiemens>{};
-inline constexpr auto nS = reference<dim_conductance, nanosiemens>{};
-inline constexpr auto uS = reference<dim_conductance, microsiemens>{};
-inline constexpr auto mS = reference<dim_conductance, millisiemens>{};
-inline constexpr auto kS = reference<dim_conductance, kilosiemens>{};
-inline constexpr auto MS = reference<dim_conductance, megasiemens>{};
-inline constexpr auto GS = reference<dim_conductance, gigasiemens>{};
-inline constexpr auto TS = reference<dim_conductance, terasiemens>{};
-inline constexpr auto PS = reference<dim_conductance, petasiemens>{};
-inline constexpr auto ES = reference<dim_conductance, exasiemens>{};
-inline constexpr auto ZS = reference<dim_conductance, zettasiemens>{};
-inline constexpr auto YS = reference<dim_conductance, yottasiemens>{};
-
-}  // namespace conductance_references
-
-namespace references {
-
-using namespace conductance_references;
-
-}  // namespace references
-
-#endif // UNITS_NO_REFERENCES
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::siemens);
+UNITS_DOWNCAST_REGISTER(units::isq::si::yoctosiemens);
+UNITS_DOWNCAST_REGISTER(units::isq::si::zeptosiemens);
+UNITS_DOWNCAST_REGISTER(units::isq::si::attosiemens);
+UNITS_DOWNCAST_REGISTER(units::isq::si::femtosiemens);
+UNITS_DOWNCAST_REGISTER(units::isq::si::picosiemens);
+UNITS_DOWNCAST_REGISTER(units::isq::si::nanosiemens);
+UNITS_DOWNCAST_REGISTER(units::isq::si::microsiemens);
+UNITS_DOWNCAST_REGISTER(units::isq::si::millisiemens);
+UNITS_DOWNCAST_REGISTER(units::isq::si::kilosiemens);
+UNITS_DOWNCAST_REGISTER(units::isq::si::megasiemens);
+UNITS_DOWNCAST_REGISTER(units::isq::si::gigasiemens);
+UNITS_DOWNCAST_REGISTER(units::isq::si::terasiemens);
+UNITS_DOWNCAST_REGISTER(units::isq::si::petasiemens);
+UNITS_DOWNCAST_REGISTER(units::isq::si::exasiemens);
+UNITS_DOWNCAST_REGISTER(units::isq::si::zettasiemens);
+UNITS_DOWNCAST_REGISTER(units::isq::si::yottasiemens);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_conductance);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline conductance {
@@ -193,3 +102,11 @@ template<Representation Rep = double> using YS = units::isq::si::conductance<uni
 }  // namespace units::aliases::isq::si::inline conductance
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/conductance.h>
+#endif // UNITS_NO_LITERALS
+
+#ifndef UNITS_NO_REFERENCES
+#include <units/isq/si/references/conductance.h>
+#endif // UNITS_NO_REFERENCES
@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/current_density.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/symbol_text.h>
 // IWYU pragma: end_exports
@@ -39,23 +40,11 @@ struct ampere_per_metre_sq : unit<ampere_per_metre_sq> {};
 
 struct dim_current_density : isq::dim_current_density<dim_current_density, ampere_per_metre_sq, dim_electric_current, dim_length> {};
 
-template<UnitOf<dim_current_density> U, Representation Rep = double>
-using current_density = quantity<dim_current_density, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// A / m²
-constexpr auto operator"" _q_A_per_m2(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return current_density<ampere_per_metre_sq, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_A_per_m2(long double l) { return current_density<ampere_per_metre_sq, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::ampere_per_metre_sq);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_current_density);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline current_density {
@@ -65,3 +54,7 @@ template<Representation Rep = double> using A_per_m2 = units::isq::si::current_d
 }  // namespace units::aliases::isq::si::inline current_density
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/current_density.h>
+#endif // UNITS_NO_LITERALS
@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/density.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/symbol_text.h>
 // IWYU pragma: end_exports
@@ -39,23 +40,11 @@ struct kilogram_per_metre_cub : unit<kilogram_per_metre_cub> {};
 
 struct dim_density : isq::dim_density<dim_density, kilogram_per_metre_cub, dim_mass, dim_length> {};
 
-template<UnitOf<dim_density> U, Representation Rep = double>
-using density = quantity<dim_density, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// kg / m³
-constexpr auto operator"" _q_kg_per_m3(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return density<kilogram_per_metre_cub, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_kg_per_m3(long double l) { return density<kilogram_per_metre_cub, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::kilogram_per_metre_cub);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_density);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline density {
@@ -65,3 +54,7 @@ template<Representation Rep = double> using kg_per_m3 = units::isq::si::density<
 }  // namespace units::aliases::isq::si::inline density
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/density.h>
+#endif // UNITS_NO_LITERALS
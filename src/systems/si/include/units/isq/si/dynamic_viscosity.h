@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/dynamic_viscosity.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/symbol_text.h>
 // IWYU pragma: end_exports
@@ -37,23 +38,11 @@ namespace units::isq::si {
 struct pascal_second : unit<pascal_second> {};
 struct dim_dynamic_viscosity : isq::dim_dynamic_viscosity<dim_dynamic_viscosity, pascal_second, dim_pressure, dim_time> {};
 
-template<UnitOf<dim_dynamic_viscosity> U, Representation Rep = double>
-using dynamic_viscosity = quantity<dim_dynamic_viscosity, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// Pa·s
-constexpr auto operator"" _q_Pa_s(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return dynamic_viscosity<pascal_second, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_Pa_s(long double l) { return dynamic_viscosity<pascal_second, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::pascal_second);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_dynamic_viscosity);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline dynamic_viscosity {
@@ -63,3 +52,7 @@ template<Representation Rep = double> using Pa_s = units::isq::si::dynamic_visco
 }  // namespace units::aliases::isq::si::inline dynamic_viscosity
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/dynamic_viscosity.h>
+#endif // UNITS_NO_LITERALS
@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/electric_charge.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/reference.h>
 #include <units/symbol_text.h>
@@ -39,39 +40,11 @@ struct coulomb : named_unit<coulomb, "C", prefix> {};
 
 struct dim_electric_charge : isq::dim_electric_charge<dim_electric_charge, coulomb, dim_time, dim_electric_current> {};
 
-template<UnitOf<dim_electric_charge> U, Representation Rep = double>
-using electric_charge = quantity<dim_electric_charge, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// C
-constexpr auto operator"" _q_C(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return electric_charge<coulomb, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_C(long double l) { return electric_charge<coulomb, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
-#ifndef UNITS_NO_REFERENCES
-
-namespace electric_charge_references {
-
-inline constexpr auto C = reference<dim_electric_charge, coulomb>{};
-
-}  // namespace electric_charge_references
-
-namespace references {
-
-using namespace electric_charge_references;
-
-}  // namespace references
-
-#endif // UNITS_NO_REFERENCES
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::coulomb);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_electric_charge);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline electric_charge {
@@ -81,3 +54,11 @@ template<Representation Rep = double> using C = units::isq::si::electric_charge<
 }  // namespace units::aliases::isq::si::inline electric_charge
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/electric_charge.h>
+#endif // UNITS_NO_LITERALS
+
+#ifndef UNITS_NO_REFERENCES
+#include <units/isq/si/references/electric_charge.h>
+#endif // UNITS_NO_REFERENCES
@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/electric_current.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/reference.h>
 #include <units/symbol_text.h>
@@ -58,139 +59,30 @@ struct yottaampere : prefixed_unit<yottaampere, yotta, ampere> {};
 
 struct dim_electric_current : isq::dim_electric_current<ampere> {};
 
-template<UnitOf<dim_electric_current> U, Representation Rep = double>
-using electric_current = quantity<dim_electric_current, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// A
-constexpr auto operator"" _q_A(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return electric_current<ampere, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_A(long double l) { return electric_current<ampere, long double>(l); }
-
-// yA
-constexpr auto operator"" _q_yA(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return electric_current<yoctoampere, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_yA(long double l) { return electric_current<yoctoampere, long double>(l); }
-
-// zA
-constexpr auto operator"" _q_zA(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return electric_current<zeptoampere, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_zA(long double l) { return electric_current<zeptoampere, long double>(l); }
-
-// aA
-constexpr auto operator"" _q_aA(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return electric_current<attoampere, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_aA(long double l) { return electric_current<attoampere, long double>(l); }
-
-// fA
-constexpr auto operator"" _q_fA(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return electric_current<femtoampere, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_fA(long double l) { return electric_current<femtoampere, long double>(l); }
-
-// pA
-constexpr auto operator"" _q_pA(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return electric_current<picoampere, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_pA(long double l) { return electric_current<picoampere, long double>(l); }
-
-// nA
-constexpr auto operator"" _q_nA(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return electric_current<nanoampere, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_nA(long double l) { return electric_current<nanoampere, long double>(l); }
-
-// uA
-constexpr auto operator"" _q_uA(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return electric_current<microampere, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_uA(long double l) { return electric_current<microampere, long double>(l); }
-
-// mA
-constexpr auto operator"" _q_mA(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return electric_current<milliampere, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_mA(long double l) { return electric_current<milliampere, long double>(l); }
-
-// cA
-constexpr auto operator"" _q_cA(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return electric_current<centiampere, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_cA(long double l) { return electric_current<centiampere, long double>(l); }
-
-// dA
-constexpr auto operator"" _q_dA(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return electric_current<deciampere, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_dA(long double l) { return electric_current<deciampere, long double>(l); }
-
-// daA
-constexpr auto operator"" _q_daA(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return electric_current<decaampere, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_daA(long double l) { return electric_current<decaampere, long double>(l); }
-
-// hA
-constexpr auto operator"" _q_hA(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return electric_current<hectoampere, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_hA(long double l) { return electric_current<hectoampere, long double>(l); }
-
-// kA
-constexpr auto operator"" _q_kA(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return electric_current<kiloampere, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_kA(long double l) { return electric_current<kiloampere, long double>(l); }
-
-// MA
-constexpr auto operator"" _q_MA(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return electric_current<megaampere, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_MA(long double l) { return electric_current<megaampere, long double>(l); }
-
-// GA
-constexpr auto operator"" _q_GA(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return electric_current<gigaampere, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_GA(long double l) { return electric_current<gigaampere, long double>(l); }
-
-// TA
-constexpr auto operator"" _q_TA(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return electric_current<teraampere, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_TA(long double l) { return electric_current<teraampere, long double>(l); }
-
-// PA
-constexpr auto operator"" _q_PA(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return electric_current<petaampere, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_PA(long double l) { return electric_current<petaampere, long double>(l); }
-
-// EA
-constexpr auto operator"" _q_EA(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return electric_current<exaampere, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_EA(long double l) { return electric_current<exaampere, long double>(l); }
-
-// ZA
-constexpr auto operator"" _q_ZA(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return electric_current<zettaampere, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_ZA(long double l) { return electric_current<zettaampere, long double>(l); }
-
-// YA
-constexpr auto operator"" _q_YA(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return electric_current<yottaampere, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_YA(long double l) { return electric_current<yottaampere, long double>(l); }
-
-} // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
-#ifndef UNITS_NO_REFERENCES
-
-namespace electric_current_references {
-
-inline constexpr auto A = reference<dim_electric_current, ampere>{};
-inline constexpr auto yA = reference<dim_electric_current, yoctoampere>{};
-inline constexpr auto zA = reference<dim_electric_current, zeptoampere>{};
-inline constexpr auto aA = reference<dim_electric_current, attoampere>{};
-inline constexpr auto fA = reference<dim_electric_current, femtoampere>{};
-inline constexpr auto pA = reference<dim_electric_current, picoampere>{};
-inline constexpr auto nA = reference<dim_electric_current, nanoampere>{};
-inline constexpr auto uA = reference<dim_electric_current, microampere>{};
-inline constexpr auto mA = reference<dim_electric_current, milliampere>{};
-inline constexpr auto cA = reference<dim_electric_current, centiampere>{};
-inline constexpr auto dA = reference<dim_electric_current, deciampere>{};
-inline constexpr auto daA = reference<dim_electric_current, decaampere>{};
-inline constexpr auto hA = reference<dim_electric_current, hectoampere>{};
-inline constexpr auto kA = reference<dim_electric_current, kiloampere>{};
-inline constexpr auto MA = reference<dim_electric_current, megaampere>{};
-inline constexpr auto GA = reference<dim_electric_current, gigaampere>{};
-inline constexpr auto TA = reference<dim_electric_current, teraampere>{};
-inline constexpr auto PA = reference<dim_electric_current, petaampere>{};
-inline constexpr auto EA = reference<dim_electric_current, exaampere>{};
-inline constexpr auto ZA = reference<dim_electric_current, zettaampere>{};
-inline constexpr auto YA = reference<dim_electric_current, yottaampere>{};
-
-}  // namespace electric_current_references
-
-namespace references {
-
-using namespace electric_current_references;
-
-}  // namespace references
-
-#endif // UNITS_NO_REFERENCES
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::ampere);
+UNITS_DOWNCAST_REGISTER(units::isq::si::yoctoampere);
+UNITS_DOWNCAST_REGISTER(units::isq::si::zeptoampere);
+UNITS_DOWNCAST_REGISTER(units::isq::si::attoampere);
+UNITS_DOWNCAST_REGISTER(units::isq::si::femtoampere);
+UNITS_DOWNCAST_REGISTER(units::isq::si::picoampere);
+UNITS_DOWNCAST_REGISTER(units::isq::si::nanoampere);
+UNITS_DOWNCAST_REGISTER(units::isq::si::microampere);
+UNITS_DOWNCAST_REGISTER(units::isq::si::milliampere);
+UNITS_DOWNCAST_REGISTER(units::isq::si::centiampere);
+UNITS_DOWNCAST_REGISTER(units::isq::si::deciampere);
+UNITS_DOWNCAST_REGISTER(units::isq::si::decaampere);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hectoampere);
+UNITS_DOWNCAST_REGISTER(units::isq::si::kiloampere);
+UNITS_DOWNCAST_REGISTER(units::isq::si::megaampere);
+UNITS_DOWNCAST_REGISTER(units::isq::si::gigaampere);
+UNITS_DOWNCAST_REGISTER(units::isq::si::teraampere);
+UNITS_DOWNCAST_REGISTER(units::isq::si::petaampere);
+UNITS_DOWNCAST_REGISTER(units::isq::si::exaampere);
+UNITS_DOWNCAST_REGISTER(units::isq::si::zettaampere);
+UNITS_DOWNCAST_REGISTER(units::isq::si::yottaampere);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline electric_current {
@@ -220,3 +112,11 @@ template<Representation Rep = double> using YA = units::isq::si::electric_curren
 }  // namespace units::aliases::isq::si::inline electric_current
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/electric_current.h>
+#endif // UNITS_NO_LITERALS
+
+#ifndef UNITS_NO_REFERENCES
+#include <units/isq/si/references/electric_current.h>
+#endif // UNITS_NO_REFERENCES
@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/electric_field_strength.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/symbol_text.h>
 // IWYU pragma: end_exports
@@ -36,23 +37,11 @@ namespace units::isq::si {
 struct volt_per_metre : unit<volt_per_metre> {};
 struct dim_electric_field_strength : isq::dim_electric_field_strength<dim_electric_field_strength, volt_per_metre, dim_voltage, dim_length> {};
 
-template<UnitOf<dim_electric_field_strength> U, Representation Rep = double>
-using electric_field_strength = quantity<dim_electric_field_strength, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// V/m
-constexpr auto operator"" _q_V_per_m(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return electric_field_strength<volt_per_metre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_V_per_m(long double l) { return electric_field_strength<volt_per_metre, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::volt_per_metre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_electric_field_strength);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline electric_field_strength {
@@ -62,3 +51,7 @@ template<Representation Rep = double> using V_per_m = units::isq::si::electric_f
 }  // namespace units::aliases::isq::si::inline electric_field_strength
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/electric_field_strength.h>
+#endif // UNITS_NO_LITERALS
@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/energy.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/reference.h>
 #include <units/symbol_text.h>
@@ -59,130 +60,29 @@ struct gigaelectronvolt : prefixed_unit<gigaelectronvolt, giga, electronvolt> {}
 
 struct dim_energy : isq::dim_energy<dim_energy, joule, dim_force, dim_length> {};
 
-template<UnitOf<dim_energy> U, Representation Rep = double>
-using energy = quantity<dim_energy, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// J
-constexpr auto operator"" _q_J(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return energy<joule, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_J(long double l) { return energy<joule, long double>(l); }
-
-// yJ
-constexpr auto operator"" _q_yJ(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return energy<yoctojoule, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_yJ(long double l) { return energy<yoctojoule, long double>(l); }
-
-// zJ
-constexpr auto operator"" _q_zJ(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return energy<zeptojoule, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_zJ(long double l) { return energy<zeptojoule, long double>(l); }
-
-// aJ
-constexpr auto operator"" _q_aJ(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return energy<attojoule, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_aJ(long double l) { return energy<attojoule, long double>(l); }
-
-// fJ
-constexpr auto operator"" _q_fJ(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return energy<femtojoule, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_fJ(long double l) { return energy<femtojoule, long double>(l); }
-
-// pJ
-constexpr auto operator"" _q_pJ(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return energy<picojoule, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_pJ(long double l) { return energy<picojoule, long double>(l); }
-
-// nJ
-constexpr auto operator"" _q_nJ(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return energy<nanojoule, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_nJ(long double l) { return energy<nanojoule, long double>(l); }
-
-// uJ
-constexpr auto operator"" _q_uJ(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return energy<microjoule, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_uJ(long double l) { return energy<microjoule, long double>(l); }
-
-// mJ
-constexpr auto operator"" _q_mJ(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return energy<millijoule, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_mJ(long double l) { return energy<millijoule, long double>(l); }
-
-// kJ
-constexpr auto operator"" _q_kJ(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return energy<kilojoule, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_kJ(long double l) { return energy<kilojoule, long double>(l); }
-
-// MJ
-constexpr auto operator"" _q_MJ(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return energy<megajoule, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_MJ(long double l) { return energy<megajoule, long double>(l); }
-
-// GJ
-constexpr auto operator"" _q_GJ(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return energy<gigajoule, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_GJ(long double l) { return energy<gigajoule, long double>(l); }
-
-// TJ
-constexpr auto operator"" _q_TJ(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return energy<terajoule, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_TJ(long double l) { return energy<terajoule, long double>(l); }
-
-// PJ
-constexpr auto operator"" _q_PJ(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return energy<petajoule, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_PJ(long double l) { return energy<petajoule, long double>(l); }
-
-// EJ
-constexpr auto operator"" _q_EJ(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return energy<exajoule, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_EJ(long double l) { return energy<exajoule, long double>(l); }
-
-// ZJ
-constexpr auto operator"" _q_ZJ(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return energy<zettajoule, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_ZJ(long double l) { return energy<zettajoule, long double>(l); }
-
-// YJ
-constexpr auto operator"" _q_YJ(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return energy<yottajoule, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_YJ(long double l) { return energy<yottajoule, long double>(l); }
-
-// eV
-constexpr auto operator"" _q_eV(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return energy<electronvolt, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_eV(long double l) { return energy<electronvolt, long double>(l); }
-
-// GeV
-constexpr auto operator"" _q_GeV(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return energy<gigaelectronvolt, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_GeV(long double l) { return energy<gigaelectronvolt, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
-#ifndef UNITS_NO_REFERENCES
-
-namespace energy_references {
-
-inline constexpr auto J = reference<dim_energy, joule>{};
-inline constexpr auto yJ = reference<dim_energy, yoctojoule>{};
-inline constexpr auto zJ = reference<dim_energy, zeptojoule>{};
-inline constexpr auto aJ = reference<dim_energy, attojoule>{};
-inline constexpr auto fJ = reference<dim_energy, femtojoule>{};
-inline constexpr auto pJ = reference<dim_energy, picojoule>{};
-inline constexpr auto nJ = reference<dim_energy, nanojoule>{};
-inline constexpr auto uJ = reference<dim_energy, microjoule>{};
-inline constexpr auto mJ = reference<dim_energy, millijoule>{};
-inline constexpr auto kJ = reference<dim_energy, kilojoule>{};
-inline constexpr auto MJ = reference<dim_energy, megajoule>{};
-inline constexpr auto GJ = reference<dim_energy, gigajoule>{};
-inline constexpr auto TJ = reference<dim_energy, terajoule>{};
-inline constexpr auto PJ = reference<dim_energy, petajoule>{};
-inline constexpr auto EJ = reference<dim_energy, exajoule>{};
-inline constexpr auto ZJ = reference<dim_energy, zettajoule>{};
-inline constexpr auto YJ = reference<dim_energy, yottajoule>{};
-
-inline constexpr auto eV = reference<dim_energy, electronvolt>{};
-inline constexpr auto GeV = reference<dim_energy, gigaelectronvolt>{};
-
-}  // namespace energy_references
-
-namespace references {
-
-using namespace energy_references;
-
-}  // namespace references
-
-#endif // UNITS_NO_REFERENCES
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::joule);
+UNITS_DOWNCAST_REGISTER(units::isq::si::yoctojoule);
+UNITS_DOWNCAST_REGISTER(units::isq::si::zeptojoule);
+UNITS_DOWNCAST_REGISTER(units::isq::si::attojoule);
+UNITS_DOWNCAST_REGISTER(units::isq::si::femtojoule);
+UNITS_DOWNCAST_REGISTER(units::isq::si::picojoule);
+UNITS_DOWNCAST_REGISTER(units::isq::si::nanojoule);
+UNITS_DOWNCAST_REGISTER(units::isq::si::microjoule);
+UNITS_DOWNCAST_REGISTER(units::isq::si::millijoule);
+UNITS_DOWNCAST_REGISTER(units::isq::si::kilojoule);
+UNITS_DOWNCAST_REGISTER(units::isq::si::megajoule);
+UNITS_DOWNCAST_REGISTER(units::isq::si::gigajoule);
+UNITS_DOWNCAST_REGISTER(units::isq::si::terajoule);
+UNITS_DOWNCAST_REGISTER(units::isq::si::petajoule);
+UNITS_DOWNCAST_REGISTER(units::isq::si::exajoule);
+UNITS_DOWNCAST_REGISTER(units::isq::si::zettajoule);
+UNITS_DOWNCAST_REGISTER(units::isq::si::yottajoule);
+UNITS_DOWNCAST_REGISTER(units::isq::si::electronvolt);
+UNITS_DOWNCAST_REGISTER(units::isq::si::gigaelectronvolt);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_energy);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline energy {
@@ -211,3 +111,11 @@ template<Representation Rep = double> using GeV = units::isq::si::energy<units::
 }  // namespace units::aliases::isq::si::inline energy
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/energy.h>
+#endif // UNITS_NO_LITERALS
+
+#ifndef UNITS_NO_REFERENCES
+#include <units/isq/si/references/energy.h>
+#endif // UNITS_NO_REFERENCES
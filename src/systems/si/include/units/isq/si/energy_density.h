@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/energy_density.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/symbol_text.h>
 // IWYU pragma: end_exports
@@ -37,23 +38,11 @@ namespace units::isq::si {
 struct joule_per_metre_cub : unit<joule_per_metre_cub> {};
 struct dim_energy_density : isq::dim_energy_density<dim_energy_density, joule_per_metre_cub, dim_energy, dim_volume> {};
 
-template<UnitOf<dim_energy_density> U, Representation Rep = double>
-using energy_density = quantity<dim_energy_density, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// N/m
-constexpr auto operator"" _q_J_per_m3(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return energy_density<joule_per_metre_cub, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_J_per_m3(long double l) { return energy_density<joule_per_metre_cub, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::joule_per_metre_cub);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_energy_density);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline energy_density {
@@ -63,3 +52,7 @@ template<Representation Rep = double> using J_per_m3 = units::isq::si::energy_de
 }  // namespace units::aliases::isq::si::inline energy_density
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/energy_density.h>
+#endif // UNITS_NO_LITERALS
@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/force.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/reference.h>
 #include <units/symbol_text.h>
@@ -60,139 +61,31 @@ struct yottanewton : prefixed_unit<yottanewton, yotta, newton> {};
 
 struct dim_force : isq::dim_force<dim_force, newton, dim_mass, dim_acceleration> {};
 
-template<UnitOf<dim_force> U, Representation Rep = double>
-using force = quantity<dim_force, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// N
-constexpr auto operator"" _q_N(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return force<newton, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_N(long double l) { return force<newton, long double>(l); }
-
-// yN
-constexpr auto operator"" _q_yN(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return force<yoctonewton, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_yN(long double l) { return force<yoctonewton, long double>(l); }
-
-// zN
-constexpr auto operator"" _q_zN(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return force<zeptonewton, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_zN(long double l) { return force<zeptonewton, long double>(l); }
-
-// aN
-constexpr auto operator"" _q_aN(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return force<attonewton, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_aN(long double l) { return force<attonewton, long double>(l); }
-
-// fN
-constexpr auto operator"" _q_fN(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return force<femtonewton, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_fN(long double l) { return force<femtonewton, long double>(l); }
-
-// pN
-constexpr auto operator"" _q_pN(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return force<piconewton, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_pN(long double l) { return force<piconewton, long double>(l); }
-
-// nN
-constexpr auto operator"" _q_nN(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return force<nanonewton, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_nN(long double l) { return force<nanonewton, long double>(l); }
-
-// uN
-constexpr auto operator"" _q_uN(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return force<micronewton, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_uN(long double l) { return force<micronewton, long double>(l); }
-
-// mN
-constexpr auto operator"" _q_mN(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return force<millinewton, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_mN(long double l) { return force<millinewton, long double>(l); }
-
-// cN
-constexpr auto operator"" _q_cN(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return force<centinewton, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_cN(long double l) { return force<centinewton, long double>(l); }
-
-// dN
-constexpr auto operator"" _q_dN(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return force<decinewton, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_dN(long double l) { return force<decinewton, long double>(l); }
-
-// daN
-constexpr auto operator"" _q_daN(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return force<decanewton, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_daN(long double l) { return force<decanewton, long double>(l); }
-
-// hN
-constexpr auto operator"" _q_hN(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return force<hectonewton, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_hN(long double l) { return force<hectonewton, long double>(l); }
-
-// kN
-constexpr auto operator"" _q_kN(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return force<kilonewton, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_kN(long double l) { return force<kilonewton, long double>(l); }
-
-// MN
-constexpr auto operator"" _q_MN(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return force<meganewton, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_MN(long double l) { return force<meganewton, long double>(l); }
-
-// GN
-constexpr auto operator"" _q_GN(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return force<giganewton, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_GN(long double l) { return force<giganewton, long double>(l); }
-
-// TN
-constexpr auto operator"" _q_TN(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return force<teranewton, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_TN(long double l) { return force<teranewton, long double>(l); }
-
-// PN
-constexpr auto operator"" _q_PN(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return force<petanewton, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_PN(long double l) { return force<petanewton, long double>(l); }
-
-// EN
-constexpr auto operator"" _q_EN(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return force<exanewton, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_EN(long double l) { return force<exanewton, long double>(l); }
-
-// ZN
-constexpr auto operator"" _q_ZN(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return force<zettanewton, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_ZN(long double l) { return force<zettanewton, long double>(l); }
-
-// YN
-constexpr auto operator"" _q_YN(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return force<yottanewton, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_YN(long double l) { return force<yottanewton, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
-#ifndef UNITS_NO_REFERENCES
-
-namespace force_references {
-
-inline constexpr auto N = reference<dim_force, newton>{};
-inline constexpr auto yN = reference<dim_force, yoctonewton>{};
-inline constexpr auto zN = reference<dim_force, zeptonewton>{};
-inline constexpr auto aN = reference<dim_force, attonewton>{};
-inline constexpr auto fN = reference<dim_force, femtonewton>{};
-inline constexpr auto pN = reference<dim_force, piconewton>{};
-inline constexpr auto nN = reference<dim_force, nanonewton>{};
-inline constexpr auto uN = reference<dim_force, micronewton>{};
-inline constexpr auto mN = reference<dim_force, millinewton>{};
-inline constexpr auto cN = reference<dim_force, centinewton>{};
-inline constexpr auto dN = reference<dim_force, decinewton>{};
-inline constexpr auto daN = reference<dim_force, decanewton>{};
-inline constexpr auto hN = reference<dim_force, hectonewton>{};
-inline constexpr auto kN = reference<dim_force, kilonewton>{};
-inline constexpr auto MN = reference<dim_force, meganewton>{};
-inline constexpr auto GN = reference<dim_force, giganewton>{};
-inline constexpr auto TN = reference<dim_force, teranewton>{};
-inline constexpr auto PN = reference<dim_force, petanewton>{};
-inline constexpr auto EN = reference<dim_force, exanewton>{};
-inline constexpr auto ZN = reference<dim_force, zettanewton>{};
-inline constexpr auto YN = reference<dim_force, yottanewton>{};
-
-}  // namespace force_references
-
-namespace references {
-
-using namespace force_references;
-
-}  // namespace references
-
-#endif // UNITS_NO_REFERENCES
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::newton);
+UNITS_DOWNCAST_REGISTER(units::isq::si::yoctonewton);
+UNITS_DOWNCAST_REGISTER(units::isq::si::zeptonewton);
+UNITS_DOWNCAST_REGISTER(units::isq::si::attonewton);
+UNITS_DOWNCAST_REGISTER(units::isq::si::femtonewton);
+UNITS_DOWNCAST_REGISTER(units::isq::si::piconewton);
+UNITS_DOWNCAST_REGISTER(units::isq::si::nanonewton);
+UNITS_DOWNCAST_REGISTER(units::isq::si::micronewton);
+UNITS_DOWNCAST_REGISTER(units::isq::si::millinewton);
+UNITS_DOWNCAST_REGISTER(units::isq::si::centinewton);
+UNITS_DOWNCAST_REGISTER(units::isq::si::decinewton);
+UNITS_DOWNCAST_REGISTER(units::isq::si::decanewton);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hectonewton);
+UNITS_DOWNCAST_REGISTER(units::isq::si::kilonewton);
+UNITS_DOWNCAST_REGISTER(units::isq::si::meganewton);
+UNITS_DOWNCAST_REGISTER(units::isq::si::giganewton);
+UNITS_DOWNCAST_REGISTER(units::isq::si::teranewton);
+UNITS_DOWNCAST_REGISTER(units::isq::si::petanewton);
+UNITS_DOWNCAST_REGISTER(units::isq::si::exanewton);
+UNITS_DOWNCAST_REGISTER(units::isq::si::zettanewton);
+UNITS_DOWNCAST_REGISTER(units::isq::si::yottanewton);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_force);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline force {
@@ -222,3 +115,11 @@ template<Representation Rep = double> using YN = units::isq::si::force<units::is
 }  // namespace units::aliases::isq::si::inline force
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/force.h>
+#endif // UNITS_NO_LITERALS
+
+#ifndef UNITS_NO_REFERENCES
+#include <units/isq/si/references/force.h>
+#endif // UNITS_NO_REFERENCES
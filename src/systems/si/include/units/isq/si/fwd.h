@@ -0,0 +1,816 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/fwd.h>
+
+/**
+ * @file
+ * @brief Forward declarations of the SI units, dimensions, and quantity aliases
+ *
+ * Allows naming SI quantity types in generic declarations (i.e. @c si::length<U>) without
+ * including the definitions of the units, their literals, and references. The headers of
+ * the dimensions include this file and define the declared types. Naming a concrete quantity
+ * type still requires the definitions of its dimension and unit to satisfy the constraints.
+ *
+ * The headers of derived dimensions cannot use it instead of the headers of their ingredients.
+ * Defining a derived dimension sorts its exponents by the symbols of the base dimensions and
+ * computes the ratio of its base units, and defining a derived or prefixed unit computes its ratio
+ * from the ingredient units, so all of them have to be complete types.
+ */
+
+namespace units::isq::si {
+
+// absorbed_dose.h
+struct gray;
+struct yoctogray;
+struct zeptogray;
+struct attogray;
+struct femtogray;
+struct picogray;
+struct nanogray;
+struct microgray;
+struct milligray;
+struct centigray;
+struct decigray;
+struct decagray;
+struct hectogray;
+struct kilogray;
+struct megagray;
+struct gigagray;
+struct teragray;
+struct petagray;
+struct exagray;
+struct zettagray;
+struct yottagray;
+struct dim_absorbed_dose;
+
+template<UnitOf<dim_absorbed_dose> U, Representation Rep = double>
+using absorbed_dose = quantity<dim_absorbed_dose, U, Rep>;
+
+// acceleration.h
+struct metre_per_second_sq;
+struct dim_acceleration;
+
+template<UnitOf<dim_acceleration> U, Representation Rep = double>
+using acceleration = quantity<dim_acceleration, U, Rep>;
+
+// amount_of_substance.h
+struct mole;
+struct dim_amount_of_substance;
+
+template<UnitOf<dim_amount_of_substance> U, Representation Rep = double>
+using amount_of_substance = quantity<dim_amount_of_substance, U, Rep>;
+
+// angular_velocity.h
+struct radian_per_second;
+struct dim_angular_velocity;
+
+template<UnitOf<dim_angular_velocity> U, Representation Rep = double>
+using angular_velocity = quantity<dim_angular_velocity, U, Rep>;
+
+// area.h
+struct square_metre;
+struct dim_area;
+struct square_yoctometre;
+struct square_zeptometre;
+struct square_attometre;
+struct square_femtometre;
+struct square_picometre;
+struct square_nanometre;
+struct square_micrometre;
+struct square_millimetre;
+struct square_centimetre;
+struct square_decimetre;
+struct square_decametre;
+struct square_hectometre;
+struct square_kilometre;
+struct square_megametre;
+struct square_gigametre;
+struct square_terametre;
+struct square_petametre;
+struct square_exametre;
+struct square_zettametre;
+struct square_yottametre;
+struct hectare;
+
+template<UnitOf<dim_area> U, Representation Rep = double>
+using area = quantity<dim_area, U, Rep>;
+
+// capacitance.h
+struct farad;
+struct yoctofarad;
+struct zeptofarad;
+struct attofarad;
+struct femtofarad;
+struct picofarad;
+struct nanofarad;
+struct microfarad;
+struct millifarad;
+struct centifarad;
+struct decifarad;
+struct decafarad;
+struct hectofarad;
+struct kilofarad;
+struct megafarad;
+struct gigafarad;
+struct terafarad;
+struct petafarad;
+struct exafarad;
+struct zettafarad;
+struct yottafarad;
+struct dim_capacitance;
+
+template<UnitOf<dim_capacitance> U, Representation Rep = double>
+using capacitance = quantity<dim_capacitance, U, Rep>;
+
+// catalytic_activity.h
+struct katal;
+struct yoctokatal;
+struct zeptokatal;
+struct attokatal;
+struct femtokatal;
+struct picokatal;
+struct nanokatal;
+struct microkatal;
+struct millikatal;
+struct centikatal;
+struct decikatal;
+struct decakatal;
+struct hectokatal;
+struct kilokatal;
+struct megakatal;
+struct gigakatal;
+struct terakatal;
+struct petakatal;
+struct exakatal;
+struct zettakatal;
+struct yottakatal;
+struct enzyme_unit;
+struct dim_catalytic_activity;
+
+template<UnitOf<dim_catalytic_activity> U, Representation Rep = double>
+using catalytic_activity = quantity<dim_catalytic_activity, U, Rep>;
+
+// charge_density.h
+struct coulomb_per_metre_cub;
+struct coulomb_per_metre_sq;
+struct dim_charge_density;
+struct dim_surface_charge_density;
+
+template<UnitOf<dim_charge_density> U, Representation Rep = double>
+using charge_density = quantity<dim_charge_density, U, Rep>;
+
+template<UnitOf<dim_surface_charge_density> U, Representation Rep = double>
+using surface_charge_density = quantity<dim_surface_charge_density, U, Rep>;
+
+// concentration.h
+struct mol_per_metre_cub;
+struct dim_concentration;
+
+template<UnitOf<dim_concentration> U, Representation Rep = double>
+using concentration = quantity<dim_concentration, U, Rep>;
+
+// conductance.h
+struct siemens;
+struct yoctosiemens;
+struct zeptosiemens;
+struct attosiemens;
+struct femtosiemens;
+struct picosiemens;
+struct nanosiemens;
+struct microsiemens;
+struct millisiemens;
+struct kilosiemens;
+struct megasiemens;
+struct gigasiemens;
+struct terasiemens;
+struct petasiemens;
+struct exasiemens;
+struct zettasiemens;
+struct yottasiemens;
+struct dim_conductance;
+
+template<UnitOf<dim_conductance> U, Representation Rep = double>
+using conductance = quantity<dim_conductance, U, Rep>;
+
+// current_density.h
+struct ampere_per_metre_sq;
+struct dim_current_density;
+
+template<UnitOf<dim_current_density> U, Representation Rep = double>
+using current_density = quantity<dim_current_density, U, Rep>;
+
+// density.h
+struct kilogram_per_metre_cub;
+struct dim_density;
+
+template<UnitOf<dim_density> U, Representation Rep = double>
+using density = quantity<dim_density, U, Rep>;
+
+// dynamic_viscosity.h
+struct pascal_second;
+struct dim_dynamic_viscosity;
+
+template<UnitOf<dim_dynamic_viscosity> U, Representation Rep = double>
+using dynamic_viscosity = quantity<dim_dynamic_viscosity, U, Rep>;
+
+// electric_charge.h
+struct coulomb;
+struct dim_electric_charge;
+
+template<UnitOf<dim_electric_charge> U, Representation Rep = double>
+using electric_charge = quantity<dim_electric_charge, U, Rep>;
+
+// electric_current.h
+struct ampere;
+struct yoctoampere;
+struct zeptoampere;
+struct attoampere;
+struct femtoampere;
+struct picoampere;
+struct nanoampere;
+struct microampere;
+struct milliampere;
+struct centiampere;
+struct deciampere;
+struct decaampere;
+struct hectoampere;
+struct kiloampere;
+struct megaampere;
+struct gigaampere;
+struct teraampere;
+struct petaampere;
+struct exaampere;
+struct zettaampere;
+struct yottaampere;
+struct dim_electric_current;
+
+template<UnitOf<dim_electric_current> U, Representation Rep = double>
+using electric_current = quantity<dim_electric_current, U, Rep>;
+
+// electric_field_strength.h
+struct volt_per_metre;
+struct dim_electric_field_strength;
+
+template<UnitOf<dim_electric_field_strength> U, Representation Rep = double>
+using electric_field_strength = quantity<dim_electric_field_strength, U, Rep>;
+
+// energy.h
+struct joule;
+struct yoctojoule;
+struct zeptojoule;
+struct attojoule;
+struct femtojoule;
+struct picojoule;
+struct nanojoule;
+struct microjoule;
+struct millijoule;
+struct kilojoule;
+struct megajoule;
+struct gigajoule;
+struct terajoule;
+struct petajoule;
+struct exajoule;
+struct zettajoule;
+struct yottajoule;
+struct electronvolt;
+struct gigaelectronvolt;
+struct dim_energy;
+
+template<UnitOf<dim_energy> U, Representation Rep = double>
+using energy = quantity<dim_energy, U, Rep>;
+
+// energy_density.h
+struct joule_per_metre_cub;
+struct dim_energy_density;
+
+template<UnitOf<dim_energy_density> U, Representation Rep = double>
+using energy_density = quantity<dim_energy_density, U, Rep>;
+
+// force.h
+struct newton;
+struct yoctonewton;
+struct zeptonewton;
+struct attonewton;
+struct femtonewton;
+struct piconewton;
+struct nanonewton;
+struct micronewton;
+struct millinewton;
+struct centinewton;
+struct decinewton;
+struct decanewton;
+struct hectonewton;
+struct kilonewton;
+struct meganewton;
+struct giganewton;
+struct teranewton;
+struct petanewton;
+struct exanewton;
+struct zettanewton;
+struct yottanewton;
+struct dim_force;
+
+template<UnitOf<dim_force> U, Representation Rep = double>
+using force = quantity<dim_force, U, Rep>;
+
+// frequency.h
+struct hertz;
+struct yoctohertz;
+struct zeptohertz;
+struct attohertz;
+struct femtohertz;
+struct picohertz;
+struct nanohertz;
+struct microhertz;
+struct millihertz;
+struct kilohertz;
+struct megahertz;
+struct gigahertz;
+struct terahertz;
+struct petahertz;
+struct exahertz;
+struct zettahertz;
+struct yottahertz;
+struct dim_frequency;
+
+template<UnitOf<dim_frequency> U, Representation Rep = double>
+using frequency = quantity<dim_frequency, U, Rep>;
+
+// heat_capacity.h
+struct joule_per_kelvin;
+struct joule_per_kilogram_kelvin;
+struct joule_per_mole_kelvin;
+struct dim_heat_capacity;
+struct dim_specific_heat_capacity;
+struct dim_molar_heat_capacity;
+
+template<UnitOf<dim_heat_capacity> U, Representation Rep = double>
+using heat_capacity = quantity<dim_heat_capacity, U, Rep>;
+
+template<UnitOf<dim_specific_heat_capacity> U, Representation Rep = double>
+using specific_heat_capacity = quantity<dim_specific_heat_capacity, U, Rep>;
+
+template<UnitOf<dim_molar_heat_capacity> U, Representation Rep = double>
+using molar_heat_capacity = quantity<dim_molar_heat_capacity, U, Rep>;
+
+// inductance.h
+struct henry;
+struct yoctohenry;
+struct zeptohenry;
+struct attohenry;
+struct femtohenry;
+struct picohenry;
+struct nanohenry;
+struct microhenry;
+struct millihenry;
+struct kilohenry;
+struct megahenry;
+struct gigahenry;
+struct terahenry;
+struct petahenry;
+struct exahenry;
+struct zettahenry;
+struct yottahenry;
+struct dim_inductance;
+
+template<UnitOf<dim_inductance> U, Representation Rep = double>
+using inductance = quantity<dim_inductance, U, Rep>;
+
+// length.h
+struct metre;
+struct yoctometre;
+struct zeptometre;
+struct attometre;
+struct femtometre;
+struct picometre;
+struct nanometre;
+struct micrometre;
+struct millimetre;
+struct centimetre;
+struct decimetre;
+struct decametre;
+struct hectometre;
+struct kilometre;
+struct megametre;
+struct gigametre;
+struct terametre;
+struct petametre;
+struct exametre;
+struct zettametre;
+struct yottametre;
+struct astronomical_unit;
+struct dim_length;
+
+template<UnitOf<dim_length> U, Representation Rep = double>
+using length = quantity<dim_length, U, Rep>;
+
+// luminance.h
+struct candela_per_metre_sq;
+struct dim_luminance;
+
+template<UnitOf<dim_luminance> U, Representation Rep = double>
+using luminance = quantity<dim_luminance, U, Rep>;
+
+// luminous_intensity.h
+struct candela;
+struct yoctocandela;
+struct zeptocandela;
+struct attocandela;
+struct femtocandela;
+struct picocandela;
+struct nanocandela;
+struct microcandela;
+struct millicandela;
+struct centicandela;
+struct decicandela;
+struct decacandela;
+struct hectocandela;
+struct kilocandela;
+struct megacandela;
+struct gigacandela;
+struct teracandela;
+struct petacandela;
+struct exacandela;
+struct zettacandela;
+struct yottacandela;
+struct dim_luminous_intensity;
+
+template<UnitOf<dim_luminous_intensity> U, Representation Rep = double>
+using luminous_intensity = quantity<dim_luminous_intensity, U, Rep>;
+
+// magnetic_flux.h
+struct weber;
+struct yoctoweber;
+struct zeptoweber;
+struct attoweber;
+struct femtoweber;
+struct picoweber;
+struct nanoweber;
+struct microweber;
+struct milliweber;
+struct kiloweber;
+struct megaweber;
+struct gigaweber;
+struct teraweber;
+struct petaweber;
+struct exaweber;
+struct zettaweber;
+struct yottaweber;
+struct dim_magnetic_flux;
+
+template<UnitOf<dim_magnetic_flux> U, Representation Rep = double>
+using magnetic_flux = quantity<dim_magnetic_flux, U, Rep>;
+
+// magnetic_induction.h
+struct tesla;
+struct yoctotesla;
+struct zeptotesla;
+struct attotesla;
+struct femtotesla;
+struct picotesla;
+struct nanotesla;
+struct microtesla;
+struct millitesla;
+struct kilotesla;
+struct megatesla;
+struct gigatesla;
+struct teratesla;
+struct petatesla;
+struct exatesla;
+struct zettatesla;
+struct yottatesla;
+struct gauss;
+struct dim_magnetic_induction;
+
+template<UnitOf<dim_magnetic_induction> U, Representation Rep = double>
+using magnetic_induction = quantity<dim_magnetic_induction, U, Rep>;
+
+// mass.h
+struct gram;
+struct yoctogram;
+struct zeptogram;
+struct attogram;
+struct femtogram;
+struct picogram;
+struct nanogram;
+struct microgram;
+struct milligram;
+struct centigram;
+struct decigram;
+struct decagram;
+struct hectogram;
+struct kilogram;
+struct megagram;
+struct gigagram;
+struct teragram;
+struct petagram;
+struct exagram;
+struct zettagram;
+struct yottagram;
+struct tonne;
+struct yoctotonne;
+struct zeptotonne;
+struct attotonne;
+struct femtotonne;
+struct picotonne;
+struct nanotonne;
+struct microtonne;
+struct millitonne;
+struct centitonne;
+struct decitonne;
+struct decatonne;
+struct hectotonne;
+struct kilotonne;
+struct megatonne;
+struct gigatonne;
+struct teratonne;
+struct petatonne;
+struct exatonne;
+struct zettatonne;
+struct yottatonne;
+struct dalton;
+struct dim_mass;
+
+template<UnitOf<dim_mass> U, Representation Rep = double>
+using mass = quantity<dim_mass, U, Rep>;
+
+// molar_energy.h
+struct joule_per_mole;
+struct dim_molar_energy;
+
+template<UnitOf<dim_molar_energy> U, Representation Rep = double>
+using molar_energy = quantity<dim_molar_energy, U, Rep>;
+
+// momentum.h
+struct kilogram_metre_per_second;
+struct dim_momentum;
+
+template<UnitOf<dim_momentum> U, Representation Rep = double>
+using momentum = quantity<dim_momentum, U, Rep>;
+
+// permeability.h
+struct henry_per_metre;
+struct dim_permeability;
+
+template<UnitOf<dim_permeability> U, Representation Rep = double>
+using permeability = quantity<dim_permeability, U, Rep>;
+
+// permittivity.h
+struct farad_per_metre;
+struct dim_permittivity;
+
+template<UnitOf<dim_permittivity> U, Representation Rep = double>
+using permittivity = quantity<dim_permittivity, U, Rep>;
+
+// power.h
+struct watt;
+struct yoctowatt;
+struct zeptowatt;
+struct attowatt;
+struct femtowatt;
+struct picowatt;
+struct nanowatt;
+struct microwatt;
+struct milliwatt;
+struct kilowatt;
+struct megawatt;
+struct gigawatt;
+struct terawatt;
+struct petawatt;
+struct exawatt;
+struct zettawatt;
+struct yottawatt;
+struct dim_power;
+
+template<UnitOf<dim_power> U, Representation Rep = double>
+using power = quantity<dim_power, U, Rep>;
+
+// pressure.h
+struct pascal;
+struct yoctopascal;
+struct zeptopascal;
+struct attopascal;
+struct femtopascal;
+struct picopascal;
+struct nanopascal;
+struct micropascal;
+struct millipascal;
+struct centipascal;
+struct decipascal;
+struct decapascal;
+struct hectopascal;
+struct kilopascal;
+struct megapascal;
+struct gigapascal;
+struct terapascal;
+struct petapascal;
+struct exapascal;
+struct zettapascal;
+struct yottapascal;
+struct dim_pressure;
+
+template<UnitOf<dim_pressure> U, Representation Rep = double>
+using pressure = quantity<dim_pressure, U, Rep>;
+
+// radioactivity.h
+struct becquerel;
+struct yoctobecquerel;
+struct zeptobecquerel;
+struct attobecquerel;
+struct femtobecquerel;
+struct picobecquerel;
+struct nanobecquerel;
+struct microbecquerel;
+struct millibecquerel;
+struct centibecquerel;
+struct decibecquerel;
+struct decabecquerel;
+struct hectobecquerel;
+struct kilobecquerel;
+struct megabecquerel;
+struct gigabecquerel;
+struct terabecquerel;
+struct petabecquerel;
+struct exabecquerel;
+struct zettabecquerel;
+struct yottabecquerel;
+struct dim_radioactivity;
+
+template<UnitOf<dim_radioactivity> U, Representation Rep = double>
+using radioactivity = quantity<dim_radioactivity, U, Rep>;
+
+// resistance.h
+struct ohm;
+struct yoctoohm;
+struct zeptoohm;
+struct attoohm;
+struct femtoohm;
+struct picoohm;
+struct nanoohm;
+struct microohm;
+struct milliohm;
+struct kiloohm;
+struct megaohm;
+struct gigaohm;
+struct teraohm;
+struct petaohm;
+struct exaohm;
+struct zettaohm;
+struct yottaohm;
+struct dim_resistance;
+
+template<UnitOf<dim_resistance> U, Representation Rep = double>
+using resistance = quantity<dim_resistance, U, Rep>;
+
+// speed.h
+struct metre_per_second;
+struct dim_speed;
+struct kilometre_per_hour;
+
+template<UnitOf<dim_speed> U, Representation Rep = double>
+using speed = quantity<dim_speed, U, Rep>;
+
+// surface_tension.h
+struct newton_per_metre;
+struct dim_surface_tension;
+
+template<UnitOf<dim_surface_tension> U, Representation Rep = double>
+using surface_tension = quantity<dim_surface_tension, U, Rep>;
+
+// thermal_conductivity.h
+struct watt_per_metre_kelvin;
+struct dim_thermal_conductivity;
+
+template<UnitOf<dim_thermal_conductivity> U, Representation Rep = double>
+using thermal_conductivity = quantity<dim_thermal_conductivity, U, Rep>;
+
+// thermodynamic_temperature.h
+struct kelvin;
+struct dim_thermodynamic_temperature;
+
+template<UnitOf<dim_thermodynamic_temperature> U, Representation Rep = double>
+using thermodynamic_temperature = quantity<dim_thermodynamic_temperature, U, Rep>;
+
+// time.h
+struct second;
+struct yoctosecond;
+struct zeptosecond;
+struct attosecond;
+struct femtosecond;
+struct picosecond;
+struct nanosecond;
+struct microsecond;
+struct millisecond;
+struct minute;
+struct hour;
+struct day;
+struct dim_time;
+
+template<UnitOf<dim_time> U, Representation Rep = double>
+using time = quantity<dim_time, U, Rep>;
+
+// torque.h
+struct newton_metre_per_radian;
+struct dim_torque;
+
+template<UnitOf<dim_torque> U, Representation Rep = double>
+using torque = quantity<dim_torque, U, Rep>;
+
+// voltage.h
+struct volt;
+struct yoctovolt;
+struct zeptovolt;
+struct attovolt;
+struct femtovolt;
+struct picovolt;
+struct nanovolt;
+struct microvolt;
+struct millivolt;
+struct centivolt;
+struct decivolt;
+struct decavolt;
+struct hectovolt;
+struct kilovolt;
+struct megavolt;
+struct gigavolt;
+struct teravolt;
+struct petavolt;
+struct exavolt;
+struct zettavolt;
+struct yottavolt;
+struct dim_voltage;
+
+template<UnitOf<dim_voltage> U, Representation Rep = double>
+using voltage = quantity<dim_voltage, U, Rep>;
+
+// volume.h
+struct cubic_metre;
+struct dim_volume;
+struct cubic_yoctometre;
+struct cubic_zeptometre;
+struct cubic_attometre;
+struct cubic_femtometre;
+struct cubic_picometre;
+struct cubic_nanometre;
+struct cubic_micrometre;
+struct cubic_millimetre;
+struct cubic_centimetre;
+struct cubic_decimetre;
+struct cubic_decametre;
+struct cubic_hectometre;
+struct cubic_kilometre;
+struct cubic_megametre;
+struct cubic_gigametre;
+struct cubic_terametre;
+struct cubic_petametre;
+struct cubic_exametre;
+struct cubic_zettametre;
+struct cubic_yottametre;
+struct litre;
+struct yoctolitre;
+struct zeptolitre;
+struct attolitre;
+struct femtolitre;
+struct picolitre;
+struct nanolitre;
+struct microlitre;
+struct millilitre;
+struct centilitre;
+struct decilitre;
+struct decalitre;
+struct hectolitre;
+struct kilolitre;
+struct megalitre;
+struct gigalitre;
+struct teralitre;
+struct petalitre;
+struct exalitre;
+struct zettalitre;
+struct yottalitre;
+
+template<UnitOf<dim_volume> U, Representation Rep = double>
+using volume = quantity<dim_volume, U, Rep>;
+
+}  // namespace units::isq::si
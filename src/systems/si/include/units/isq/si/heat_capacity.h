@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/heat_capacity.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/symbol_text.h>
 // IWYU pragma: end_exports
@@ -44,37 +45,15 @@ struct dim_heat_capacity : isq::dim_heat_capacity<dim_heat_capacity, joule_per_k
 struct dim_specific_heat_capacity : isq::dim_specific_heat_capacity<dim_specific_heat_capacity, joule_per_kilogram_kelvin, dim_heat_capacity, dim_mass> {};
 struct dim_molar_heat_capacity : isq::dim_molar_heat_capacity<dim_molar_heat_capacity, joule_per_mole_kelvin, dim_heat_capacity, dim_amount_of_substance> {};
 
-template<UnitOf<dim_heat_capacity> U, Representation Rep = double>
-using heat_capacity = quantity<dim_heat_capacity, U, Rep>;
-
-template<UnitOf<dim_specific_heat_capacity> U, Representation Rep = double>
-using specific_heat_capacity = quantity<dim_specific_heat_capacity, U, Rep>;
-
-template<UnitOf<dim_molar_heat_capacity> U, Representation Rep = double>
-using molar_heat_capacity = quantity<dim_molar_heat_capacity, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// J/K
-constexpr auto operator"" _q_J_per_K(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return heat_capacity<joule_per_kelvin, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_J_per_K(long double l) { return heat_capacity<joule_per_kelvin, long double>(l); }
-
-// J/(kg·K)
-constexpr auto operator"" _q_J_per_kg_K(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return specific_heat_capacity<joule_per_kilogram_kelvin, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_J_per_kg_K(long double l) { return specific_heat_capacity<joule_per_kilogram_kelvin, long double>(l); }
-
-// J/(mol·K)
-constexpr auto operator"" _q_J_per_mol_K(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return molar_heat_capacity<joule_per_mole_kelvin, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_J_per_mol_K(long double l) { return molar_heat_capacity<joule_per_mole_kelvin, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::joule_per_kelvin);
+UNITS_DOWNCAST_REGISTER(units::isq::si::joule_per_kilogram_kelvin);
+UNITS_DOWNCAST_REGISTER(units::isq::si::joule_per_mole_kelvin);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_heat_capacity);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_specific_heat_capacity);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_molar_heat_capacity);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::heat_capacity {
@@ -86,3 +65,7 @@ template<Representation Rep = double> using J_per_mol_K = units::isq::si::molar_
 }  // namespace units::aliases::isq::si::heat_capacity
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/heat_capacity.h>
+#endif // UNITS_NO_LITERALS
@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/length.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/reference.h>
 #include <units/symbol_text.h>
@@ -60,144 +61,31 @@ struct astronomical_unit : named_scaled_unit<astronomical_unit, "au", no_prefix,
 
 struct dim_length : isq::dim_length<metre> {};
 
-template<UnitOf<dim_length> U, Representation Rep = double>
-using length = quantity<dim_length, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// m
-constexpr auto operator"" _q_m(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return length<metre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_m(long double l) { return length<metre, long double>(l); }
-
-// ym
-constexpr auto operator"" _q_ym(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return length<yoctometre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_ym(long double l) { return length<yoctometre, long double>(l); }
-
-// zm
-constexpr auto operator"" _q_zm(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return length<zeptometre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_zm(long double l) { return length<zeptometre, long double>(l); }
-
-// am
-constexpr auto operator"" _q_am(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return length<attometre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_am(long double l) { return length<attometre, long double>(l); }
-
-// fm
-constexpr auto operator"" _q_fm(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return length<femtometre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_fm(long double l) { return length<femtometre, long double>(l); }
-
-// pm
-constexpr auto operator"" _q_pm(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return length<picometre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_pm(long double l) { return length<picometre, long double>(l); }
-
-// nm
-constexpr auto operator"" _q_nm(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return length<nanometre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_nm(long double l) { return length<nanometre, long double>(l); }
-
-// um
-constexpr auto operator"" _q_um(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return length<micrometre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_um(long double l) { return length<micrometre, long double>(l); }
-
-// mm
-constexpr auto operator"" _q_mm(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return length<millimetre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_mm(long double l) { return length<millimetre, long double>(l); }
-
-// cm
-constexpr auto operator"" _q_cm(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return length<centimetre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_cm(long double l) { return length<centimetre, long double>(l); }
-
-// dm
-constexpr auto operator"" _q_dm(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return length<decimetre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_dm(long double l) { return length<decimetre, long double>(l); }
-
-// dam
-constexpr auto operator"" _q_dam(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return length<decametre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_dam(long double l) { return length<decametre, long double>(l); }
-
-// hm
-constexpr auto operator"" _q_hm(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return length<hectometre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_hm(long double l) { return length<hectometre, long double>(l); }
-
-// km
-constexpr auto operator"" _q_km(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return length<kilometre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_km(long double l) { return length<kilometre, long double>(l); }
-
-// Mm
-constexpr auto operator"" _q_Mm(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return length<megametre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_Mm(long double l) { return length<megametre, long double>(l); }
-
-// Gm
-constexpr auto operator"" _q_Gm(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return length<gigametre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_Gm(long double l) { return length<gigametre, long double>(l); }
-
-// Tm
-constexpr auto operator"" _q_Tm(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return length<terametre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_Tm(long double l) { return length<terametre, long double>(l); }
-
-// Pm
-constexpr auto operator"" _q_Pm(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return length<petametre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_Pm(long double l) { return length<petametre, long double>(l); }
-
-// Em
-constexpr auto operator"" _q_Em(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return length<exametre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_Em(long double l) { return length<exametre, long double>(l); }
-
-// Zm
-constexpr auto operator"" _q_Zm(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return length<zettametre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_Zm(long double l) { return length<zettametre, long double>(l); }
-
-// Ym
-constexpr auto operator"" _q_Ym(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return length<yottametre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_Ym(long double l) { return length<yottametre, long double>(l); }
-
-// au
-constexpr auto operator"" _q_au(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return length<astronomical_unit, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_au(long double l) { return length<astronomical_unit, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
-#ifndef UNITS_NO_REFERENCES
-
-namespace length_references {
-
-inline constexpr auto m = reference<dim_length, metre>{};
-inline constexpr auto ym = reference<dim_length, yoctometre>{};
-inline constexpr auto zm = reference<dim_length, zeptometre>{};
-inline constexpr auto am = reference<dim_length, attometre>{};
-inline constexpr auto fm = reference<dim_length, femtometre>{};
-inline constexpr auto pm = reference<dim_length, picometre>{};
-inline constexpr auto nm = reference<dim_length, nanometre>{};
-inline constexpr auto um = reference<dim_length, micrometre>{};
-inline constexpr auto mm = reference<dim_length, millimetre>{};
-inline constexpr auto cm = reference<dim_length, centimetre>{};
-inline constexpr auto dm = reference<dim_length, decimetre>{};
-inline constexpr auto dam = reference<dim_length, decametre>{};
-inline constexpr auto hm = reference<dim_length, hectometre>{};
-inline constexpr auto km = reference<dim_length, kilometre>{};
-inline constexpr auto Mm = reference<dim_length, megametre>{};
-inline constexpr auto Gm = reference<dim_length, gigametre>{};
-inline constexpr auto Tm = reference<dim_length, terametre>{};
-inline constexpr auto Pm = reference<dim_length, petametre>{};
-inline constexpr auto Em = reference<dim_length, exametre>{};
-inline constexpr auto Zm = reference<dim_length, zettametre>{};
-inline constexpr auto Ym = reference<dim_length, yottametre>{};
-inline constexpr auto au = reference<dim_length, astronomical_unit>{};
-
-}  // namespace length_references
-
-namespace references { 
-
-using namespace length_references;
-
-}  // namespace references
-
-#endif // UNITS_NO_REFERENCES
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::metre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::yoctometre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::zeptometre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::attometre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::femtometre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::picometre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::nanometre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::micrometre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::millimetre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::centimetre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::decimetre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::decametre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hectometre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::kilometre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::megametre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::gigametre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::terametre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::petametre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::exametre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::zettametre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::yottametre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::astronomical_unit);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline length {
@@ -228,3 +116,11 @@ template<Representation Rep = double> using au = units::isq::si::length<units::i
 }  // namespace units::aliases::isq::si::inline length
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/length.h>
+#endif // UNITS_NO_LITERALS
+
+#ifndef UNITS_NO_REFERENCES
+#include <units/isq/si/references/length.h>
+#endif // UNITS_NO_REFERENCES
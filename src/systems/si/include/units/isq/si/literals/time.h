@@ -0,0 +1,81 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/isq/si/time.h>
+
+namespace units::isq::si {
+
+inline namespace literals {
+
+// ys
+constexpr auto operator"" _q_ys(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return time<yoctosecond, std::int64_t>(static_cast<std::int64_t>(l)); }
+constexpr auto operator"" _q_ys(long double l) { return time<yoctosecond, long double>(l); }
+
+// zs
+constexpr auto operator"" _q_zs(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return time<zeptosecond, std::int64_t>(static_cast<std::int64_t>(l)); }
+constexpr auto operator"" _q_zs(long double l) { return time<zeptosecond, long double>(l); }
+
+// as
+constexpr auto operator"" _q_as(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return time<attosecond, std::int64_t>(static_cast<std::int64_t>(l)); }
+constexpr auto operator"" _q_as(long double l) { return time<attosecond, long double>(l); }
+
+// fs
+constexpr auto operator"" _q_fs(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return time<femtosecond, std::int64_t>(static_cast<std::int64_t>(l)); }
+constexpr auto operator"" _q_fs(long double l) { return time<femtosecond, long double>(l); }
+
+// ps
+constexpr auto operator"" _q_ps(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return time<picosecond, std::int64_t>(static_cast<std::int64_t>(l)); }
+constexpr auto operator"" _q_ps(long double l) { return time<picosecond, long double>(l); }
+
+// ns
+constexpr auto operator"" _q_ns(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return time<nanosecond, std::int64_t>(static_cast<std::int64_t>(l)); }
+constexpr auto operator"" _q_ns(long double l) { return time<nanosecond, long double>(l); }
+
+// us
+constexpr auto operator"" _q_us(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return time<microsecond, std::int64_t>(static_cast<std::int64_t>(l)); }
+constexpr auto operator"" _q_us(long double l) { return time<microsecond, long double>(l); }
+
+// ms
+constexpr auto operator"" _q_ms(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return time<millisecond, std::int64_t>(static_cast<std::int64_t>(l)); }
+constexpr auto operator"" _q_ms(long double l) { return time<millisecond, long double>(l); }
+
+// s
+constexpr auto operator"" _q_s(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return time<second, std::int64_t>(static_cast<std::int64_t>(l)); }
+constexpr auto operator"" _q_s(long double l) { return time<second, long double>(l); }
+
+// min
+constexpr auto operator"" _q_min(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return time<minute, std::int64_t>(static_cast<std::int64_t>(l)); }
+constexpr auto operator"" _q_min(long double l) { return time<minute, long double>(l); }
+
+// h
+constexpr auto operator"" _q_h(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return time<hour, std::int64_t>(static_cast<std::int64_t>(l)); }
+constexpr auto operator"" _q_h(long double l) { return time<hour, long double>(l); }
+
+// d
+constexpr auto operator"" _q_d(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return time<day, std::int64_t>(static_cast<std::int64_t>(l)); }
+constexpr auto operator"" _q_d(long double l) { return time<day, long double>(l); }
+
+}  // namespace literals
+
+}  // namespace units::isq::si
@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/luminance.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/symbol_text.h>
 // IWYU pragma: end_exports
@@ -37,23 +38,11 @@ namespace units::isq::si {
 struct candela_per_metre_sq : unit<candela_per_metre_sq> {};
 struct dim_luminance : isq::dim_luminance<dim_luminance, candela_per_metre_sq, dim_luminous_intensity, dim_length> {};
 
-template<UnitOf<dim_luminance> U, Representation Rep = double>
-using luminance = quantity<dim_luminance, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// cd/m²
-constexpr auto operator"" _q_cd_per_m2(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return luminance<candela_per_metre_sq, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_cd_per_m2(long double l) { return luminance<candela_per_metre_sq, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::candela_per_metre_sq);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_luminance);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline luminance {
@@ -63,3 +52,7 @@ template<Representation Rep = double> using cd_per_m2 = units::isq::si::luminanc
 }  // namespace units::aliases::isq::si::inline luminance
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/luminance.h>
+#endif // UNITS_NO_LITERALS
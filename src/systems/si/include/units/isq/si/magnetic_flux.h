@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/magnetic_flux.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/reference.h>
 #include <units/symbol_text.h>
@@ -56,119 +57,27 @@ struct yottaweber : prefixed_unit<yottaweber, yotta, weber> {};
 
 struct dim_magnetic_flux : isq::dim_magnetic_flux<dim_magnetic_flux, weber, dim_magnetic_induction, dim_area> {};
 
-template<UnitOf<dim_magnetic_flux> U, Representation Rep = double>
-using magnetic_flux = quantity<dim_magnetic_flux, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// Wb
-constexpr auto operator"" _q_Wb(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_flux<weber, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_Wb(long double l) { return magnetic_flux<weber, long double>(l); }
-
-// yWb
-constexpr auto operator"" _q_yWb(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_flux<yoctoweber, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_yWb(long double l) { return magnetic_flux<yoctoweber, long double>(l); }
-
-// zWb
-constexpr auto operator"" _q_zWb(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_flux<zeptoweber, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_zWb(long double l) { return magnetic_flux<zeptoweber, long double>(l); }
-
-// aWb
-constexpr auto operator"" _q_aWb(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_flux<attoweber, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_aWb(long double l) { return magnetic_flux<attoweber, long double>(l); }
-
-// fWb
-constexpr auto operator"" _q_fWb(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_flux<femtoweber, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_fWb(long double l) { return magnetic_flux<femtoweber, long double>(l); }
-
-// pWb
-constexpr auto operator"" _q_pWb(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_flux<picoweber, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_pWb(long double l) { return magnetic_flux<picoweber, long double>(l); }
-
-// nWb
-constexpr auto operator"" _q_nWb(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_flux<nanoweber, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_nWb(long double l) { return magnetic_flux<nanoweber, long double>(l); }
-
-// µWb
-constexpr auto operator"" _q_uWb(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_flux<microweber, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_uWb(long double l) { return magnetic_flux<microweber, long double>(l); }
-
-// mWb
-constexpr auto operator"" _q_mWb(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_flux<milliweber, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_mWb(long double l) { return magnetic_flux<milliweber, long double>(l); }
-
-// kWb
-constexpr auto operator"" _q_kWb(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_flux<kiloweber, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_kWb(long double l) { return magnetic_flux<kiloweber, long double>(l); }
-
-// MWb
-constexpr auto operator"" _q_MWb(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_flux<megaweber, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_MWb(long double l) { return magnetic_flux<megaweber, long double>(l); }
-
-// GWb
-constexpr auto operator"" _q_GWb(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_flux<gigaweber, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_GWb(long double l) { return magnetic_flux<gigaweber, long double>(l); }
-
-// TWb
-constexpr auto operator"" _q_TWb(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_flux<teraweber, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_TWb(long double l) { return magnetic_flux<teraweber, long double>(l); }
-
-// PWb
-constexpr auto operator"" _q_PWb(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_flux<petaweber, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_PWb(long double l) { return magnetic_flux<petaweber, long double>(l); }
-
-// EWb
-constexpr auto operator"" _q_EWb(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_flux<exaweber, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_EWb(long double l) { return magnetic_flux<exaweber, long double>(l); }
-
-// ZWb
-constexpr auto operator"" _q_ZWb(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_flux<zettaweber, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_ZWb(long double l) { return magnetic_flux<zettaweber, long double>(l); }
-
-// YWb
-constexpr auto operator"" _q_YWb(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_flux<yottaweber, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_YWb(long double l) { return magnetic_flux<yottaweber, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
-#ifndef UNITS_NO_REFERENCES
-
-namespace magnetic_flux_references {
-
-inline constexpr auto Wb = reference<dim_magnetic_flux, weber>{};
-inline constexpr auto yWb = reference<dim_magnetic_flux, yoctoweber>{};
-inline constexpr auto zWb = reference<dim_magnetic_flux, zeptoweber>{};
-inline constexpr auto aWb = reference<dim_magnetic_flux, attoweber>{};
-inline constexpr auto fWb = reference<dim_magnetic_flux, femtoweber>{};
-inline constexpr auto pWb = reference<dim_magnetic_flux, picoweber>{};
-inline constexpr auto nWb = reference<dim_magnetic_flux, nanoweber>{};
-inline constexpr auto uWb = reference<dim_magnetic_flux, microweber>{};
-inline constexpr auto mWb = reference<dim_magnetic_flux, milliweber>{};
-inline constexpr auto kWb = reference<dim_magnetic_flux, kiloweber>{};
-inline constexpr auto MWb = reference<dim_magnetic_flux, megaweber>{};
-inline constexpr auto GWb = reference<dim_magnetic_flux, gigaweber>{};
-inline constexpr auto TWb = reference<dim_magnetic_flux, teraweber>{};
-inline constexpr auto PWb = reference<dim_magnetic_flux, petaweber>{};
-inline constexpr auto EWb = reference<dim_magnetic_flux, exaweber>{};
-inline constexpr auto ZWb = reference<dim_magnetic_flux, zettaweber>{};
-inline constexpr auto YWb = reference<dim_magnetic_flux, yottaweber>{};
-
-}  // namespace magnetic_flux_references
-
-namespace references {
-
-using namespace magnetic_flux_references;
-
-}  // namespace references
-
-#endif // UNITS_NO_REFERENCES
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::weber);
+UNITS_DOWNCAST_REGISTER(units::isq::si::yoctoweber);
+UNITS_DOWNCAST_REGISTER(units::isq::si::zeptoweber);
+UNITS_DOWNCAST_REGISTER(units::isq::si::attoweber);
+UNITS_DOWNCAST_REGISTER(units::isq::si::femtoweber);
+UNITS_DOWNCAST_REGISTER(units::isq::si::picoweber);
+UNITS_DOWNCAST_REGISTER(units::isq::si::nanoweber);
+UNITS_DOWNCAST_REGISTER(units::isq::si::microweber);
+UNITS_DOWNCAST_REGISTER(units::isq::si::milliweber);
+UNITS_DOWNCAST_REGISTER(units::isq::si::kiloweber);
+UNITS_DOWNCAST_REGISTER(units::isq::si::megaweber);
+UNITS_DOWNCAST_REGISTER(units::isq::si::gigaweber);
+UNITS_DOWNCAST_REGISTER(units::isq::si::teraweber);
+UNITS_DOWNCAST_REGISTER(units::isq::si::petaweber);
+UNITS_DOWNCAST_REGISTER(units::isq::si::exaweber);
+UNITS_DOWNCAST_REGISTER(units::isq::si::zettaweber);
+UNITS_DOWNCAST_REGISTER(units::isq::si::yottaweber);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_magnetic_flux);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline magnetic_flux {
@@ -194,3 +103,11 @@ template<Representation Rep = double> using YWb = units::isq::si::magnetic_flux<
 }  // namespace units::aliases::isq::si::inline magnetic_flux
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/magnetic_flux.h>
+#endif // UNITS_NO_LITERALS
+
+#ifndef UNITS_NO_REFERENCES
+#include <units/isq/si/references/magnetic_flux.h>
+#endif // UNITS_NO_REFERENCES
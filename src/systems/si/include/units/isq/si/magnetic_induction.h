@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/magnetic_induction.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/reference.h>
 #include <units/symbol_text.h>
@@ -60,123 +61,27 @@ struct gauss : named_scaled_unit<gauss, "G", prefix, ratio(1, 10'000), tesla> {}
 
 struct dim_magnetic_induction : isq::dim_magnetic_induction<dim_magnetic_induction, tesla, dim_voltage, dim_time, dim_length> {};
 
-template<UnitOf<dim_magnetic_induction> U, Representation Rep = double>
-using magnetic_induction = quantity<dim_magnetic_induction, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// T
-constexpr auto operator"" _q_T(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_induction<tesla, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_T(long double l) { return magnetic_induction<tesla, long double>(l); }
-
-// yT
-constexpr auto operator"" _q_yT(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_induction<yoctotesla, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_yT(long double l) { return magnetic_induction<yoctotesla, long double>(l); }
-
-// zT
-constexpr auto operator"" _q_zT(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_induction<zeptotesla, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_zT(long double l) { return magnetic_induction<zeptotesla, long double>(l); }
-
-// aT
-constexpr auto operator"" _q_aT(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_induction<attotesla, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_aT(long double l) { return magnetic_induction<attotesla, long double>(l); }
-
-// fT
-constexpr auto operator"" _q_fT(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_induction<femtotesla, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_fT(long double l) { return magnetic_induction<femtotesla, long double>(l); }
-
-// pT
-constexpr auto operator"" _q_pT(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_induction<picotesla, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_pT(long double l) { return magnetic_induction<picotesla, long double>(l); }
-
-// nT
-constexpr auto operator"" _q_nT(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_induction<nanotesla, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_nT(long double l) { return magnetic_induction<nanotesla, long double>(l); }
-
-// µT
-constexpr auto operator"" _q_uT(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_induction<microtesla, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_uT(long double l) { return magnetic_induction<microtesla, long double>(l); }
-
-// mT
-constexpr auto operator"" _q_mT(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_induction<millitesla, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_mT(long double l) { return magnetic_induction<millitesla, long double>(l); }
-
-// kT
-constexpr auto operator"" _q_kT(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_induction<kilotesla, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_kT(long double l) { return magnetic_induction<kilotesla, long double>(l); }
-
-// MT
-constexpr auto operator"" _q_MT(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_induction<megatesla, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_MT(long double l) { return magnetic_induction<megatesla, long double>(l); }
-
-// GT
-constexpr auto operator"" _q_GT(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_induction<gigatesla, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_GT(long double l) { return magnetic_induction<gigatesla, long double>(l); }
-
-// TT
-constexpr auto operator"" _q_TT(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_induction<teratesla, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_TT(long double l) { return magnetic_induction<teratesla, long double>(l); }
-
-// PT
-constexpr auto operator"" _q_PT(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_induction<petatesla, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_PT(long double l) { return magnetic_induction<petatesla, long double>(l); }
-
-// ET
-constexpr auto operator"" _q_ET(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_induction<exatesla, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_ET(long double l) { return magnetic_induction<exatesla, long double>(l); }
-
-// ZT
-constexpr auto operator"" _q_ZT(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_induction<zettatesla, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_ZT(long double l) { return magnetic_induction<zettatesla, long double>(l); }
-
-// YT
-constexpr auto operator"" _q_YT(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_induction<yottatesla, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_YT(long double l) { return magnetic_induction<yottatesla, long double>(l); }
-
-// G
-constexpr auto operator"" _q_G(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return magnetic_induction<gauss, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_G(long double l) { return magnetic_induction<gauss, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
-#ifndef UNITS_NO_REFERENCES
-
-namespace magnetic_induction_references {
-
-inline constexpr auto T = reference<dim_magnetic_induction, tesla>{};
-inline constexpr auto yT = reference<dim_magnetic_induction, yoctotesla>{};
-inline constexpr auto zT = reference<dim_magnetic_induction, zeptotesla>{};
-inline constexpr auto aT = reference<dim_magnetic_induction, attotesla>{};
-inline constexpr auto fT = reference<dim_magnetic_induction, femtotesla>{};
-inline constexpr auto pT = reference<dim_magnetic_induction, picotesla>{};
-inline constexpr auto nT = reference<dim_magnetic_induction, nanotesla>{};
-inline constexpr auto uT = reference<dim_magnetic_induction, microtesla>{};
-inline constexpr auto mT = reference<dim_magnetic_induction, millitesla>{};
-inline constexpr auto kT = reference<dim_magnetic_induction, kilotesla>{};
-inline constexpr auto MT = reference<dim_magnetic_induction, megatesla>{};
-inline constexpr auto GT = reference<dim_magnetic_induction, gigatesla>{};
-inline constexpr auto TT = reference<dim_magnetic_induction, teratesla>{};
-inline constexpr auto PT = reference<dim_magnetic_induction, petatesla>{};
-inline constexpr auto ET = reference<dim_magnetic_induction, exatesla>{};
-inline constexpr auto ZT = reference<dim_magnetic_induction, zettatesla>{};
-inline constexpr auto YT = reference<dim_magnetic_induction, yottatesla>{};
-inline constexpr auto G = reference<dim_magnetic_induction, gauss>{};
-
-}  // namespace magnetic_induction_references
-
-namespace references {
-
-using namespace magnetic_induction_references;
-
-}  // namespace references
-
-#endif // UNITS_NO_REFERENCES
-
-} // namespace units::isq::si
+}  // namespace units::isq::si
+
+UNITS_DOWNCAST_REGISTER(units::isq::si::tesla);
+UNITS_DOWNCAST_REGISTER(units::isq::si::yoctotesla);
+UNITS_DOWNCAST_REGISTER(units::isq::si::zeptotesla);
+UNITS_DOWNCAST_REGISTER(units::isq::si::attotesla);
+UNITS_DOWNCAST_REGISTER(units::isq::si::femtotesla);
+UNITS_DOWNCAST_REGISTER(units::isq::si::picotesla);
+UNITS_DOWNCAST_REGISTER(units::isq::si::nanotesla);
+UNITS_DOWNCAST_REGISTER(units::isq::si::microtesla);
+UNITS_DOWNCAST_REGISTER(units::isq::si::millitesla);
+UNITS_DOWNCAST_REGISTER(units::isq::si::kilotesla);
+UNITS_DOWNCAST_REGISTER(units::isq::si::megatesla);
+UNITS_DOWNCAST_REGISTER(units::isq::si::gigatesla);
+UNITS_DOWNCAST_REGISTER(units::isq::si::teratesla);
+UNITS_DOWNCAST_REGISTER(units::isq::si::petatesla);
+UNITS_DOWNCAST_REGISTER(units::isq::si::exatesla);
+UNITS_DOWNCAST_REGISTER(units::isq::si::zettatesla);
+UNITS_DOWNCAST_REGISTER(units::isq::si::yottatesla);
+UNITS_DOWNCAST_REGISTER(units::isq::si::gauss);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_magnetic_induction);
 
 #ifndef UNITS_NO_ALIASES
 
@@ -204,3 +109,11 @@ template<Representation Rep = double> using G = units::isq::si::magnetic_inducti
 }  // namespace units::aliases::isq::si::inline magnetic_induction
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/magnetic_induction.h>
+#endif // UNITS_NO_LITERALS
+
+#ifndef UNITS_NO_REFERENCES
+#include <units/isq/si/references/magnetic_induction.h>
+#endif // UNITS_NO_REFERENCES
@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/molar_energy.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/symbol_text.h>
 // IWYU pragma: end_exports
@@ -39,23 +40,11 @@ struct joule_per_mole : unit<joule_per_mole> {};
 
 struct dim_molar_energy : isq::dim_molar_energy<dim_molar_energy, joule_per_mole, dim_energy, dim_amount_of_substance> {};
 
-template<UnitOf<dim_molar_energy> U, Representation Rep = double>
-using molar_energy = quantity<dim_molar_energy, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// J/mol
-constexpr auto operator"" _q_J_per_mol(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return molar_energy<joule_per_mole, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_J_per_mol(long double l) { return molar_energy<joule_per_mole, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::joule_per_mole);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_molar_energy);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline molar_energy {
@@ -65,3 +54,7 @@ template<Representation Rep = double> using J_per_mol = units::isq::si::molar_en
 }  // namespace units::aliases::isq::si::inline molar_energy
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/molar_energy.h>
+#endif // UNITS_NO_LITERALS
@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/momentum.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/symbol_text.h>
 // IWYU pragma: end_exports
@@ -37,23 +38,11 @@ namespace units::isq::si {
 struct kilogram_metre_per_second : unit<kilogram_metre_per_second> {};
 struct dim_momentum : isq::dim_momentum<dim_momentum, kilogram_metre_per_second, dim_mass, dim_speed> {};
 
-template<UnitOf<dim_momentum> U, Representation Rep = double>
-using momentum = quantity<dim_momentum, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// kg*m/s
-constexpr auto operator"" _q_kg_m_per_s(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return momentum<kilogram_metre_per_second, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_kg_m_per_s(long double l) { return momentum<kilogram_metre_per_second, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::kilogram_metre_per_second);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_momentum);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline momentum {
@@ -63,3 +52,7 @@ template<Representation Rep = double> using kg_m_per_s = units::isq::si::momentu
 }  // namespace units::aliases::isq::si::inline momentum
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/momentum.h>
+#endif // UNITS_NO_LITERALS
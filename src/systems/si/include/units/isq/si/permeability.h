@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/permeability.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/symbol_text.h>
 // IWYU pragma: end_exports
@@ -38,23 +39,11 @@ struct henry_per_metre : unit<henry_per_metre> {};
 
 struct dim_permeability : isq::dim_permeability<dim_permeability, henry_per_metre, dim_inductance, dim_length> {};
 
-template<UnitOf<dim_permeability> U, Representation Rep = double>
-using permeability = quantity<dim_permeability, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// H/m
-constexpr auto operator"" _q_H_per_m(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return permeability<henry_per_metre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_H_per_m(long double l) { return permeability<henry_per_metre, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::henry_per_metre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_permeability);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline permeability {
@@ -64,3 +53,7 @@ template<Representation Rep = double> using H_per_m = units::isq::si::permeabili
 }  // namespace units::aliases::isq::si::inline permeability
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/permeability.h>
+#endif // UNITS_NO_LITERALS
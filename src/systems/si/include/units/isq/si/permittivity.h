@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/permittivity.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/symbol_text.h>
 // IWYU pragma: end_exports
@@ -38,23 +39,11 @@ struct farad_per_metre : unit<farad_per_metre> {};
 
 struct dim_permittivity : isq::dim_permittivity<dim_permittivity, farad_per_metre, dim_capacitance, dim_length> {};
 
-template<UnitOf<dim_permittivity> U, Representation Rep = double>
-using permittivity = quantity<dim_permittivity, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// F/m
-constexpr auto operator"" _q_F_per_m(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return permittivity<farad_per_metre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_F_per_m(long double l) { return permittivity<farad_per_metre, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::farad_per_metre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_permittivity);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline permittivity {
@@ -64,3 +53,7 @@ template<Representation Rep = double> using F_per_m = units::isq::si::permittivi
 }  // namespace units::aliases::isq::si::inline permittivity
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/permittivity.h>
+#endif // UNITS_NO_LITERALS
@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/power.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/reference.h>
 #include <units/symbol_text.h>
@@ -55,119 +56,27 @@ struct yottawatt : prefixed_unit<yottawatt, yotta, watt> {};
 
 struct dim_power : isq::dim_power<dim_power, watt, dim_energy, dim_time> {};
 
-template<UnitOf<dim_power> U, Representation Rep = double>
-using power = quantity<dim_power, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// W
-constexpr auto operator"" _q_W(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return power<watt, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_W(long double l) { return power<watt, long double>(l); }
-
-// yW
-constexpr auto operator"" _q_yW(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return power<yoctowatt, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_yW(long double l) { return power<yoctowatt, long double>(l); }
-
-// zW
-constexpr auto operator"" _q_zW(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return power<zeptowatt, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_zW(long double l) { return power<zeptowatt, long double>(l); }
-
-// aW
-constexpr auto operator"" _q_aW(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return power<attowatt, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_aW(long double l) { return power<attowatt, long double>(l); }
-
-// fW
-constexpr auto operator"" _q_fW(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return power<femtowatt, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_fW(long double l) { return power<femtowatt, long double>(l); }
-
-// pW
-constexpr auto operator"" _q_pW(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return power<picowatt, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_pW(long double l) { return power<picowatt, long double>(l); }
-
-// nW
-constexpr auto operator"" _q_nW(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return power<nanowatt, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_nW(long double l) { return power<nanowatt, long double>(l); }
-
-// uW
-constexpr auto operator"" _q_uW(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return power<microwatt, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_uW(long double l) { return power<microwatt, long double>(l); }
-
-// mW
-constexpr auto operator"" _q_mW(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return power<milliwatt, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_mW(long double l) { return power<milliwatt, long double>(l); }
-
-// kW
-constexpr auto operator"" _q_kW(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return power<kilowatt, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_kW(long double l) { return power<kilowatt, long double>(l); }
-
-// MW
-constexpr auto operator"" _q_MW(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return power<megawatt, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_MW(long double l) { return power<megawatt, long double>(l); }
-
-// GW
-constexpr auto operator"" _q_GW(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return power<gigawatt, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_GW(long double l) { return power<gigawatt, long double>(l); }
-
-// TW
-constexpr auto operator"" _q_TW(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return power<terawatt, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_TW(long double l) { return power<terawatt, long double>(l); }
-
-// PW
-constexpr auto operator"" _q_PW(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return power<petawatt, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_PW(long double l) { return power<petawatt, long double>(l); }
-
-// EW
-constexpr auto operator"" _q_EW(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return power<exawatt, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_EW(long double l) { return power<exawatt, long double>(l); }
-
-// ZW
-constexpr auto operator"" _q_ZW(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return power<zettawatt, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_ZW(long double l) { return power<zettawatt, long double>(l); }
-
-// YW
-constexpr auto operator"" _q_YW(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return power<yottawatt, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_YW(long double l) { return power<yottawatt, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
-#ifndef UNITS_NO_REFERENCES
-
-namespace power_references {
-
-inline constexpr auto W = reference<dim_power, watt>{};
-inline constexpr auto yW = reference<dim_power, yoctowatt>{};
-inline constexpr auto zW = reference<dim_power, zeptowatt>{};
-inline constexpr auto aW = reference<dim_power, attowatt>{};
-inline constexpr auto fW = reference<dim_power, femtowatt>{};
-inline constexpr auto pW = reference<dim_power, picowatt>{};
-inline constexpr auto nW = reference<dim_power, nanowatt>{};
-inline constexpr auto uW = reference<dim_power, microwatt>{};
-inline constexpr auto mW = reference<dim_power, milliwatt>{};
-inline constexpr auto kW = reference<dim_power, kilowatt>{};
-inline constexpr auto MW = reference<dim_power, megawatt>{};
-inline constexpr auto GW = reference<dim_power, gigawatt>{};
-inline constexpr auto TW = reference<dim_power, terawatt>{};
-inline constexpr auto PW = reference<dim_power, petawatt>{};
-inline constexpr auto EW = reference<dim_power, exawatt>{};
-inline constexpr auto ZW = reference<dim_power, zettawatt>{};
-inline constexpr auto YW = reference<dim_power, yottawatt>{};
-
-}  // namespace power_references
-
-namespace references {
-
-using namespace power_references;
-
-}  // namespace references
-
-#endif // UNITS_NO_REFERENCES
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::watt);
+UNITS_DOWNCAST_REGISTER(units::isq::si::yoctowatt);
+UNITS_DOWNCAST_REGISTER(units::isq::si::zeptowatt);
+UNITS_DOWNCAST_REGISTER(units::isq::si::attowatt);
+UNITS_DOWNCAST_REGISTER(units::isq::si::femtowatt);
+UNITS_DOWNCAST_REGISTER(units::isq::si::picowatt);
+UNITS_DOWNCAST_REGISTER(units::isq::si::nanowatt);
+UNITS_DOWNCAST_REGISTER(units::isq::si::microwatt);
+UNITS_DOWNCAST_REGISTER(units::isq::si::milliwatt);
+UNITS_DOWNCAST_REGISTER(units::isq::si::kilowatt);
+UNITS_DOWNCAST_REGISTER(units::isq::si::megawatt);
+UNITS_DOWNCAST_REGISTER(units::isq::si::gigawatt);
+UNITS_DOWNCAST_REGISTER(units::isq::si::terawatt);
+UNITS_DOWNCAST_REGISTER(units::isq::si::petawatt);
+UNITS_DOWNCAST_REGISTER(units::isq::si::exawatt);
+UNITS_DOWNCAST_REGISTER(units::isq::si::zettawatt);
+UNITS_DOWNCAST_REGISTER(units::isq::si::yottawatt);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_power);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline power {
@@ -193,3 +102,11 @@ template<Representation Rep = double> using YW = units::isq::si::power<units::is
 }  // namespace units::aliases::isq::si::inline power
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/power.h>
+#endif // UNITS_NO_LITERALS
+
+#ifndef UNITS_NO_REFERENCES
+#include <units/isq/si/references/power.h>
+#endif // UNITS_NO_REFERENCES
@@ -0,0 +1,61 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/isq/si/absorbed_dose.h>
+
+namespace units::isq::si {
+
+namespace absorbed_dose_references {
+
+inline constexpr auto Gy = reference<dim_absorbed_dose, gray>{};
+inline constexpr auto yGy = reference<dim_absorbed_dose, yoctogray>{};
+inline constexpr auto zGy = reference<dim_absorbed_dose, zeptogray>{};
+inline constexpr auto aGy = reference<dim_absorbed_dose, attogray>{};
+inline constexpr auto fGy = reference<dim_absorbed_dose, femtogray>{};
+inline constexpr auto pGy = reference<dim_absorbed_dose, picogray>{};
+inline constexpr auto nGy = reference<dim_absorbed_dose, nanogray>{};
+inline constexpr auto uGy = reference<dim_absorbed_dose, microgray>{};
+inline constexpr auto mGy = reference<dim_absorbed_dose, milligray>{};
+inline constexpr auto cGy = reference<dim_absorbed_dose, centigray>{};
+inline constexpr auto dGy = reference<dim_absorbed_dose, decigray>{};
+inline constexpr auto daGy = reference<dim_absorbed_dose, decagray>{};
+inline constexpr auto hGy = reference<dim_absorbed_dose, hectogray>{};
+inline constexpr auto kGy = reference<dim_absorbed_dose, kilogray>{};
+inline constexpr auto MGy = reference<dim_absorbed_dose, megagray>{};
+inline constexpr auto GGy = reference<dim_absorbed_dose, gigagray>{};
+inline constexpr auto TGy = reference<dim_absorbed_dose, teragray>{};
+inline constexpr auto PGy = reference<dim_absorbed_dose, petagray>{};
+inline constexpr auto EGy = reference<dim_absorbed_dose, exagray>{};
+inline constexpr auto ZGy = reference<dim_absorbed_dose, zettagray>{};
+inline constexpr auto YGy = reference<dim_absorbed_dose, yottagray>{};
+
+}  // namespace absorbed_dose_references
+
+namespace references {
+
+using namespace absorbed_dose_references;
+
+}  // namespace references
+
+}  // namespace units::isq::si
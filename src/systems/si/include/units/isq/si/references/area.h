@@ -0,0 +1,63 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/isq/si/area.h>
+
+namespace units::isq::si {
+
+namespace area_references {
+
+inline constexpr auto m2 = reference<dim_area, square_metre>{};
+inline constexpr auto ym2 = reference<dim_area, square_yoctometre>{};
+inline constexpr auto zm2 = reference<dim_area, square_zeptometre>{};
+inline constexpr auto am2 = reference<dim_area, square_attometre>{};
+inline constexpr auto fm2 = reference<dim_area, square_femtometre>{};
+inline constexpr auto pm2 = reference<dim_area, square_picometre>{};
+inline constexpr auto nm2 = reference<dim_area, square_nanometre>{};
+inline constexpr auto um2 = reference<dim_area, square_micrometre>{};
+inline constexpr auto mm2 = reference<dim_area, square_millimetre>{};
+inline constexpr auto cm2 = reference<dim_area, square_centimetre>{};
+inline constexpr auto dm2 = reference<dim_area, square_decimetre>{};
+inline constexpr auto dam2 = reference<dim_area, square_decametre>{};
+inline constexpr auto hm2 = reference<dim_area, square_hectometre>{};
+inline constexpr auto km2 = reference<dim_area, square_kilometre>{};
+inline constexpr auto Mm2 = reference<dim_area, square_megametre>{};
+inline constexpr auto Gm2 = reference<dim_area, square_gigametre>{};
+inline constexpr auto Tm2 = reference<dim_area, square_terametre>{};
+inline constexpr auto Pm2 = reference<dim_area, square_petametre>{};
+inline constexpr auto Em2 = reference<dim_area, square_exametre>{};
+inline constexpr auto Zm2 = reference<dim_area, square_zettametre>{};
+inline constexpr auto Ym2 = reference<dim_area, square_yottametre>{};
+
+inline constexpr auto ha = reference<dim_area, hectare>{};
+
+}  // namespace area_references
+
+namespace references {
+
+using namespace area_references;
+
+}  // namespace references
+
+}  // namespace units::isq::si
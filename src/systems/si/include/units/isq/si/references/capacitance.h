@@ -0,0 +1,61 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/isq/si/capacitance.h>
+
+namespace units::isq::si {
+
+namespace capacitance_references {
+
+inline constexpr auto F = reference<dim_capacitance, farad>{};
+inline constexpr auto yF = reference<dim_capacitance, yoctofarad>{};
+inline constexpr auto zF = reference<dim_capacitance, zeptofarad>{};
+inline constexpr auto aF = reference<dim_capacitance, attofarad>{};
+inline constexpr auto fF = reference<dim_capacitance, femtofarad>{};
+inline constexpr auto pF = reference<dim_capacitance, picofarad>{};
+inline constexpr auto nF = reference<dim_capacitance, nanofarad>{};
+inline constexpr auto uF = reference<dim_capacitance, microfarad>{};
+inline constexpr auto mF = reference<dim_capacitance, millifarad>{};
+inline constexpr auto cF = reference<dim_capacitance, centifarad>{};
+inline constexpr auto dF = reference<dim_capacitance, decifarad>{};
+inline constexpr auto daF = reference<dim_capacitance, decafarad>{};
+inline constexpr auto hF = reference<dim_capacitance, hectofarad>{};
+inline constexpr auto kF = reference<dim_capacitance, kilofarad>{};
+inline constexpr auto MF = reference<dim_capacitance, megafarad>{};
+inline constexpr auto GF = reference<dim_capacitance, gigafarad>{};
+inline constexpr auto TF = reference<dim_capacitance, terafarad>{};
+inline constexpr auto PF = reference<dim_capacitance, petafarad>{};
+inline constexpr auto EF = reference<dim_capacitance, exafarad>{};
+inline constexpr auto ZF = reference<dim_capacitance, zettafarad>{};
+inline constexpr auto YF = reference<dim_capacitance, yottafarad>{};
+
+}  // namespace capacitance_references
+
+namespace references {
+
+using namespace capacitance_references;
+
+}  // namespace references
+
+}  // namespace units::isq::si
@@ -0,0 +1,62 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/isq/si/catalytic_activity.h>
+
+namespace units::isq::si {
+
+namespace catalytic_activity_references {
+
+inline constexpr auto kat = reference<dim_catalytic_activity, katal>{};
+inline constexpr auto ykat = reference<dim_catalytic_activity, yoctokatal>{};
+inline constexpr auto zkat = reference<dim_catalytic_activity, zeptokatal>{};
+inline constexpr auto akat = reference<dim_catalytic_activity, attokatal>{};
+inline constexpr auto fkat = reference<dim_catalytic_activity, femtokatal>{};
+inline constexpr auto pkat = reference<dim_catalytic_activity, picokatal>{};
+inline constexpr auto nkat = reference<dim_catalytic_activity, nanokatal>{};
+inline constexpr auto ukat = reference<dim_catalytic_activity, microkatal>{};
+inline constexpr auto mkat = reference<dim_catalytic_activity, millikatal>{};
+inline constexpr auto ckat = reference<dim_catalytic_activity, centikatal>{};
+inline constexpr auto dkat = reference<dim_catalytic_activity, decikatal>{};
+inline constexpr auto dakat = reference<dim_catalytic_activity, decakatal>{};
+inline constexpr auto hkat = reference<dim_catalytic_activity, hectokatal>{};
+inline constexpr auto kkat = reference<dim_catalytic_activity, kilokatal>{};
+inline constexpr auto Mkat = reference<dim_catalytic_activity, megakatal>{};
+inline constexpr auto Gkat = reference<dim_catalytic_activity, gigakatal>{};
+inline constexpr auto Tkat = reference<dim_catalytic_activity, terakatal>{};
+inline constexpr auto Pkat = reference<dim_catalytic_activity, petakatal>{};
+inline constexpr auto Ekat = reference<dim_catalytic_activity, exakatal>{};
+inline constexpr auto Zkat = reference<dim_catalytic_activity, zettakatal>{};
+inline constexpr auto Ykat = reference<dim_catalytic_activity, yottakatal>{};
+inline constexpr auto U = reference<dim_catalytic_activity, enzyme_unit>{};
+
+}  // namespace catalytic_activity_references
+
+namespace references {
+
+using namespace catalytic_activity_references;
+
+}  // namespace references
+
+}  // namespace units::isq::si
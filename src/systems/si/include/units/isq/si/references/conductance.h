@@ -0,0 +1,57 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/isq/si/conductance.h>
+
+namespace units::isq::si {
+
+namespace conductance_references {
+
+inline constexpr auto S = reference<dim_conductance, siemens>{};
+inline constexpr auto yS = reference<dim_conductance, yoctosiemens>{};
+inline constexpr auto zS = reference<dim_conductance, zeptosiemens>{};
+inline constexpr auto aS = reference<dim_conductance, attosiemens>{};
+inline constexpr auto fS = reference<dim_conductance, femtosiemens>{};
+inline constexpr auto pS = reference<dim_conductance, picosiemens>{};
+inline constexpr auto nS = reference<dim_conductance, nanosiemens>{};
+inline constexpr auto uS = reference<dim_conductance, microsiemens>{};
+inline constexpr auto mS = reference<dim_conductance, millisiemens>{};
+inline constexpr auto kS = reference<dim_conductance, kilosiemens>{};
+inline constexpr auto MS = reference<dim_conductance, megasiemens>{};
+inline constexpr auto GS = reference<dim_conductance, gigasiemens>{};
+inline constexpr auto TS = reference<dim_conductance, terasiemens>{};
+inline constexpr auto PS = reference<dim_conductance, petasiemens>{};
+inline constexpr auto ES = reference<dim_conductance, exasiemens>{};
+inline constexpr auto ZS = reference<dim_conductance, zettasiemens>{};
+inline constexpr auto YS = reference<dim_conductance, yottasiemens>{};
+
+}  // namespace conductance_references
+
+namespace references {
+
+using namespace conductance_references;
+
+}  // namespace references
+
+}  // namespace units::isq::si
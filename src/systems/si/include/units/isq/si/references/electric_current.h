@@ -0,0 +1,61 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/isq/si/electric_current.h>
+
+namespace units::isq::si {
+
+namespace electric_current_references {
+
+inline constexpr auto A = reference<dim_electric_current, ampere>{};
+inline constexpr auto yA = reference<dim_electric_current, yoctoampere>{};
+inline constexpr auto zA = reference<dim_electric_current, zeptoampere>{};
+inline constexpr auto aA = reference<dim_electric_current, attoampere>{};
+inline constexpr auto fA = reference<dim_electric_current, femtoampere>{};
+inline constexpr auto pA = reference<dim_electric_current, picoampere>{};
+inline constexpr auto nA = reference<dim_electric_current, nanoampere>{};
+inline constexpr auto uA = reference<dim_electric_current, microampere>{};
+inline constexpr auto mA = reference<dim_electric_current, milliampere>{};
+inline constexpr auto cA = reference<dim_electric_current, centiampere>{};
+inline constexpr auto dA = reference<dim_electric_current, deciampere>{};
+inline constexpr auto daA = reference<dim_electric_current, decaampere>{};
+inline constexpr auto hA = reference<dim_electric_current, hectoampere>{};
+inline constexpr auto kA = reference<dim_electric_current, kiloampere>{};
+inline constexpr auto MA = reference<dim_electric_current, megaampere>{};
+inline constexpr auto GA = reference<dim_electric_current, gigaampere>{};
+inline constexpr auto TA = reference<dim_electric_current, teraampere>{};
+inline constexpr auto PA = reference<dim_electric_current, petaampere>{};
+inline constexpr auto EA = reference<dim_electric_current, exaampere>{};
+inline constexpr auto ZA = reference<dim_electric_current, zettaampere>{};
+inline constexpr auto YA = reference<dim_electric_current, yottaampere>{};
+
+}  // namespace electric_current_references
+
+namespace references {
+
+using namespace electric_current_references;
+
+}  // namespace references
+
+}  // namespace units::isq::si
@@ -0,0 +1,60 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/isq/si/energy.h>
+
+namespace units::isq::si {
+
+namespace energy_references {
+
+inline constexpr auto J = reference<dim_energy, joule>{};
+inline constexpr auto yJ = reference<dim_energy, yoctojoule>{};
+inline constexpr auto zJ = reference<dim_energy, zeptojoule>{};
+inline constexpr auto aJ = reference<dim_energy, attojoule>{};
+inline constexpr auto fJ = reference<dim_energy, femtojoule>{};
+inline constexpr auto pJ = reference<dim_energy, picojoule>{};
+inline constexpr auto nJ = reference<dim_energy, nanojoule>{};
+inline constexpr auto uJ = reference<dim_energy, microjoule>{};
+inline constexpr auto mJ = reference<dim_energy, millijoule>{};
+inline constexpr auto kJ = reference<dim_energy, kilojoule>{};
+inline constexpr auto MJ = reference<dim_energy, megajoule>{};
+inline constexpr auto GJ = reference<dim_energy, gigajoule>{};
+inline constexpr auto TJ = reference<dim_energy, terajoule>{};
+inline constexpr auto PJ = reference<dim_energy, petajoule>{};
+inline constexpr auto EJ = reference<dim_energy, exajoule>{};
+inline constexpr auto ZJ = reference<dim_energy, zettajoule>{};
+inline constexpr auto YJ = reference<dim_energy, yottajoule>{};
+
+inline constexpr auto eV = reference<dim_energy, electronvolt>{};
+inline constexpr auto GeV = reference<dim_energy, gigaelectronvolt>{};
+
+}  // namespace energy_references
+
+namespace references {
+
+using namespace energy_references;
+
+}  // namespace references
+
+}  // namespace units::isq::si
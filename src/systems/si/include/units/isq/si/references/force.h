@@ -0,0 +1,61 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/isq/si/force.h>
+
+namespace units::isq::si {
+
+namespace force_references {
+
+inline constexpr auto N = reference<dim_force, newton>{};
+inline constexpr auto yN = reference<dim_force, yoctonewton>{};
+inline constexpr auto zN = reference<dim_force, zeptonewton>{};
+inline constexpr auto aN = reference<dim_force, attonewton>{};
+inline constexpr auto fN = reference<dim_force, femtonewton>{};
+inline constexpr auto pN = reference<dim_force, piconewton>{};
+inline constexpr auto nN = reference<dim_force, nanonewton>{};
+inline constexpr auto uN = reference<dim_force, micronewton>{};
+inline constexpr auto mN = reference<dim_force, millinewton>{};
+inline constexpr auto cN = reference<dim_force, centinewton>{};
+inline constexpr auto dN = reference<dim_force, decinewton>{};
+inline constexpr auto daN = reference<dim_force, decanewton>{};
+inline constexpr auto hN = reference<dim_force, hectonewton>{};
+inline constexpr auto kN = reference<dim_force, kilonewton>{};
+inline constexpr auto MN = reference<dim_force, meganewton>{};
+inline constexpr auto GN = reference<dim_force, giganewton>{};
+inline constexpr auto TN = reference<dim_force, teranewton>{};
+inline constexpr auto PN = reference<dim_force, petanewton>{};
+inline constexpr auto EN = reference<dim_force, exanewton>{};
+inline constexpr auto ZN = reference<dim_force, zettanewton>{};
+inline constexpr auto YN = reference<dim_force, yottanewton>{};
+
+}  // namespace force_references
+
+namespace references {
+
+using namespace force_references;
+
+}  // namespace references
+
+}  // namespace units::isq::si
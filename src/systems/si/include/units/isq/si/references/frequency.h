@@ -0,0 +1,57 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/isq/si/frequency.h>
+
+namespace units::isq::si {
+
+namespace frequency_references {
+
+inline constexpr auto Hz = reference<dim_frequency, hertz>{};
+inline constexpr auto yHz = reference<dim_frequency, yoctohertz>{};
+inline constexpr auto zHz = reference<dim_frequency, zeptohertz>{};
+inline constexpr auto aHz = reference<dim_frequency, attohertz>{};
+inline constexpr auto fHz = reference<dim_frequency, femtohertz>{};
+inline constexpr auto pHz = reference<dim_frequency, picohertz>{};
+inline constexpr auto nHz = reference<dim_frequency, nanohertz>{};
+inline constexpr auto uHz = reference<dim_frequency, microhertz>{};
+inline constexpr auto mHz = reference<dim_frequency, millihertz>{};
+inline constexpr auto kHz = reference<dim_frequency, kilohertz>{};
+inline constexpr auto MHz = reference<dim_frequency, megahertz>{};
+inline constexpr auto GHz = reference<dim_frequency, gigahertz>{};
+inline constexpr auto THz = reference<dim_frequency, terahertz>{};
+inline constexpr auto PHz = reference<dim_frequency, petahertz>{};
+inline constexpr auto EHz = reference<dim_frequency, exahertz>{};
+inline constexpr auto ZHz = reference<dim_frequency, zettahertz>{};
+inline constexpr auto YHz = reference<dim_frequency, yottahertz>{};
+
+}  // namespace frequency_references
+
+namespace references {
+
+using namespace frequency_references;
+
+}  // namespace references
+
+}  // namespace units::isq::si
@@ -0,0 +1,57 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/isq/si/inductance.h>
+
+namespace units::isq::si {
+
+namespace inductance_references {
+
+inline constexpr auto H = reference<dim_inductance, henry>{};
+inline constexpr auto yH = reference<dim_inductance, yoctohenry>{};
+inline constexpr auto zH = reference<dim_inductance, zeptohenry>{};
+inline constexpr auto aH = reference<dim_inductance, attohenry>{};
+inline constexpr auto fH = reference<dim_inductance, femtohenry>{};
+inline constexpr auto pH = reference<dim_inductance, picohenry>{};
+inline constexpr auto nH = reference<dim_inductance, nanohenry>{};
+inline constexpr auto uH = reference<dim_inductance, microhenry>{};
+inline constexpr auto mH = reference<dim_inductance, millihenry>{};
+inline constexpr auto kH = reference<dim_inductance, kilohenry>{};
+inline constexpr auto MH = reference<dim_inductance, megahenry>{};
+inline constexpr auto GH = reference<dim_inductance, gigahenry>{};
+inline constexpr auto TH = reference<dim_inductance, terahenry>{};
+inline constexpr auto PH = reference<dim_inductance, petahenry>{};
+inline constexpr auto EH = reference<dim_inductance, exahenry>{};
+inline constexpr auto ZH = reference<dim_inductance, zettahenry>{};
+inline constexpr auto YH = reference<dim_inductance, yottahenry>{};
+
+}  // namespace inductance_references
+
+namespace references {
+
+using namespace inductance_references;
+
+}  // namespace references
+
+}  // namespace units::isq::si
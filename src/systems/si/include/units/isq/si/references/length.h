@@ -0,0 +1,62 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/isq/si/length.h>
+
+namespace units::isq::si {
+
+namespace length_references {
+
+inline constexpr auto m = reference<dim_length, metre>{};
+inline constexpr auto ym = reference<dim_length, yoctometre>{};
+inline constexpr auto zm = reference<dim_length, zeptometre>{};
+inline constexpr auto am = reference<dim_length, attometre>{};
+inline constexpr auto fm = reference<dim_length, femtometre>{};
+inline constexpr auto pm = reference<dim_length, picometre>{};
+inline constexpr auto nm = reference<dim_length, nanometre>{};
+inline constexpr auto um = reference<dim_length, micrometre>{};
+inline constexpr auto mm = reference<dim_length, millimetre>{};
+inline constexpr auto cm = reference<dim_length, centimetre>{};
+inline constexpr auto dm = reference<dim_length, decimetre>{};
+inline constexpr auto dam = reference<dim_length, decametre>{};
+inline constexpr auto hm = reference<dim_length, hectometre>{};
+inline constexpr auto km = reference<dim_length, kilometre>{};
+inline constexpr auto Mm = reference<dim_length, megametre>{};
+inline constexpr auto Gm = reference<dim_length, gigametre>{};
+inline constexpr auto Tm = reference<dim_length, terametre>{};
+inline constexpr auto Pm = reference<dim_length, petametre>{};
+inline constexpr auto Em = reference<dim_length, exametre>{};
+inline constexpr auto Zm = reference<dim_length, zettametre>{};
+inline constexpr auto Ym = reference<dim_length, yottametre>{};
+inline constexpr auto au = reference<dim_length, astronomical_unit>{};
+
+}  // namespace length_references
+
+namespace references { 
+
+using namespace length_references;
+
+}  // namespace references
+
+}  // namespace units::isq::si
@@ -0,0 +1,61 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/isq/si/luminous_intensity.h>
+
+namespace units::isq::si {
+
+namespace luminous_intensity_references {
+
+inline constexpr auto cd = reference<dim_luminous_intensity, candela>{};
+inline constexpr auto ycd = reference<dim_luminous_intensity, yoctocandela>{};
+inline constexpr auto zcd = reference<dim_luminous_intensity, zeptocandela>{};
+inline constexpr auto acd = reference<dim_luminous_intensity, attocandela>{};
+inline constexpr auto fcd = reference<dim_luminous_intensity, femtocandela>{};
+inline constexpr auto pcd = reference<dim_luminous_intensity, picocandela>{};
+inline constexpr auto ncd = reference<dim_luminous_intensity, nanocandela>{};
+inline constexpr auto ucd = reference<dim_luminous_intensity, microcandela>{};
+inline constexpr auto mcd = reference<dim_luminous_intensity, millicandela>{};
+inline constexpr auto ccd = reference<dim_luminous_intensity, centicandela>{};
+inline constexpr auto dcd = reference<dim_luminous_intensity, decicandela>{};
+inline constexpr auto dacd = reference<dim_luminous_intensity, decacandela>{};
+inline constexpr auto hcd = reference<dim_luminous_intensity, hectocandela>{};
+inline constexpr auto kcd = reference<dim_luminous_intensity, kilocandela>{};
+inline constexpr auto Mcd = reference<dim_luminous_intensity, megacandela>{};
+inline constexpr auto Gcd = reference<dim_luminous_intensity, gigacandela>{};
+inline constexpr auto Tcd = reference<dim_luminous_intensity, teracandela>{};
+inline constexpr auto Pcd = reference<dim_luminous_intensity, petacandela>{};
+inline constexpr auto Ecd = reference<dim_luminous_intensity, exacandela>{};
+inline constexpr auto Zcd = reference<dim_luminous_intensity, zettacandela>{};
+inline constexpr auto Ycd = reference<dim_luminous_intensity, yottacandela>{};
+
+}  // namespace luminous_intensity_references
+
+namespace references {
+
+using namespace luminous_intensity_references;
+
+}  // namespace references
+
+}  // namespace units::isq::si
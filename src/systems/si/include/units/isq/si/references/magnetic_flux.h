@@ -0,0 +1,57 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/isq/si/magnetic_flux.h>
+
+namespace units::isq::si {
+
+namespace magnetic_flux_references {
+
+inline constexpr auto Wb = reference<dim_magnetic_flux, weber>{};
+inline constexpr auto yWb = reference<dim_magnetic_flux, yoctoweber>{};
+inline constexpr auto zWb = reference<dim_magnetic_flux, zeptoweber>{};
+inline constexpr auto aWb = reference<dim_magnetic_flux, attoweber>{};
+inline constexpr auto fWb = reference<dim_magnetic_flux, femtoweber>{};
+inline constexpr auto pWb = reference<dim_magnetic_flux, picoweber>{};
+inline constexpr auto nWb = reference<dim_magnetic_flux, nanoweber>{};
+inline constexpr auto uWb = reference<dim_magnetic_flux, microweber>{};
+inline constexpr auto mWb = reference<dim_magnetic_flux, milliweber>{};
+inline constexpr auto kWb = reference<dim_magnetic_flux, kiloweber>{};
+inline constexpr auto MWb = reference<dim_magnetic_flux, megaweber>{};
+inline constexpr auto GWb = reference<dim_magnetic_flux, gigaweber>{};
+inline constexpr auto TWb = reference<dim_magnetic_flux, teraweber>{};
+inline constexpr auto PWb = reference<dim_magnetic_flux, petaweber>{};
+inline constexpr auto EWb = reference<dim_magnetic_flux, exaweber>{};
+inline constexpr auto ZWb = reference<dim_magnetic_flux, zettaweber>{};
+inline constexpr auto YWb = reference<dim_magnetic_flux, yottaweber>{};
+
+}  // namespace magnetic_flux_references
+
+namespace references {
+
+using namespace magnetic_flux_references;
+
+}  // namespace references
+
+}  // namespace units::isq::si
@@ -0,0 +1,58 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/isq/si/magnetic_induction.h>
+
+namespace units::isq::si {
+
+namespace magnetic_induction_references {
+
+inline constexpr auto T = reference<dim_magnetic_induction, tesla>{};
+inline constexpr auto yT = reference<dim_magnetic_induction, yoctotesla>{};
+inline constexpr auto zT = reference<dim_magnetic_induction, zeptotesla>{};
+inline constexpr auto aT = reference<dim_magnetic_induction, attotesla>{};
+inline constexpr auto fT = reference<dim_magnetic_induction, femtotesla>{};
+inline constexpr auto pT = reference<dim_magnetic_induction, picotesla>{};
+inline constexpr auto nT = reference<dim_magnetic_induction, nanotesla>{};
+inline constexpr auto uT = reference<dim_magnetic_induction, microtesla>{};
+inline constexpr auto mT = reference<dim_magnetic_induction, millitesla>{};
+inline constexpr auto kT = reference<dim_magnetic_induction, kilotesla>{};
+inline constexpr auto MT = reference<dim_magnetic_induction, megatesla>{};
+inline constexpr auto GT = reference<dim_magnetic_induction, gigatesla>{};
+inline constexpr auto TT = reference<dim_magnetic_induction, teratesla>{};
+inline constexpr auto PT = reference<dim_magnetic_induction, petatesla>{};
+inline constexpr auto ET = reference<dim_magnetic_induction, exatesla>{};
+inline constexpr auto ZT = reference<dim_magnetic_induction, zettatesla>{};
+inline constexpr auto YT = reference<dim_magnetic_induction, yottatesla>{};
+inline constexpr auto G = reference<dim_magnetic_induction, gauss>{};
+
+}  // namespace magnetic_induction_references
+
+namespace references {
+
+using namespace magnetic_induction_references;
+
+}  // namespace references
+
+}  // namespace units::isq::si
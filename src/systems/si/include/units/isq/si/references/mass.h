@@ -0,0 +1,84 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/isq/si/mass.h>
+
+namespace units::isq::si {
+
+namespace mass_references {
+
+inline constexpr auto g = reference<dim_mass, gram>{};
+inline constexpr auto yg = reference<dim_mass, yoctogram>{};
+inline constexpr auto zg = reference<dim_mass, zeptogram>{};
+inline constexpr auto ag = reference<dim_mass, attogram>{};
+inline constexpr auto fg = reference<dim_mass, femtogram>{};
+inline constexpr auto pg = reference<dim_mass, picogram>{};
+inline constexpr auto ng = reference<dim_mass, nanogram>{};
+inline constexpr auto ug = reference<dim_mass, microgram>{};
+inline constexpr auto mg = reference<dim_mass, milligram>{};
+inline constexpr auto cg = reference<dim_mass, centigram>{};
+inline constexpr auto dg = reference<dim_mass, decigram>{};
+inline constexpr auto dag = reference<dim_mass, decagram>{};
+inline constexpr auto hg = reference<dim_mass, hectogram>{};
+inline constexpr auto kg = reference<dim_mass, kilogram>{};
+inline constexpr auto Mg = reference<dim_mass, megagram>{};
+inline constexpr auto Gg = reference<dim_mass, gigagram>{};
+inline constexpr auto Tg = reference<dim_mass, teragram>{};
+inline constexpr auto Pg = reference<dim_mass, petagram>{};
+inline constexpr auto Eg = reference<dim_mass, exagram>{};
+inline constexpr auto Zg = reference<dim_mass, zettagram>{};
+inline constexpr auto Yg = reference<dim_mass, yottagram>{};
+
+inline constexpr auto t = reference<dim_mass, tonne>{};
+inline constexpr auto yt = reference<dim_mass, yoctotonne>{};
+inline constexpr auto zt = reference<dim_mass, zeptotonne>{};
+inline constexpr auto at = reference<dim_mass, attotonne>{};
+inline constexpr auto ft = reference<dim_mass, femtotonne>{};
+inline constexpr auto pt = reference<dim_mass, picotonne>{};
+inline constexpr auto nt = reference<dim_mass, nanotonne>{};
+inline constexpr auto ut = reference<dim_mass, microtonne>{};
+inline constexpr auto mt = reference<dim_mass, millitonne>{};
+inline constexpr auto ct = reference<dim_mass, centitonne>{};
+inline constexpr auto dt = reference<dim_mass, decitonne>{};
+inline constexpr auto dat = reference<dim_mass, decatonne>{};
+inline constexpr auto ht = reference<dim_mass, hectotonne>{};
+inline constexpr auto kt = reference<dim_mass, kilotonne>{};
+inline constexpr auto Mt = reference<dim_mass, megatonne>{};
+inline constexpr auto Gt = reference<dim_mass, gigatonne>{};
+inline constexpr auto Tt = reference<dim_mass, teratonne>{};
+inline constexpr auto Pt = reference<dim_mass, petatonne>{};
+inline constexpr auto Et = reference<dim_mass, exatonne>{};
+inline constexpr auto Zt = reference<dim_mass, zettatonne>{};
+inline constexpr auto Yt = reference<dim_mass, yottatonne>{};
+inline constexpr auto Da = reference<dim_mass, dalton>{};
+
+}  // namespace mass_references
+
+namespace references {
+
+using namespace mass_references;
+
+}  // namespace references
+
+}  // namespace units::isq::si
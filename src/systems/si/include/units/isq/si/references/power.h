@@ -0,0 +1,57 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/isq/si/power.h>
+
+namespace units::isq::si {
+
+namespace power_references {
+
+inline constexpr auto W = reference<dim_power, watt>{};
+inline constexpr auto yW = reference<dim_power, yoctowatt>{};
+inline constexpr auto zW = reference<dim_power, zeptowatt>{};
+inline constexpr auto aW = reference<dim_power, attowatt>{};
+inline constexpr auto fW = reference<dim_power, femtowatt>{};
+inline constexpr auto pW = reference<dim_power, picowatt>{};
+inline constexpr auto nW = reference<dim_power, nanowatt>{};
+inline constexpr auto uW = reference<dim_power, microwatt>{};
+inline constexpr auto mW = reference<dim_power, milliwatt>{};
+inline constexpr auto kW = reference<dim_power, kilowatt>{};
+inline constexpr auto MW = reference<dim_power, megawatt>{};
+inline constexpr auto GW = reference<dim_power, gigawatt>{};
+inline constexpr auto TW = reference<dim_power, terawatt>{};
+inline constexpr auto PW = reference<dim_power, petawatt>{};
+inline constexpr auto EW = reference<dim_power, exawatt>{};
+inline constexpr auto ZW = reference<dim_power, zettawatt>{};
+inline constexpr auto YW = reference<dim_power, yottawatt>{};
+
+}  // namespace power_references
+
+namespace references {
+
+using namespace power_references;
+
+}  // namespace references
+
+}  // namespace units::isq::si
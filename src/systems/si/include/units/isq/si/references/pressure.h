@@ -0,0 +1,61 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/isq/si/pressure.h>
+
+namespace units::isq::si {
+
+namespace pressure_references {
+
+inline constexpr auto Pa = reference<dim_pressure, pascal>{};
+inline constexpr auto yPa = reference<dim_pressure, yoctopascal>{};
+inline constexpr auto zPa = reference<dim_pressure, zeptopascal>{};
+inline constexpr auto aPa = reference<dim_pressure, attopascal>{};
+inline constexpr auto fPa = reference<dim_pressure, femtopascal>{};
+inline constexpr auto pPa = reference<dim_pressure, picopascal>{};
+inline constexpr auto nPa = reference<dim_pressure, nanopascal>{};
+inline constexpr auto uPa = reference<dim_pressure, micropascal>{};
+inline constexpr auto mPa = reference<dim_pressure, millipascal>{};
+inline constexpr auto cPa = reference<dim_pressure, centipascal>{};
+inline constexpr auto dPa = reference<dim_pressure, decipascal>{};
+inline constexpr auto daPa = reference<dim_pressure, decapascal>{};
+inline constexpr auto hPa = reference<dim_pressure, hectopascal>{};
+inline constexpr auto kPa = reference<dim_pressure, kilopascal>{};
+inline constexpr auto MPa = reference<dim_pressure, megapascal>{};
+inline constexpr auto GPa = reference<dim_pressure, gigapascal>{};
+inline constexpr auto TPa = reference<dim_pressure, terapascal>{};
+inline constexpr auto PPa = reference<dim_pressure, petapascal>{};
+inline constexpr auto EPa = reference<dim_pressure, exapascal>{};
+inline constexpr auto ZPa = reference<dim_pressure, zettapascal>{};
+inline constexpr auto YPa = reference<dim_pressure, yottapascal>{};
+
+}  // namespace pressure_references
+
+namespace references {
+
+using namespace pressure_references;
+
+}  // namespace references
+
+}  // namespace units::isq::si
@@ -0,0 +1,61 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/isq/si/radioactivity.h>
+
+namespace units::isq::si {
+
+namespace radioactivity_references {
+
+inline constexpr auto Bq = reference<dim_radioactivity, becquerel>{};
+inline constexpr auto yBq = reference<dim_radioactivity, yoctobecquerel>{};
+inline constexpr auto zBq = reference<dim_radioactivity, zeptobecquerel>{};
+inline constexpr auto aBq = reference<dim_radioactivity, attobecquerel>{};
+inline constexpr auto fBq = reference<dim_radioactivity, femtobecquerel>{};
+inline constexpr auto pBq = reference<dim_radioactivity, picobecquerel>{};
+inline constexpr auto nBq = reference<dim_radioactivity, nanobecquerel>{};
+inline constexpr auto uBq = reference<dim_radioactivity, microbecquerel>{};
+inline constexpr auto mBq = reference<dim_radioactivity, millibecquerel>{};
+inline constexpr auto cBq = reference<dim_radioactivity, centibecquerel>{};
+inline constexpr auto dBq = reference<dim_radioactivity, decibecquerel>{};
+inline constexpr auto daBq = reference<dim_radioactivity, decabecquerel>{};
+inline constexpr auto hBq = reference<dim_radioactivity, hectobecquerel>{};
+inline constexpr auto kBq = reference<dim_radioactivity, kilobecquerel>{};
+inline constexpr auto MBq = reference<dim_radioactivity, megabecquerel>{};
+inline constexpr auto GBq = reference<dim_radioactivity, gigabecquerel>{};
+inline constexpr auto TBq = reference<dim_radioactivity, terabecquerel>{};
+inline constexpr auto PBq = reference<dim_radioactivity, petabecquerel>{};
+inline constexpr auto EBq = reference<dim_radioactivity, exabecquerel>{};
+inline constexpr auto ZBq = reference<dim_radioactivity, zettabecquerel>{};
+inline constexpr auto YBq = reference<dim_radioactivity, yottabecquerel>{};
+
+}  // namespace radioactivity_references
+
+namespace references {
+
+using namespace radioactivity_references;
+
+}  // namespace references
+
+}  // namespace units::isq::si
@@ -0,0 +1,57 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/isq/si/resistance.h>
+
+namespace units::isq::si {
+
+namespace resistance_references {
+
+inline constexpr auto R = reference<dim_resistance, ohm>{};
+inline constexpr auto yR = reference<dim_resistance, yoctoohm>{};
+inline constexpr auto zR = reference<dim_resistance, zeptoohm>{};
+inline constexpr auto aR = reference<dim_resistance, attoohm>{};
+inline constexpr auto fR = reference<dim_resistance, femtoohm>{};
+inline constexpr auto pR = reference<dim_resistance, picoohm>{};
+inline constexpr auto nR = reference<dim_resistance, nanoohm>{};
+inline constexpr auto uR = reference<dim_resistance, microohm>{};
+inline constexpr auto mR = reference<dim_resistance, milliohm>{};
+inline constexpr auto kR = reference<dim_resistance, kiloohm>{};
+inline constexpr auto MR = reference<dim_resistance, megaohm>{};
+inline constexpr auto GR = reference<dim_resistance, gigaohm>{};
+inline constexpr auto TR = reference<dim_resistance, teraohm>{};
+inline constexpr auto PR = reference<dim_resistance, petaohm>{};
+inline constexpr auto ER = reference<dim_resistance, exaohm>{};
+inline constexpr auto ZR = reference<dim_resistance, zettaohm>{};
+inline constexpr auto YR = reference<dim_resistance, yottaohm>{};
+
+}  // namespace resistance_references
+
+namespace references {
+
+using namespace resistance_references;
+
+}  // namespace references
+
+}  // namespace units::isq::si
@@ -0,0 +1,52 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/isq/si/time.h>
+
+namespace units::isq::si {
+
+namespace time_references {
+
+inline constexpr auto ys = reference<dim_time, yoctosecond>{};
+inline constexpr auto zs = reference<dim_time, zeptosecond>{};
+inline constexpr auto as = reference<dim_time, attosecond>{};
+inline constexpr auto fs = reference<dim_time, femtosecond>{};
+inline constexpr auto ps = reference<dim_time, picosecond>{};
+inline constexpr auto ns = reference<dim_time, nanosecond>{};
+inline constexpr auto us = reference<dim_time, microsecond>{};
+inline constexpr auto ms = reference<dim_time, millisecond>{};
+inline constexpr auto s = reference<dim_time, second>{};
+inline constexpr auto min = reference<dim_time, minute>{};
+inline constexpr auto h = reference<dim_time, hour>{};
+inline constexpr auto d = reference<dim_time, day>{};
+
+}  // namespace time_references
+
+namespace references {
+
+using namespace time_references;
+
+} // namespace references
+
+}  // namespace units::isq::si
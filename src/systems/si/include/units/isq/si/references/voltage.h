@@ -0,0 +1,61 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/isq/si/voltage.h>
+
+namespace units::isq::si {
+
+namespace voltage_references {
+
+inline constexpr auto V = reference<dim_voltage, volt>{};
+inline constexpr auto yV = reference<dim_voltage, yoctovolt>{};
+inline constexpr auto zV = reference<dim_voltage, zeptovolt>{};
+inline constexpr auto aV = reference<dim_voltage, attovolt>{};
+inline constexpr auto fV = reference<dim_voltage, femtovolt>{};
+inline constexpr auto pV = reference<dim_voltage, picovolt>{};
+inline constexpr auto nV = reference<dim_voltage, nanovolt>{};
+inline constexpr auto uV = reference<dim_voltage, microvolt>{};
+inline constexpr auto mV = reference<dim_voltage, millivolt>{};
+inline constexpr auto cV = reference<dim_voltage, centivolt>{};
+inline constexpr auto dV = reference<dim_voltage, decivolt>{};
+inline constexpr auto daV = reference<dim_voltage, decavolt>{};
+inline constexpr auto hV = reference<dim_voltage, hectovolt>{};
+inline constexpr auto kV = reference<dim_voltage, kilovolt>{};
+inline constexpr auto MV = reference<dim_voltage, megavolt>{};
+inline constexpr auto GV = reference<dim_voltage, gigavolt>{};
+inline constexpr auto TV = reference<dim_voltage, teravolt>{};
+inline constexpr auto PV = reference<dim_voltage, petavolt>{};
+inline constexpr auto EV = reference<dim_voltage, exavolt>{};
+inline constexpr auto ZV = reference<dim_voltage, zettavolt>{};
+inline constexpr auto YV = reference<dim_voltage, yottavolt>{};
+
+}  // namespace voltage_references
+
+namespace references {
+
+using namespace voltage_references;
+
+}  // namespace references
+
+}  // namespace units::isq::si
@@ -0,0 +1,83 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/isq/si/volume.h>
+
+namespace units::isq::si {
+
+namespace volume_references {
+
+inline constexpr auto m3 = reference<dim_volume, cubic_metre>{};
+inline constexpr auto ym3 = reference<dim_volume, cubic_yoctometre>{};
+inline constexpr auto zm3 = reference<dim_volume, cubic_zeptometre>{};
+inline constexpr auto am3 = reference<dim_volume, cubic_attometre>{};
+inline constexpr auto fm3 = reference<dim_volume, cubic_femtometre>{};
+inline constexpr auto pm3 = reference<dim_volume, cubic_picometre>{};
+inline constexpr auto nm3 = reference<dim_volume, cubic_nanometre>{};
+inline constexpr auto um3 = reference<dim_volume, cubic_micrometre>{};
+inline constexpr auto mm3 = reference<dim_volume, cubic_millimetre>{};
+inline constexpr auto cm3 = reference<dim_volume, cubic_centimetre>{};
+inline constexpr auto dm3 = reference<dim_volume, cubic_decimetre>{};
+inline constexpr auto dam3 = reference<dim_volume, cubic_decametre>{};
+inline constexpr auto hm3 = reference<dim_volume, cubic_hectometre>{};
+inline constexpr auto km3 = reference<dim_volume, cubic_kilometre>{};
+inline constexpr auto Mm3 = reference<dim_volume, cubic_megametre>{};
+inline constexpr auto Gm3 = reference<dim_volume, cubic_gigametre>{};
+inline constexpr auto Tm3 = reference<dim_volume, cubic_terametre>{};
+inline constexpr auto Pm3 = reference<dim_volume, cubic_petametre>{};
+inline constexpr auto Em3 = reference<dim_volume, cubic_exametre>{};
+inline constexpr auto Zm3 = reference<dim_volume, cubic_zettametre>{};
+inline constexpr auto Ym3 = reference<dim_volume, cubic_yottametre>{};
+
+inline constexpr auto l = reference<dim_volume, litre>{};
+inline constexpr auto yl = reference<dim_volume, yoctolitre>{};
+inline constexpr auto zl = reference<dim_volume, zeptolitre>{};
+inline constexpr auto al = reference<dim_volume, attolitre>{};
+inline constexpr auto fl = reference<dim_volume, femtolitre>{};
+inline constexpr auto pl = reference<dim_volume, picolitre>{};
+inline constexpr auto nl = reference<dim_volume, nanolitre>{};
+inline constexpr auto ul = reference<dim_volume, microlitre>{};
+inline constexpr auto ml = reference<dim_volume, millilitre>{};
+inline constexpr auto cl = reference<dim_volume, centilitre>{};
+inline constexpr auto dl = reference<dim_volume, decilitre>{};
+inline constexpr auto dal = reference<dim_volume, decalitre>{};
+inline constexpr auto hl = reference<dim_volume, hectolitre>{};
+inline constexpr auto kl = reference<dim_volume, kilolitre>{};
+inline constexpr auto Ml = reference<dim_volume, megalitre>{};
+inline constexpr auto Gl = reference<dim_volume, gigalitre>{};
+inline constexpr auto Tl = reference<dim_volume, teralitre>{};
+inline constexpr auto Pl = reference<dim_volume, petalitre>{};
+inline constexpr auto El = reference<dim_volume, exalitre>{};
+inline constexpr auto Zl = reference<dim_volume, zettalitre>{};
+inline constexpr auto Yl = reference<dim_volume, yottalitre>{};
+
+}  // namespace volume_references
+
+namespace references {
+
+using namespace volume_references;
+
+}  // namespace references
+
+}  // namespace units::isq::si
@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/speed.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/symbol_text.h>
 // IWYU pragma: end_exports
@@ -39,27 +40,12 @@ struct dim_speed : isq::dim_speed<dim_speed, metre_per_second, dim_length, dim_t
 
 struct kilometre_per_hour : derived_unit<kilometre_per_hour, dim_speed, kilometre, hour> {};
 
-template<UnitOf<dim_speed> U, Representation Rep = double>
-using speed = quantity<dim_speed, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// m/s
-constexpr auto operator"" _q_m_per_s(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return speed<metre_per_second, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_m_per_s(long double l) { return speed<metre_per_second, long double>(l); }
-
-// km/h
-constexpr auto operator"" _q_km_per_h(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return speed<kilometre_per_hour, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_km_per_h(long double l) { return speed<kilometre_per_hour, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::metre_per_second);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_speed);
+UNITS_DOWNCAST_REGISTER(units::isq::si::kilometre_per_hour);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline speed {
@@ -70,3 +56,7 @@ template<Representation Rep = double> using km_per_h = units::isq::si::speed<uni
 }  // namespace units::aliases::isq::si::inline speed
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/speed.h>
+#endif // UNITS_NO_LITERALS
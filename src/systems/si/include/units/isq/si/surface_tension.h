@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/surface_tension.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/symbol_text.h>
 // IWYU pragma: end_exports
@@ -37,23 +38,11 @@ struct newton_per_metre : unit<newton_per_metre> {};
 
 struct dim_surface_tension : isq::dim_surface_tension<dim_surface_tension, newton_per_metre, dim_force, dim_length> {};
 
-template<UnitOf<dim_surface_tension> U, Representation Rep = double>
-using surface_tension = quantity<dim_surface_tension, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// N/m
-constexpr auto operator"" _q_N_per_m(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return surface_tension<newton_per_metre, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_N_per_m(long double l) { return surface_tension<newton_per_metre, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::newton_per_metre);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_surface_tension);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline surface_tension {
@@ -63,3 +52,7 @@ template<Representation Rep = double> using N_per_m = units::isq::si::surface_te
 }  // namespace units::aliases::isq::si::inline surface_tension
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/surface_tension.h>
+#endif // UNITS_NO_LITERALS
@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/thermal_conductivity.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/symbol_text.h>
 // IWYU pragma: end_exports
@@ -38,23 +39,11 @@ struct watt_per_metre_kelvin : unit<watt_per_metre_kelvin> {};
 
 struct dim_thermal_conductivity : isq::dim_thermal_conductivity<dim_thermal_conductivity, watt_per_metre_kelvin, dim_power, dim_length, dim_thermodynamic_temperature> {};
 
-template<UnitOf<dim_thermal_conductivity> U, Representation Rep = double>
-using thermal_conductivity = quantity<dim_thermal_conductivity, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// W/(m K)
-constexpr auto operator"" _q_W_per_m_K(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return thermal_conductivity<watt_per_metre_kelvin, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_W_per_m_K(long double l) { return thermal_conductivity<watt_per_metre_kelvin, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::watt_per_metre_kelvin);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_thermal_conductivity);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline thermal_conductivity {
@@ -64,3 +53,7 @@ template<Representation Rep = double> using W_per_m_K = units::isq::si::thermal_
 }  // namespace units::aliases::isq::si::inline thermal_conductivity
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/thermal_conductivity.h>
+#endif // UNITS_NO_LITERALS
@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/thermodynamic_temperature.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/reference.h>
 #include <units/symbol_text.h>
@@ -37,39 +38,10 @@ struct kelvin : named_unit<kelvin, "K", no_prefix> {};
 
 struct dim_thermodynamic_temperature : isq::dim_thermodynamic_temperature<kelvin> {};
 
-template<UnitOf<dim_thermodynamic_temperature> U, Representation Rep = double>
-using thermodynamic_temperature = quantity<dim_thermodynamic_temperature, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// K
-constexpr auto operator"" _q_K(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return thermodynamic_temperature<kelvin, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_K(long double l) { return thermodynamic_temperature<kelvin, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
-#ifndef UNITS_NO_REFERENCES
-
-namespace thermodynamic_temperature_references {
-
-inline constexpr auto K = reference<dim_thermodynamic_temperature, kelvin>{};
-
-}  // namespace thermodynamic_temperature_references
-
-namespace references {
-
-using namespace thermodynamic_temperature_references;
-
-}  // namespace references
-
-#endif // UNITS_NO_REFERENCES
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::kelvin);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline thermodynamic_temperature {
@@ -79,3 +51,11 @@ template<Representation Rep = double> using K = units::isq::si::thermodynamic_te
 }  // namespace units::aliases::isq::si::inline thermodynamic_temperature
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/thermodynamic_temperature.h>
+#endif // UNITS_NO_LITERALS
+
+#ifndef UNITS_NO_REFERENCES
+#include <units/isq/si/references/thermodynamic_temperature.h>
+#endif // UNITS_NO_REFERENCES
@@ -23,6 +23,7 @@
 #pragma once
 
 // IWYU pragma: begin_exports
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/reference.h>
 #include <units/symbol_text.h>
@@ -49,94 +50,21 @@ struct day : named_scaled_unit<day, "d", no_prefix, ratio(24), hour> {};
 
 struct dim_time : isq::dim_time<second> {};
 
-template<UnitOf<dim_time> U, Representation Rep = double>
-using time = quantity<dim_time, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// ys
-constexpr auto operator"" _q_ys(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return time<yoctosecond, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_ys(long double l) { return time<yoctosecond, long double>(l); }
-
-// zs
-constexpr auto operator"" _q_zs(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return time<zeptosecond, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_zs(long double l) { return time<zeptosecond, long double>(l); }
-
-// as
-constexpr auto operator"" _q_as(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return time<attosecond, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_as(long double l) { return time<attosecond, long double>(l); }
-
-// fs
-constexpr auto operator"" _q_fs(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return time<femtosecond, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_fs(long double l) { return time<femtosecond, long double>(l); }
-
-// ps
-constexpr auto operator"" _q_ps(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return time<picosecond, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_ps(long double l) { return time<picosecond, long double>(l); }
-
-// ns
-constexpr auto operator"" _q_ns(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return time<nanosecond, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_ns(long double l) { return time<nanosecond, long double>(l); }
-
-// us
-constexpr auto operator"" _q_us(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return time<microsecond, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_us(long double l) { return time<microsecond, long double>(l); }
-
-// ms
-constexpr auto operator"" _q_ms(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return time<millisecond, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_ms(long double l) { return time<millisecond, long double>(l); }
-
-// s
-constexpr auto operator"" _q_s(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return time<second, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_s(long double l) { return time<second, long double>(l); }
-
-// min
-constexpr auto operator"" _q_min(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return time<minute, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_min(long double l) { return time<minute, long double>(l); }
-
-// h
-constexpr auto operator"" _q_h(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return time<hour, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_h(long double l) { return time<hour, long double>(l); }
-
-// d
-constexpr auto operator"" _q_d(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return time<day, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_d(long double l) { return time<day, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
-#ifndef UNITS_NO_REFERENCES
-
-namespace time_references {
-
-inline constexpr auto ys = reference<dim_time, yoctosecond>{};
-inline constexpr auto zs = reference<dim_time, zeptosecond>{};
-inline constexpr auto as = reference<dim_time, attosecond>{};
-inline constexpr auto fs = reference<dim_time, femtosecond>{};
-inline constexpr auto ps = reference<dim_time, picosecond>{};
-inline constexpr auto ns = reference<dim_time, nanosecond>{};
-inline constexpr auto us = reference<dim_time, microsecond>{};
-inline constexpr auto ms = reference<dim_time, millisecond>{};
-inline constexpr auto s = reference<dim_time, second>{};
-inline constexpr auto min = reference<dim_time, minute>{};
-inline constexpr auto h = reference<dim_time, hour>{};
-inline constexpr auto d = reference<dim_time, day>{};
-
-}  // namespace time_references
-
-namespace references {
-
-using namespace time_references;
-
-} // namespace references
-
-#endif // UNITS_NO_REFERENCES
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::second);
+UNITS_DOWNCAST_REGISTER(units::isq::si::yoctosecond);
+UNITS_DOWNCAST_REGISTER(units::isq::si::zeptosecond);
+UNITS_DOWNCAST_REGISTER(units::isq::si::attosecond);
+UNITS_DOWNCAST_REGISTER(units::isq::si::femtosecond);
+UNITS_DOWNCAST_REGISTER(units::isq::si::picosecond);
+UNITS_DOWNCAST_REGISTER(units::isq::si::nanosecond);
+UNITS_DOWNCAST_REGISTER(units::isq::si::microsecond);
+UNITS_DOWNCAST_REGISTER(units::isq::si::millisecond);
+UNITS_DOWNCAST_REGISTER(units::isq::si::minute);
+UNITS_DOWNCAST_REGISTER(units::isq::si::hour);
+UNITS_DOWNCAST_REGISTER(units::isq::si::day);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline time {
@@ -157,3 +85,11 @@ template<Representation Rep = double> using d = units::isq::si::time<units::isq:
 }  // namespace units::aliases::isq::si::inline time
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/time.h>
+#endif // UNITS_NO_LITERALS
+
+#ifndef UNITS_NO_REFERENCES
+#include <units/isq/si/references/time.h>
+#endif // UNITS_NO_REFERENCES
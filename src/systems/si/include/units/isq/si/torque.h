@@ -24,6 +24,7 @@
 
 // IWYU pragma: begin_exports
 #include <units/isq/dimensions/torque.h>
+#include <units/isq/si/fwd.h>
 #include <units/quantity.h>
 #include <units/symbol_text.h>
 // IWYU pragma: end_exports
@@ -39,23 +40,11 @@ struct newton_metre_per_radian : unit<newton_metre_per_radian> {};
 
 struct dim_torque : isq::dim_torque<dim_torque, newton_metre_per_radian, dim_force, dim_length, dim_angle<>> {};
 
-template<UnitOf<dim_torque> U, Representation Rep = double>
-using torque = quantity<dim_torque, U, Rep>;
-
-#ifndef UNITS_NO_LITERALS
-
-inline namespace literals {
-
-// Nm
-constexpr auto operator"" _q_N_m_per_rad(unsigned long long l) { gsl_ExpectsAudit(std::in_range<std::int64_t>(l)); return torque<newton_metre_per_radian, std::int64_t>(static_cast<std::int64_t>(l)); }
-constexpr auto operator"" _q_N_m_per_rad(long double l) { return torque<newton_metre_per_radian, long double>(l); }
-
-}  // namespace literals
-
-#endif // UNITS_NO_LITERALS
-
 }  // namespace units::isq::si
 
+UNITS_DOWNCAST_REGISTER(units::isq::si::newton_metre_per_radian);
+UNITS_DOWNCAST_REGISTER(units::isq::si::dim_torque);
+
 #ifndef UNITS_NO_ALIASES
 
 namespace units::aliases::isq::si::inline torque {
@@ -65,3 +54,7 @@ template<Representation Rep = double> using N_m_per_rad = units::isq::si::torque
 }  // namespace units::aliases::isq::si::inline torque
 
 #endif // UNITS_NO_ALIASES
+
+#ifndef UNITS_NO_LITERALS
+#include <units/isq/si/literals/torque.h>
+#endif // UNITS_NO_LITERALS
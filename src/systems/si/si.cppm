@@ -0,0 +1,2865 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+module;
+
+#include <units/isq/si/si.h>
+#include <units/generic/angle.h>
+#include <units/chrono.h>
+
+export module mp_units.systems.si;
+
+export import mp_units.systems.isq;
+
+export namespace units {
+
+using units::radian;
+using units::dim_angle;
+using units::Angle;
+using units::angle;
+using units::clock_origin;
+
+}  // namespace units
+
+export namespace units::isq::si {
+
+using units::isq::si::gray;
+using units::isq::si::yoctogray;
+using units::isq::si::zeptogray;
+using units::isq::si::attogray;
+using units::isq::si::femtogray;
+using units::isq::si::picogray;
+using units::isq::si::nanogray;
+using units::isq::si::microgray;
+using units::isq::si::milligray;
+using units::isq::si::centigray;
+using units::isq::si::decigray;
+using units::isq::si::decagray;
+using units::isq::si::hectogray;
+using units::isq::si::kilogray;
+using units::isq::si::megagray;
+using units::isq::si::gigagray;
+using units::isq::si::teragray;
+using units::isq::si::petagray;
+using units::isq::si::exagray;
+using units::isq::si::zettagray;
+using units::isq::si::yottagray;
+using units::isq::si::dim_absorbed_dose;
+using units::isq::si::absorbed_dose;
+using units::isq::si::metre_per_second_sq;
+using units::isq::si::dim_acceleration;
+using units::isq::si::acceleration;
+using units::isq::si::mole;
+using units::isq::si::dim_amount_of_substance;
+using units::isq::si::amount_of_substance;
+using units::isq::si::radian_per_second;
+using units::isq::si::dim_angular_velocity;
+using units::isq::si::angular_velocity;
+using units::isq::si::square_metre;
+using units::isq::si::dim_area;
+using units::isq::si::square_yoctometre;
+using units::isq::si::square_zeptometre;
+using units::isq::si::square_attometre;
+using units::isq::si::square_femtometre;
+using units::isq::si::square_picometre;
+using units::isq::si::square_nanometre;
+using units::isq::si::square_micrometre;
+using units::isq::si::square_millimetre;
+using units::isq::si::square_centimetre;
+using units::isq::si::square_decimetre;
+using units::isq::si::square_decametre;
+using units::isq::si::square_hectometre;
+using units::isq::si::square_kilometre;
+using units::isq::si::square_megametre;
+using units::isq::si::square_gigametre;
+using units::isq::si::square_terametre;
+using units::isq::si::square_petametre;
+using units::isq::si::square_exametre;
+using units::isq::si::square_zettametre;
+using units::isq::si::square_yottametre;
+using units::isq::si::hectare;
+using units::isq::si::area;
+using units::isq::si::farad;
+using units::isq::si::yoctofarad;
+using units::isq::si::zeptofarad;
+using units::isq::si::attofarad;
+using units::isq::si::femtofarad;
+using units::isq::si::picofarad;
+using units::isq::si::nanofarad;
+using units::isq::si::microfarad;
+using units::isq::si::millifarad;
+using units::isq::si::centifarad;
+using units::isq::si::decifarad;
+using units::isq::si::decafarad;
+using units::isq::si::hectofarad;
+using units::isq::si::kilofarad;
+using units::isq::si::megafarad;
+using units::isq::si::gigafarad;
+using units::isq::si::terafarad;
+using units::isq::si::petafarad;
+using units::isq::si::exafarad;
+using units::isq::si::zettafarad;
+using units::isq::si::yottafarad;
+using units::isq::si::dim_capacitance;
+using units::isq::si::capacitance;
+using units::isq::si::katal;
+using units::isq::si::yoctokatal;
+using units::isq::si::zeptokatal;
+using units::isq::si::attokatal;
+using units::isq::si::femtokatal;
+using units::isq::si::picokatal;
+using units::isq::si::nanokatal;
+using units::isq::si::microkatal;
+using units::isq::si::millikatal;
+using units::isq::si::centikatal;
+using units::isq::si::decikatal;
+using units::isq::si::decakatal;
+using units::isq::si::hectokatal;
+using units::isq::si::kilokatal;
+using units::isq::si::megakatal;
+using units::isq::si::gigakatal;
+using units::isq::si::terakatal;
+using units::isq::si::petakatal;
+using units::isq::si::exakatal;
+using units::isq::si::zettakatal;
+using units::isq::si::yottakatal;
+using units::isq::si::enzyme_unit;
+using units::isq::si::dim_catalytic_activity;
+using units::isq::si::catalytic_activity;
+using units::isq::si::coulomb_per_metre_cub;
+using units::isq::si::coulomb_per_metre_sq;
+using units::isq::si::dim_charge_density;
+using units::isq::si::dim_surface_charge_density;
+using units::isq::si::charge_density;
+using units::isq::si::surface_charge_density;
+using units::isq::si::mol_per_metre_cub;
+using units::isq::si::dim_concentration;
+using units::isq::si::concentration;
+using units::isq::si::siemens;
+using units::isq::si::yoctosiemens;
+using units::isq::si::zeptosiemens;
+using units::isq::si::attosiemens;
+using units::isq::si::femtosiemens;
+using units::isq::si::picosiemens;
+using units::isq::si::nanosiemens;
+using units::isq::si::microsiemens;
+using units::isq::si::millisiemens;
+using units::isq::si::kilosiemens;
+using units::isq::si::megasiemens;
+using units::isq::si::gigasiemens;
+using units::isq::si::terasiemens;
+using units::isq::si::petasiemens;
+using units::isq::si::exasiemens;
+using units::isq::si::zettasiemens;
+using units::isq::si::yottasiemens;
+using units::isq::si::dim_conductance;
+using units::isq::si::conductance;
+using units::isq::si::ampere_per_metre_sq;
+using units::isq::si::dim_current_density;
+using units::isq::si::current_density;
+using units::isq::si::kilogram_per_metre_cub;
+using units::isq::si::dim_density;
+using units::isq::si::density;
+using units::isq::si::pascal_second;
+using units::isq::si::dim_dynamic_viscosity;
+using units::isq::si::dynamic_viscosity;
+using units::isq::si::coulomb;
+using units::isq::si::dim_electric_charge;
+using units::isq::si::electric_charge;
+using units::isq::si::ampere;
+using units::isq::si::yoctoampere;
+using units::isq::si::zeptoampere;
+using units::isq::si::attoampere;
+using units::isq::si::femtoampere;
+using units::isq::si::picoampere;
+using units::isq::si::nanoampere;
+using units::isq::si::microampere;
+using units::isq::si::milliampere;
+using units::isq::si::centiampere;
+using units::isq::si::deciampere;
+using units::isq::si::decaampere;
+using units::isq::si::hectoampere;
+using units::isq::si::kiloampere;
+using units::isq::si::megaampere;
+using units::isq::si::gigaampere;
+using units::isq::si::teraampere;
+using units::isq::si::petaampere;
+using units::isq::si::exaampere;
+using units::isq::si::zettaampere;
+using units::isq::si::yottaampere;
+using units::isq::si::dim_electric_current;
+using units::isq::si::electric_current;
+using units::isq::si::volt_per_metre;
+using units::isq::si::dim_electric_field_strength;
+using units::isq::si::electric_field_strength;
+using units::isq::si::joule;
+using units::isq::si::yoctojoule;
+using units::isq::si::zeptojoule;
+using units::isq::si::attojoule;
+using units::isq::si::femtojoule;
+using units::isq::si::picojoule;
+using units::isq::si::nanojoule;
+using units::isq::si::microjoule;
+using units::isq::si::millijoule;
+using units::isq::si::kilojoule;
+using units::isq::si::megajoule;
+using units::isq::si::gigajoule;
+using units::isq::si::terajoule;
+using units::isq::si::petajoule;
+using units::isq::si::exajoule;
+using units::isq::si::zettajoule;
+using units::isq::si::yottajoule;
+using units::isq::si::electronvolt;
+using units::isq::si::gigaelectronvolt;
+using units::isq::si::dim_energy;
+using units::isq::si::energy;
+using units::isq::si::newton;
+using units::isq::si::yoctonewton;
+using units::isq::si::zeptonewton;
+using units::isq::si::attonewton;
+using units::isq::si::femtonewton;
+using units::isq::si::piconewton;
+using units::isq::si::nanonewton;
+using units::isq::si::micronewton;
+using units::isq::si::millinewton;
+using units::isq::si::centinewton;
+using units::isq::si::decinewton;
+using units::isq::si::decanewton;
+using units::isq::si::hectonewton;
+using units::isq::si::kilonewton;
+using units::isq::si::meganewton;
+using units::isq::si::giganewton;
+using units::isq::si::teranewton;
+using units::isq::si::petanewton;
+using units::isq::si::exanewton;
+using units::isq::si::zettanewton;
+using units::isq::si::yottanewton;
+using units::isq::si::dim_force;
+using units::isq::si::force;
+using units::isq::si::hertz;
+using units::isq::si::yoctohertz;
+using units::isq::si::zeptohertz;
+using units::isq::si::attohertz;
+using units::isq::si::femtohertz;
+using units::isq::si::picohertz;
+using units::isq::si::nanohertz;
+using units::isq::si::microhertz;
+using units::isq::si::millihertz;
+using units::isq::si::kilohertz;
+using units::isq::si::megahertz;
+using units::isq::si::gigahertz;
+using units::isq::si::terahertz;
+using units::isq::si::petahertz;
+using units::isq::si::exahertz;
+using units::isq::si::zettahertz;
+using units::isq::si::yottahertz;
+using units::isq::si::dim_frequency;
+using units::isq::si::frequency;
+using units::isq::si::joule_per_kelvin;
+using units::isq::si::joule_per_kilogram_kelvin;
+using units::isq::si::joule_per_mole_kelvin;
+using units::isq::si::dim_heat_capacity;
+using units::isq::si::dim_specific_heat_capacity;
+using units::isq::si::dim_molar_heat_capacity;
+using units::isq::si::heat_capacity;
+using units::isq::si::specific_heat_capacity;
+using units::isq::si::molar_heat_capacity;
+using units::isq::si::henry;
+using units::isq::si::yoctohenry;
+using units::isq::si::zeptohenry;
+using units::isq::si::attohenry;
+using units::isq::si::femtohenry;
+using units::isq::si::picohenry;
+using units::isq::si::nanohenry;
+using units::isq::si::microhenry;
+using units::isq::si::millihenry;
+using units::isq::si::kilohenry;
+using units::isq::si::megahenry;
+using units::isq::si::gigahenry;
+using units::isq::si::terahenry;
+using units::isq::si::petahenry;
+using units::isq::si::exahenry;
+using units::isq::si::zettahenry;
+using units::isq::si::yottahenry;
+using units::isq::si::dim_inductance;
+using units::isq::si::inductance;
+using units::isq::si::metre;
+using units::isq::si::yoctometre;
+using units::isq::si::zeptometre;
+using units::isq::si::attometre;
+using units::isq::si::femtometre;
+using units::isq::si::picometre;
+using units::isq::si::nanometre;
+using units::isq::si::micrometre;
+using units::isq::si::millimetre;
+using units::isq::si::centimetre;
+using units::isq::si::decimetre;
+using units::isq::si::decametre;
+using units::isq::si::hectometre;
+using units::isq::si::kilometre;
+using units::isq::si::megametre;
+using units::isq::si::gigametre;
+using units::isq::si::terametre;
+using units::isq::si::petametre;
+using units::isq::si::exametre;
+using units::isq::si::zettametre;
+using units::isq::si::yottametre;
+using units::isq::si::astronomical_unit;
+using units::isq::si::dim_length;
+using units::isq::si::length;
+using units::isq::si::candela_per_metre_sq;
+using units::isq::si::dim_luminance;
+using units::isq::si::luminance;
+using units::isq::si::candela;
+using units::isq::si::yoctocandela;
+using units::isq::si::zeptocandela;
+using units::isq::si::attocandela;
+using units::isq::si::femtocandela;
+using units::isq::si::picocandela;
+using units::isq::si::nanocandela;
+using units::isq::si::microcandela;
+using units::isq::si::millicandela;
+using units::isq::si::centicandela;
+using units::isq::si::decicandela;
+using units::isq::si::decacandela;
+using units::isq::si::hectocandela;
+using units::isq::si::kilocandela;
+using units::isq::si::megacandela;
+using units::isq::si::gigacandela;
+using units::isq::si::teracandela;
+using units::isq::si::petacandela;
+using units::isq::si::exacandela;
+using units::isq::si::zettacandela;
+using units::isq::si::yottacandela;
+using units::isq::si::dim_luminous_intensity;
+using units::isq::si::luminous_intensity;
+using units::isq::si::weber;
+using units::isq::si::yoctoweber;
+using units::isq::si::zeptoweber;
+using units::isq::si::attoweber;
+using units::isq::si::femtoweber;
+using units::isq::si::picoweber;
+using units::isq::si::nanoweber;
+using units::isq::si::microweber;
+using units::isq::si::milliweber;
+using units::isq::si::kiloweber;
+using units::isq::si::megaweber;
+using units::isq::si::gigaweber;
+using units::isq::si::teraweber;
+using units::isq::si::petaweber;
+using units::isq::si::exaweber;
+using units::isq::si::zettaweber;
+using units::isq::si::yottaweber;
+using units::isq::si::dim_magnetic_flux;
+using units::isq::si::magnetic_flux;
+using units::isq::si::tesla;
+using units::isq::si::yoctotesla;
+using units::isq::si::zeptotesla;
+using units::isq::si::attotesla;
+using units::isq::si::femtotesla;
+using units::isq::si::picotesla;
+using units::isq::si::nanotesla;
+using units::isq::si::microtesla;
+using units::isq::si::millitesla;
+using units::isq::si::kilotesla;
+using units::isq::si::megatesla;
+using units::isq::si::gigatesla;
+using units::isq::si::teratesla;
+using units::isq::si::petatesla;
+using units::isq::si::exatesla;
+using units::isq::si::zettatesla;
+using units::isq::si::yottatesla;
+using units::isq::si::gauss;
+using units::isq::si::dim_magnetic_induction;
+using units::isq::si::magnetic_induction;
+using units::isq::si::gram;
+using units::isq::si::yoctogram;
+using units::isq::si::zeptogram;
+using units::isq::si::attogram;
+using units::isq::si::femtogram;
+using units::isq::si::picogram;
+using units::isq::si::nanogram;
+using units::isq::si::microgram;
+using units::isq::si::milligram;
+using units::isq::si::centigram;
+using units::isq::si::decigram;
+using units::isq::si::decagram;
+using units::isq::si::hectogram;
+using units::isq::si::kilogram;
+using units::isq::si::megagram;
+using units::isq::si::gigagram;
+using units::isq::si::teragram;
+using units::isq::si::petagram;
+using units::isq::si::exagram;
+using units::isq::si::zettagram;
+using units::isq::si::yottagram;
+using units::isq::si::tonne;
+using units::isq::si::yoctotonne;
+using units::isq::si::zeptotonne;
+using units::isq::si::attotonne;
+using units::isq::si::femtotonne;
+using units::isq::si::picotonne;
+using units::isq::si::nanotonne;
+using units::isq::si::microtonne;
+using units::isq::si::millitonne;
+using units::isq::si::centitonne;
+using units::isq::si::decitonne;
+using units::isq::si::decatonne;
+using units::isq::si::hectotonne;
+using units::isq::si::kilotonne;
+using units::isq::si::megatonne;
+using units::isq::si::gigatonne;
+using units::isq::si::teratonne;
+using units::isq::si::petatonne;
+using units::isq::si::exatonne;
+using units::isq::si::zettatonne;
+using units::isq::si::yottatonne;
+using units::isq::si::dalton;
+using units::isq::si::dim_mass;
+using units::isq::si::mass;
+using units::isq::si::joule_per_mole;
+using units::isq::si::dim_molar_energy;
+using units::isq::si::molar_energy;
+using units::isq::si::kilogram_metre_per_second;
+using units::isq::si::dim_momentum;
+using units::isq::si::momentum;
+using units::isq::si::henry_per_metre;
+using units::isq::si::dim_permeability;
+using units::isq::si::permeability;
+using units::isq::si::farad_per_metre;
+using units::isq::si::dim_permittivity;
+using units::isq::si::permittivity;
+using units::isq::si::watt;
+using units::isq::si::yoctowatt;
+using units::isq::si::zeptowatt;
+using units::isq::si::attowatt;
+using units::isq::si::femtowatt;
+using units::isq::si::picowatt;
+using units::isq::si::nanowatt;
+using units::isq::si::microwatt;
+using units::isq::si::milliwatt;
+using units::isq::si::kilowatt;
+using units::isq::si::megawatt;
+using units::isq::si::gigawatt;
+using units::isq::si::terawatt;
+using units::isq::si::petawatt;
+using units::isq::si::exawatt;
+using units::isq::si::zettawatt;
+using units::isq::si::yottawatt;
+using units::isq::si::dim_power;
+using units::isq::si::power;
+using units::isq::si::prefix;
+using units::isq::si::yocto;
+using units::isq::si::zepto;
+using units::isq::si::atto;
+using units::isq::si::femto;
+using units::isq::si::pico;
+using units::isq::si::nano;
+using units::isq::si::micro;
+using units::isq::si::milli;
+using units::isq::si::centi;
+using units::isq::si::deci;
+using units::isq::si::deca;
+using units::isq::si::hecto;
+using units::isq::si::kilo;
+using units::isq::si::mega;
+using units::isq::si::giga;
+using units::isq::si::tera;
+using units::isq::si::peta;
+using units::isq::si::exa;
+using units::isq::si::zetta;
+using units::isq::si::yotta;
+using units::isq::si::pascal;
+using units::isq::si::yoctopascal;
+using units::isq::si::zeptopascal;
+using units::isq::si::attopascal;
+using units::isq::si::femtopascal;
+using units::isq::si::picopascal;
+using units::isq::si::nanopascal;
+using units::isq::si::micropascal;
+using units::isq::si::millipascal;
+using units::isq::si::centipascal;
+using units::isq::si::decipascal;
+using units::isq::si::decapascal;
+using units::isq::si::hectopascal;
+using units::isq::si::kilopascal;
+using units::isq::si::megapascal;
+using units::isq::si::gigapascal;
+using units::isq::si::terapascal;
+using units::isq::si::petapascal;
+using units::isq::si::exapascal;
+using units::isq::si::zettapascal;
+using units::isq::si::yottapascal;
+using units::isq::si::dim_pressure;
+using units::isq::si::pressure;
+using units::isq::si::ohm;
+using units::isq::si::yoctoohm;
+using units::isq::si::zeptoohm;
+using units::isq::si::attoohm;
+using units::isq::si::femtoohm;
+using units::isq::si::picoohm;
+using units::isq::si::nanoohm;
+using units::isq::si::microohm;
+using units::isq::si::milliohm;
+using units::isq::si::kiloohm;
+using units::isq::si::megaohm;
+using units::isq::si::gigaohm;
+using units::isq::si::teraohm;
+using units::isq::si::petaohm;
+using units::isq::si::exaohm;
+using units::isq::si::zettaohm;
+using units::isq::si::yottaohm;
+using units::isq::si::dim_resistance;
+using units::isq::si::resistance;
+using units::isq::si::metre_per_second;
+using units::isq::si::dim_speed;
+using units::isq::si::kilometre_per_hour;
+using units::isq::si::speed;
+using units::isq::si::newton_per_metre;
+using units::isq::si::dim_surface_tension;
+using units::isq::si::surface_tension;
+using units::isq::si::watt_per_metre_kelvin;
+using units::isq::si::dim_thermal_conductivity;
+using units::isq::si::thermal_conductivity;
+using units::isq::si::kelvin;
+using units::isq::si::dim_thermodynamic_temperature;
+using units::isq::si::thermodynamic_temperature;
+using units::isq::si::second;
+using units::isq::si::yoctosecond;
+using units::isq::si::zeptosecond;
+using units::isq::si::attosecond;
+using units::isq::si::femtosecond;
+using units::isq::si::picosecond;
+using units::isq::si::nanosecond;
+using units::isq::si::microsecond;
+using units::isq::si::millisecond;
+using units::isq::si::minute;
+using units::isq::si::hour;
+using units::isq::si::day;
+using units::isq::si::dim_time;
+using units::isq::si::time;
+using units::isq::si::newton_metre_per_radian;
+using units::isq::si::dim_torque;
+using units::isq::si::torque;
+using units::isq::si::volt;
+using units::isq::si::yoctovolt;
+using units::isq::si::zeptovolt;
+using units::isq::si::attovolt;
+using units::isq::si::femtovolt;
+using units::isq::si::picovolt;
+using units::isq::si::nanovolt;
+using units::isq::si::microvolt;
+using units::isq::si::millivolt;
+using units::isq::si::centivolt;
+using units::isq::si::decivolt;
+using units::isq::si::decavolt;
+using units::isq::si::hectovolt;
+using units::isq::si::kilovolt;
+using units::isq::si::megavolt;
+using units::isq::si::gigavolt;
+using units::isq::si::teravolt;
+using units::isq::si::petavolt;
+using units::isq::si::exavolt;
+using units::isq::si::zettavolt;
+using units::isq::si::yottavolt;
+using units::isq::si::dim_voltage;
+using units::isq::si::voltage;
+using units::isq::si::cubic_metre;
+using units::isq::si::dim_volume;
+using units::isq::si::cubic_yoctometre;
+using units::isq::si::cubic_zeptometre;
+using units::isq::si::cubic_attometre;
+using units::isq::si::cubic_femtometre;
+using units::isq::si::cubic_picometre;
+using units::isq::si::cubic_nanometre;
+using units::isq::si::cubic_micrometre;
+using units::isq::si::cubic_millimetre;
+using units::isq::si::cubic_centimetre;
+using units::isq::si::cubic_decimetre;
+using units::isq::si::cubic_decametre;
+using units::isq::si::cubic_hectometre;
+using units::isq::si::cubic_kilometre;
+using units::isq::si::cubic_megametre;
+using units::isq::si::cubic_gigametre;
+using units::isq::si::cubic_terametre;
+using units::isq::si::cubic_petametre;
+using units::isq::si::cubic_exametre;
+using units::isq::si::cubic_zettametre;
+using units::isq::si::cubic_yottametre;
+using units::isq::si::litre;
+using units::isq::si::yoctolitre;
+using units::isq::si::zeptolitre;
+using units::isq::si::attolitre;
+using units::isq::si::femtolitre;
+using units::isq::si::picolitre;
+using units::isq::si::nanolitre;
+using units::isq::si::microlitre;
+using units::isq::si::millilitre;
+using units::isq::si::centilitre;
+using units::isq::si::decilitre;
+using units::isq::si::decalitre;
+using units::isq::si::hectolitre;
+using units::isq::si::kilolitre;
+using units::isq::si::megalitre;
+using units::isq::si::gigalitre;
+using units::isq::si::teralitre;
+using units::isq::si::petalitre;
+using units::isq::si::exalitre;
+using units::isq::si::zettalitre;
+using units::isq::si::yottalitre;
+using units::isq::si::volume;
+
+}  // namespace units::isq::si
+
+export namespace units::isq::si::si2019 {
+
+using units::isq::si::si2019::planck_constant;
+using units::isq::si::si2019::reduced_planck_constant;
+using units::isq::si::si2019::elementary_charge;
+using units::isq::si::si2019::boltzmann_constant;
+using units::isq::si::si2019::avogadro_constant;
+using units::isq::si::si2019::speed_of_light;
+using units::isq::si::si2019::hyperfine_structure_transition_frequency;
+using units::isq::si::si2019::standard_gravity;
+
+}  // namespace units::isq::si::si2019
+
+#ifndef UNITS_NO_LITERALS
+
+export namespace units::literals {
+
+using units::literals::operator""_q_rad;
+
+}  // namespace units::literals
+
+export namespace units::isq::si::literals {
+
+using units::isq::si::literals::operator""_q_Gy;
+using units::isq::si::literals::operator""_q_yGy;
+using units::isq::si::literals::operator""_q_zGy;
+using units::isq::si::literals::operator""_q_aGy;
+using units::isq::si::literals::operator""_q_fGy;
+using units::isq::si::literals::operator""_q_pGy;
+using units::isq::si::literals::operator""_q_nGy;
+using units::isq::si::literals::operator""_q_uGy;
+using units::isq::si::literals::operator""_q_mGy;
+using units::isq::si::literals::operator""_q_cGy;
+using units::isq::si::literals::operator""_q_dGy;
+using units::isq::si::literals::operator""_q_daGy;
+using units::isq::si::literals::operator""_q_hGy;
+using units::isq::si::literals::operator""_q_kGy;
+using units::isq::si::literals::operator""_q_MGy;
+using units::isq::si::literals::operator""_q_GGy;
+using units::isq::si::literals::operator""_q_TGy;
+using units::isq::si::literals::operator""_q_PGy;
+using units::isq::si::literals::operator""_q_EGy;
+using units::isq::si::literals::operator""_q_ZGy;
+using units::isq::si::literals::operator""_q_YGy;
+using units::isq::si::literals::operator""_q_m_per_s2;
+using units::isq::si::literals::operator""_q_mol;
+using units::isq::si::literals::operator""_q_rad_per_s;
+using units::isq::si::literals::operator""_q_m2;
+using units::isq::si::literals::operator""_q_ym2;
+using units::isq::si::literals::operator""_q_zm2;
+using units::isq::si::literals::operator""_q_am2;
+using units::isq::si::literals::operator""_q_fm2;
+using units::isq::si::literals::operator""_q_pm2;
+using units::isq::si::literals::operator""_q_nm2;
+using units::isq::si::literals::operator""_q_um2;
+using units::isq::si::literals::operator""_q_mm2;
+using units::isq::si::literals::operator""_q_cm2;
+using units::isq::si::literals::operator""_q_dm2;
+using units::isq::si::literals::operator""_q_dam2;
+using units::isq::si::literals::operator""_q_hm2;
+using units::isq::si::literals::operator""_q_km2;
+using units::isq::si::literals::operator""_q_Mm2;
+using units::isq::si::literals::operator""_q_Gm2;
+using units::isq::si::literals::operator""_q_Tm2;
+using units::isq::si::literals::operator""_q_Pm2;
+using units::isq::si::literals::operator""_q_Em2;
+using units::isq::si::literals::operator""_q_Zm2;
+using units::isq::si::literals::operator""_q_Ym2;
+using units::isq::si::literals::operator""_q_ha;
+using units::isq::si::literals::operator""_q_F;
+using units::isq::si::literals::operator""_q_yF;
+using units::isq::si::literals::operator""_q_zF;
+using units::isq::si::literals::operator""_q_aF;
+using units::isq::si::literals::operator""_q_fF;
+using units::isq::si::literals::operator""_q_pF;
+using units::isq::si::literals::operator""_q_nF;
+using units::isq::si::literals::operator""_q_uF;
+using units::isq::si::literals::operator""_q_mF;
+using units::isq::si::literals::operator""_q_cF;
+using units::isq::si::literals::operator""_q_dF;
+using units::isq::si::literals::operator""_q_daF;
+using units::isq::si::literals::operator""_q_hF;
+using units::isq::si::literals::operator""_q_kF;
+using units::isq::si::literals::operator""_q_MF;
+using units::isq::si::literals::operator""_q_GF;
+using units::isq::si::literals::operator""_q_TF;
+using units::isq::si::literals::operator""_q_PF;
+using units::isq::si::literals::operator""_q_EF;
+using units::isq::si::literals::operator""_q_ZF;
+using units::isq::si::literals::operator""_q_YF;
+using units::isq::si::literals::operator""_q_kat;
+using units::isq::si::literals::operator""_q_ykat;
+using units::isq::si::literals::operator""_q_zkat;
+using units::isq::si::literals::operator""_q_akat;
+using units::isq::si::literals::operator""_q_fkat;
+using units::isq::si::literals::operator""_q_pkat;
+using units::isq::si::literals::operator""_q_nkat;
+using units::isq::si::literals::operator""_q_ukat;
+using units::isq::si::literals::operator""_q_mkat;
+using units::isq::si::literals::operator""_q_ckat;
+using units::isq::si::literals::operator""_q_dkat;
+using units::isq::si::literals::operator""_q_dakat;
+using units::isq::si::literals::operator""_q_hkat;
+using units::isq::si::literals::operator""_q_kkat;
+using units::isq::si::literals::operator""_q_Mkat;
+using units::isq::si::literals::operator""_q_Gkat;
+using units::isq::si::literals::operator""_q_Tkat;
+using units::isq::si::literals::operator""_q_Pkat;
+using units::isq::si::literals::operator""_q_Ekat;
+using units::isq::si::literals::operator""_q_Zkat;
+using units::isq::si::literals::operator""_q_Ykat;
+using units::isq::si::literals::operator""_q_U;
+using units::isq::si::literals::operator""_q_C_per_m3;
+using units::isq::si::literals::operator""_q_C_per_m2;
+using units::isq::si::literals::operator""_q_mol_per_m3;
+using units::isq::si::literals::operator""_q_S;
+using units::isq::si::literals::operator""_q_yS;
+using units::isq::si::literals::operator""_q_zS;
+using units::isq::si::literals::operator""_q_aS;
+using units::isq::si::literals::operator""_q_fS;
+using units::isq::si::literals::operator""_q_pS;
+using units::isq::si::literals::operator""_q_nS;
+using units::isq::si::literals::operator""_q_uS;
+using units::isq::si::literals::operator""_q_mS;
+using units::isq::si::literals::operator""_q_kS;
+using units::isq::si::literals::operator""_q_MS;
+using units::isq::si::literals::operator""_q_GS;
+using units::isq::si::literals::operator""_q_TS;
+using units::isq::si::literals::operator""_q_PS;
+using units::isq::si::literals::operator""_q_ES;
+using units::isq::si::literals::operator""_q_ZS;
+using units::isq::si::literals::operator""_q_YS;
+using units::isq::si::literals::operator""_q_A_per_m2;
+using units::isq::si::literals::operator""_q_kg_per_m3;
+using units::isq::si::literals::operator""_q_Pa_s;
+using units::isq::si::literals::operator""_q_C;
+using units::isq::si::literals::operator""_q_A;
+using units::isq::si::literals::operator""_q_yA;
+using units::isq::si::literals::operator""_q_zA;
+using units::isq::si::literals::operator""_q_aA;
+using units::isq::si::literals::operator""_q_fA;
+using units::isq::si::literals::operator""_q_pA;
+using units::isq::si::literals::operator""_q_nA;
+using units::isq::si::literals::operator""_q_uA;
+using units::isq::si::literals::operator""_q_mA;
+using units::isq::si::literals::operator""_q_cA;
+using units::isq::si::literals::operator""_q_dA;
+using units::isq::si::literals::operator""_q_daA;
+using units::isq::si::literals::operator""_q_hA;
+using units::isq::si::literals::operator""_q_kA;
+using units::isq::si::literals::operator""_q_MA;
+using units::isq::si::literals::operator""_q_GA;
+using units::isq::si::literals::operator""_q_TA;
+using units::isq::si::literals::operator""_q_PA;
+using units::isq::si::literals::operator""_q_EA;
+using units::isq::si::literals::operator""_q_ZA;
+using units::isq::si::literals::operator""_q_YA;
+using units::isq::si::literals::operator""_q_V_per_m;
+using units::isq::si::literals::operator""_q_J;
+using units::isq::si::literals::operator""_q_yJ;
+using units::isq::si::literals::operator""_q_zJ;
+using units::isq::si::literals::operator""_q_aJ;
+using units::isq::si::literals::operator""_q_fJ;
+using units::isq::si::literals::operator""_q_pJ;
+using units::isq::si::literals::operator""_q_nJ;
+using units::isq::si::literals::operator""_q_uJ;
+using units::isq::si::literals::operator""_q_mJ;
+using units::isq::si::literals::operator""_q_kJ;
+using units::isq::si::literals::operator""_q_MJ;
+using units::isq::si::literals::operator""_q_GJ;
+using units::isq::si::literals::operator""_q_TJ;
+using units::isq::si::literals::operator""_q_PJ;
+using units::isq::si::literals::operator""_q_EJ;
+using units::isq::si::literals::operator""_q_ZJ;
+using units::isq::si::literals::operator""_q_YJ;
+using units::isq::si::literals::operator""_q_eV;
+using units::isq::si::literals::operator""_q_GeV;
+using units::isq::si::literals::operator""_q_N;
+using units::isq::si::literals::operator""_q_yN;
+using units::isq::si::literals::operator""_q_zN;
+using units::isq::si::literals::operator""_q_aN;
+using units::isq::si::literals::operator""_q_fN;
+using units::isq::si::literals::operator""_q_pN;
+using units::isq::si::literals::operator""_q_nN;
+using units::isq::si::literals::operator""_q_uN;
+using units::isq::si::literals::operator""_q_mN;
+using units::isq::si::literals::operator""_q_cN;
+using units::isq::si::literals::operator""_q_dN;
+using units::isq::si::literals::operator""_q_daN;
+using units::isq::si::literals::operator""_q_hN;
+using units::isq::si::literals::operator""_q_kN;
+using units::isq::si::literals::operator""_q_MN;
+using units::isq::si::literals::operator""_q_GN;
+using units::isq::si::literals::operator""_q_TN;
+using units::isq::si::literals::operator""_q_PN;
+using units::isq::si::literals::operator""_q_EN;
+using units::isq::si::literals::operator""_q_ZN;
+using units::isq::si::literals::operator""_q_YN;
+using units::isq::si::literals::operator""_q_Hz;
+using units::isq::si::literals::operator""_q_yHz;
+using units::isq::si::literals::operator""_q_zHz;
+using units::isq::si::literals::operator""_q_aHz;
+using units::isq::si::literals::operator""_q_fHz;
+using units::isq::si::literals::operator""_q_pHz;
+using units::isq::si::literals::operator""_q_nHz;
+using units::isq::si::literals::operator""_q_uHz;
+using units::isq::si::literals::operator""_q_mHz;
+using units::isq::si::literals::operator""_q_kHz;
+using units::isq::si::literals::operator""_q_MHz;
+using units::isq::si::literals::operator""_q_GHz;
+using units::isq::si::literals::operator""_q_THz;
+using units::isq::si::literals::operator""_q_PHz;
+using units::isq::si::literals::operator""_q_EHz;
+using units::isq::si::literals::operator""_q_ZHz;
+using units::isq::si::literals::operator""_q_YHz;
+using units::isq::si::literals::operator""_q_J_per_K;
+using units::isq::si::literals::operator""_q_J_per_kg_K;
+using units::isq::si::literals::operator""_q_J_per_mol_K;
+using units::isq::si::literals::operator""_q_H;
+using units::isq::si::literals::operator""_q_yH;
+using units::isq::si::literals::operator""_q_zH;
+using units::isq::si::literals::operator""_q_aH;
+using units::isq::si::literals::operator""_q_fH;
+using units::isq::si::literals::operator""_q_pH;
+using units::isq::si::literals::operator""_q_nH;
+using units::isq::si::literals::operator""_q_uH;
+using units::isq::si::literals::operator""_q_mH;
+using units::isq::si::literals::operator""_q_kH;
+using units::isq::si::literals::operator""_q_MH;
+using units::isq::si::literals::operator""_q_GH;
+using units::isq::si::literals::operator""_q_TH;
+using units::isq::si::literals::operator""_q_PH;
+using units::isq::si::literals::operator""_q_EH;
+using units::isq::si::literals::operator""_q_ZH;
+using units::isq::si::literals::operator""_q_YH;
+using units::isq::si::literals::operator""_q_m;
+using units::isq::si::literals::operator""_q_ym;
+using units::isq::si::literals::operator""_q_zm;
+using units::isq::si::literals::operator""_q_am;
+using units::isq::si::literals::operator""_q_fm;
+using units::isq::si::literals::operator""_q_pm;
+using units::isq::si::literals::operator""_q_nm;
+using units::isq::si::literals::operator""_q_um;
+using units::isq::si::literals::operator""_q_mm;
+using units::isq::si::literals::operator""_q_cm;
+using units::isq::si::literals::operator""_q_dm;
+using units::isq::si::literals::operator""_q_dam;
+using units::isq::si::literals::operator""_q_hm;
+using units::isq::si::literals::operator""_q_km;
+using units::isq::si::literals::operator""_q_Mm;
+using units::isq::si::literals::operator""_q_Gm;
+using units::isq::si::literals::operator""_q_Tm;
+using units::isq::si::literals::operator""_q_Pm;
+using units::isq::si::literals::operator""_q_Em;
+using units::isq::si::literals::operator""_q_Zm;
+using units::isq::si::literals::operator""_q_Ym;
+using units::isq::si::literals::operator""_q_au;
+using units::isq::si::literals::operator""_q_cd_per_m2;
+using units::isq::si::literals::operator""_q_cd;
+using units::isq::si::literals::operator""_q_ycd;
+using units::isq::si::literals::operator""_q_zcd;
+using units::isq::si::literals::operator""_q_acd;
+using units::isq::si::literals::operator""_q_fcd;
+using units::isq::si::literals::operator""_q_pcd;
+using units::isq::si::literals::operator""_q_ncd;
+using units::isq::si::literals::operator""_q_ucd;
+using units::isq::si::literals::operator""_q_mcd;
+using units::isq::si::literals::operator""_q_ccd;
+using units::isq::si::literals::operator""_q_dcd;
+using units::isq::si::literals::operator""_q_dacd;
+using units::isq::si::literals::operator""_q_hcd;
+using units::isq::si::literals::operator""_q_kcd;
+using units::isq::si::literals::operator""_q_Mcd;
+using units::isq::si::literals::operator""_q_Gcd;
+using units::isq::si::literals::operator""_q_Tcd;
+using units::isq::si::literals::operator""_q_Pcd;
+using units::isq::si::literals::operator""_q_Ecd;
+using units::isq::si::literals::operator""_q_Zcd;
+using units::isq::si::literals::operator""_q_Ycd;
+using units::isq::si::literals::operator""_q_Wb;
+using units::isq::si::literals::operator""_q_yWb;
+using units::isq::si::literals::operator""_q_zWb;
+using units::isq::si::literals::operator""_q_aWb;
+using units::isq::si::literals::operator""_q_fWb;
+using units::isq::si::literals::operator""_q_pWb;
+using units::isq::si::literals::operator""_q_nWb;
+using units::isq::si::literals::operator""_q_uWb;
+using units::isq::si::literals::operator""_q_mWb;
+using units::isq::si::literals::operator""_q_kWb;
+using units::isq::si::literals::operator""_q_MWb;
+using units::isq::si::literals::operator""_q_GWb;
+using units::isq::si::literals::operator""_q_TWb;
+using units::isq::si::literals::operator""_q_PWb;
+using units::isq::si::literals::operator""_q_EWb;
+using units::isq::si::literals::operator""_q_ZWb;
+using units::isq::si::literals::operator""_q_YWb;
+using units::isq::si::literals::operator""_q_T;
+using units::isq::si::literals::operator""_q_yT;
+using units::isq::si::literals::operator""_q_zT;
+using units::isq::si::literals::operator""_q_aT;
+using units::isq::si::literals::operator""_q_fT;
+using units::isq::si::literals::operator""_q_pT;
+using units::isq::si::literals::operator""_q_nT;
+using units::isq::si::literals::operator""_q_uT;
+using units::isq::si::literals::operator""_q_mT;
+using units::isq::si::literals::operator""_q_kT;
+using units::isq::si::literals::operator""_q_MT;
+using units::isq::si::literals::operator""_q_GT;
+using units::isq::si::literals::operator""_q_TT;
+using units::isq::si::literals::operator""_q_PT;
+using units::isq::si::literals::operator""_q_ET;
+using units::isq::si::literals::operator""_q_ZT;
+using units::isq::si::literals::operator""_q_YT;
+using units::isq::si::literals::operator""_q_G;
+using units::isq::si::literals::operator""_q_g;
+using units::isq::si::literals::operator""_q_yg;
+using units::isq::si::literals::operator""_q_zg;
+using units::isq::si::literals::operator""_q_ag;
+using units::isq::si::literals::operator""_q_fg;
+using units::isq::si::literals::operator""_q_pg;
+using units::isq::si::literals::operator""_q_ng;
+using units::isq::si::literals::operator""_q_ug;
+using units::isq::si::literals::operator""_q_mg;
+using units::isq::si::literals::operator""_q_cg;
+using units::isq::si::literals::operator""_q_dg;
+using units::isq::si::literals::operator""_q_dag;
+using units::isq::si::literals::operator""_q_hg;
+using units::isq::si::literals::operator""_q_kg;
+using units::isq::si::literals::operator""_q_Mg;
+using units::isq::si::literals::operator""_q_Gg;
+using units::isq::si::literals::operator""_q_Tg;
+using units::isq::si::literals::operator""_q_Pg;
+using units::isq::si::literals::operator""_q_Eg;
+using units::isq::si::literals::operator""_q_Zg;
+using units::isq::si::literals::operator""_q_Yg;
+using units::isq::si::literals::operator""_q_t;
+using units::isq::si::literals::operator""_q_yt;
+using units::isq::si::literals::operator""_q_zt;
+using units::isq::si::literals::operator""_q_at;
+using units::isq::si::literals::operator""_q_pt;
+using units::isq::si::literals::operator""_q_nt;
+using units::isq::si::literals::operator""_q_ut;
+using units::isq::si::literals::operator""_q_mt;
+using units::isq::si::literals::operator""_q_ct;
+using units::isq::si::literals::operator""_q_dt;
+using units::isq::si::literals::operator""_q_dat;
+using units::isq::si::literals::operator""_q_ht;
+using units::isq::si::literals::operator""_q_kt;
+using units::isq::si::literals::operator""_q_Mt;
+using units::isq::si::literals::operator""_q_Gt;
+using units::isq::si::literals::operator""_q_Tt;
+using units::isq::si::literals::operator""_q_Pt;
+using units::isq::si::literals::operator""_q_Et;
+using units::isq::si::literals::operator""_q_Zt;
+using units::isq::si::literals::operator""_q_Yt;
+using units::isq::si::literals::operator""_q_Da;
+using units::isq::si::literals::operator""_q_J_per_mol;
+using units::isq::si::literals::operator""_q_kg_m_per_s;
+using units::isq::si::literals::operator""_q_H_per_m;
+using units::isq::si::literals::operator""_q_F_per_m;
+using units::isq::si::literals::operator""_q_W;
+using units::isq::si::literals::operator""_q_yW;
+using units::isq::si::literals::operator""_q_zW;
+using units::isq::si::literals::operator""_q_aW;
+using units::isq::si::literals::operator""_q_fW;
+using units::isq::si::literals::operator""_q_pW;
+using units::isq::si::literals::operator""_q_nW;
+using units::isq::si::literals::operator""_q_uW;
+using units::isq::si::literals::operator""_q_mW;
+using units::isq::si::literals::operator""_q_kW;
+using units::isq::si::literals::operator""_q_MW;
+using units::isq::si::literals::operator""_q_GW;
+using units::isq::si::literals::operator""_q_TW;
+using units::isq::si::literals::operator""_q_PW;
+using units::isq::si::literals::operator""_q_EW;
+using units::isq::si::literals::operator""_q_ZW;
+using units::isq::si::literals::operator""_q_YW;
+using units::isq::si::literals::operator""_q_Pa;
+using units::isq::si::literals::operator""_q_yPa;
+using units::isq::si::literals::operator""_q_zPa;
+using units::isq::si::literals::operator""_q_aPa;
+using units::isq::si::literals::operator""_q_fPa;
+using units::isq::si::literals::operator""_q_pPa;
+using units::isq::si::literals::operator""_q_nPa;
+using units::isq::si::literals::operator""_q_uPa;
+using units::isq::si::literals::operator""_q_mPa;
+using units::isq::si::literals::operator""_q_cPa;
+using units::isq::si::literals::operator""_q_dPa;
+using units::isq::si::literals::operator""_q_daPa;
+using units::isq::si::literals::operator""_q_hPa;
+using units::isq::si::literals::operator""_q_kPa;
+using units::isq::si::literals::operator""_q_MPa;
+using units::isq::si::literals::operator""_q_GPa;
+using units::isq::si::literals::operator""_q_TPa;
+using units::isq::si::literals::operator""_q_PPa;
+using units::isq::si::literals::operator""_q_EPa;
+using units::isq::si::literals::operator""_q_ZPa;
+using units::isq::si::literals::operator""_q_YPa;
+using units::isq::si::literals::operator""_q_R;
+using units::isq::si::literals::operator""_q_yR;
+using units::isq::si::literals::operator""_q_zR;
+using units::isq::si::literals::operator""_q_aR;
+using units::isq::si::literals::operator""_q_fR;
+using units::isq::si::literals::operator""_q_pR;
+using units::isq::si::literals::operator""_q_nR;
+using units::isq::si::literals::operator""_q_uR;
+using units::isq::si::literals::operator""_q_mR;
+using units::isq::si::literals::operator""_q_kR;
+using units::isq::si::literals::operator""_q_MR;
+using units::isq::si::literals::operator""_q_GR;
+using units::isq::si::literals::operator""_q_TR;
+using units::isq::si::literals::operator""_q_PR;
+using units::isq::si::literals::operator""_q_ER;
+using units::isq::si::literals::operator""_q_ZR;
+using units::isq::si::literals::operator""_q_YR;
+using units::isq::si::literals::operator""_q_m_per_s;
+using units::isq::si::literals::operator""_q_km_per_h;
+using units::isq::si::literals::operator""_q_N_per_m;
+using units::isq::si::literals::operator""_q_W_per_m_K;
+using units::isq::si::literals::operator""_q_K;
+using units::isq::si::literals::operator""_q_ys;
+using units::isq::si::literals::operator""_q_zs;
+using units::isq::si::literals::operator""_q_as;
+using units::isq::si::literals::operator""_q_fs;
+using units::isq::si::literals::operator""_q_ps;
+using units::isq::si::literals::operator""_q_ns;
+using units::isq::si::literals::operator""_q_us;
+using units::isq::si::literals::operator""_q_ms;
+using units::isq::si::literals::operator""_q_s;
+using units::isq::si::literals::operator""_q_min;
+using units::isq::si::literals::operator""_q_h;
+using units::isq::si::literals::operator""_q_d;
+using units::isq::si::literals::operator""_q_N_m_per_rad;
+using units::isq::si::literals::operator""_q_V;
+using units::isq::si::literals::operator""_q_yV;
+using units::isq::si::literals::operator""_q_zV;
+using units::isq::si::literals::operator""_q_aV;
+using units::isq::si::literals::operator""_q_fV;
+using units::isq::si::literals::operator""_q_pV;
+using units::isq::si::literals::operator""_q_nV;
+using units::isq::si::literals::operator""_q_uV;
+using units::isq::si::literals::operator""_q_mV;
+using units::isq::si::literals::operator""_q_cV;
+using units::isq::si::literals::operator""_q_dV;
+using units::isq::si::literals::operator""_q_daV;
+using units::isq::si::literals::operator""_q_hV;
+using units::isq::si::literals::operator""_q_kV;
+using units::isq::si::literals::operator""_q_MV;
+using units::isq::si::literals::operator""_q_GV;
+using units::isq::si::literals::operator""_q_TV;
+using units::isq::si::literals::operator""_q_PV;
+using units::isq::si::literals::operator""_q_EV;
+using units::isq::si::literals::operator""_q_ZV;
+using units::isq::si::literals::operator""_q_YV;
+using units::isq::si::literals::operator""_q_m3;
+using units::isq::si::literals::operator""_q_ym3;
+using units::isq::si::literals::operator""_q_zm3;
+using units::isq::si::literals::operator""_q_am3;
+using units::isq::si::literals::operator""_q_fm3;
+using units::isq::si::literals::operator""_q_pm3;
+using units::isq::si::literals::operator""_q_nm3;
+using units::isq::si::literals::operator""_q_um3;
+using units::isq::si::literals::operator""_q_mm3;
+using units::isq::si::literals::operator""_q_cm3;
+using units::isq::si::literals::operator""_q_dm3;
+using units::isq::si::literals::operator""_q_dam3;
+using units::isq::si::literals::operator""_q_hm3;
+using units::isq::si::literals::operator""_q_km3;
+using units::isq::si::literals::operator""_q_Mm3;
+using units::isq::si::literals::operator""_q_Gm3;
+using units::isq::si::literals::operator""_q_Tm3;
+using units::isq::si::literals::operator""_q_Pm3;
+using units::isq::si::literals::operator""_q_Em3;
+using units::isq::si::literals::operator""_q_Zm3;
+using units::isq::si::literals::operator""_q_Ym3;
+using units::isq::si::literals::operator""_q_l;
+using units::isq::si::literals::operator""_q_yl;
+using units::isq::si::literals::operator""_q_zl;
+using units::isq::si::literals::operator""_q_al;
+using units::isq::si::literals::operator""_q_fl;
+using units::isq::si::literals::operator""_q_pl;
+using units::isq::si::literals::operator""_q_nl;
+using units::isq::si::literals::operator""_q_ul;
+using units::isq::si::literals::operator""_q_ml;
+using units::isq::si::literals::operator""_q_cl;
+using units::isq::si::literals::operator""_q_dl;
+using units::isq::si::literals::operator""_q_dal;
+using units::isq::si::literals::operator""_q_hl;
+using units::isq::si::literals::operator""_q_kl;
+using units::isq::si::literals::operator""_q_Ml;
+using units::isq::si::literals::operator""_q_Gl;
+using units::isq::si::literals::operator""_q_Tl;
+using units::isq::si::literals::operator""_q_Pl;
+using units::isq::si::literals::operator""_q_El;
+using units::isq::si::literals::operator""_q_Zl;
+using units::isq::si::literals::operator""_q_Yl;
+
+}  // namespace units::isq::si::literals
+
+#endif // UNITS_NO_LITERALS
+
+#ifndef UNITS_NO_REFERENCES
+
+export namespace units::angle_references {
+
+using units::angle_references::rad;
+
+}  // namespace units::angle_references
+
+export namespace units::isq::si::absorbed_dose_references {
+
+using units::isq::si::absorbed_dose_references::Gy;
+using units::isq::si::absorbed_dose_references::yGy;
+using units::isq::si::absorbed_dose_references::zGy;
+using units::isq::si::absorbed_dose_references::aGy;
+using units::isq::si::absorbed_dose_references::fGy;
+using units::isq::si::absorbed_dose_references::pGy;
+using units::isq::si::absorbed_dose_references::nGy;
+using units::isq::si::absorbed_dose_references::uGy;
+using units::isq::si::absorbed_dose_references::mGy;
+using units::isq::si::absorbed_dose_references::cGy;
+using units::isq::si::absorbed_dose_references::dGy;
+using units::isq::si::absorbed_dose_references::daGy;
+using units::isq::si::absorbed_dose_references::hGy;
+using units::isq::si::absorbed_dose_references::kGy;
+using units::isq::si::absorbed_dose_references::MGy;
+using units::isq::si::absorbed_dose_references::GGy;
+using units::isq::si::absorbed_dose_references::TGy;
+using units::isq::si::absorbed_dose_references::PGy;
+using units::isq::si::absorbed_dose_references::EGy;
+using units::isq::si::absorbed_dose_references::ZGy;
+using units::isq::si::absorbed_dose_references::YGy;
+
+}  // namespace units::isq::si::absorbed_dose_references
+
+export namespace units::isq::si::amount_of_substance_references {
+
+using units::isq::si::amount_of_substance_references::mol;
+
+}  // namespace units::isq::si::amount_of_substance_references
+
+export namespace units::isq::si::area_references {
+
+using units::isq::si::area_references::m2;
+using units::isq::si::area_references::ym2;
+using units::isq::si::area_references::zm2;
+using units::isq::si::area_references::am2;
+using units::isq::si::area_references::fm2;
+using units::isq::si::area_references::pm2;
+using units::isq::si::area_references::nm2;
+using units::isq::si::area_references::um2;
+using units::isq::si::area_references::mm2;
+using units::isq::si::area_references::cm2;
+using units::isq::si::area_references::dm2;
+using units::isq::si::area_references::dam2;
+using units::isq::si::area_references::hm2;
+using units::isq::si::area_references::km2;
+using units::isq::si::area_references::Mm2;
+using units::isq::si::area_references::Gm2;
+using units::isq::si::area_references::Tm2;
+using units::isq::si::area_references::Pm2;
+using units::isq::si::area_references::Em2;
+using units::isq::si::area_references::Zm2;
+using units::isq::si::area_references::Ym2;
+using units::isq::si::area_references::ha;
+
+}  // namespace units::isq::si::area_references
+
+export namespace units::isq::si::capacitance_references {
+
+using units::isq::si::capacitance_references::F;
+using units::isq::si::capacitance_references::yF;
+using units::isq::si::capacitance_references::zF;
+using units::isq::si::capacitance_references::aF;
+using units::isq::si::capacitance_references::fF;
+using units::isq::si::capacitance_references::pF;
+using units::isq::si::capacitance_references::nF;
+using units::isq::si::capacitance_references::uF;
+using units::isq::si::capacitance_references::mF;
+using units::isq::si::capacitance_references::cF;
+using units::isq::si::capacitance_references::dF;
+using units::isq::si::capacitance_references::daF;
+using units::isq::si::capacitance_references::hF;
+using units::isq::si::capacitance_references::kF;
+using units::isq::si::capacitance_references::MF;
+using units::isq::si::capacitance_references::GF;
+using units::isq::si::capacitance_references::TF;
+using units::isq::si::capacitance_references::PF;
+using units::isq::si::capacitance_references::EF;
+using units::isq::si::capacitance_references::ZF;
+using units::isq::si::capacitance_references::YF;
+
+}  // namespace units::isq::si::capacitance_references
+
+export namespace units::isq::si::catalytic_activity_references {
+
+using units::isq::si::catalytic_activity_references::kat;
+using units::isq::si::catalytic_activity_references::ykat;
+using units::isq::si::catalytic_activity_references::zkat;
+using units::isq::si::catalytic_activity_references::akat;
+using units::isq::si::catalytic_activity_references::fkat;
+using units::isq::si::catalytic_activity_references::pkat;
+using units::isq::si::catalytic_activity_references::nkat;
+using units::isq::si::catalytic_activity_references::ukat;
+using units::isq::si::catalytic_activity_references::mkat;
+using units::isq::si::catalytic_activity_references::ckat;
+using units::isq::si::catalytic_activity_references::dkat;
+using units::isq::si::catalytic_activity_references::dakat;
+using units::isq::si::catalytic_activity_references::hkat;
+using units::isq::si::catalytic_activity_references::kkat;
+using units::isq::si::catalytic_activity_references::Mkat;
+using units::isq::si::catalytic_activity_references::Gkat;
+using units::isq::si::catalytic_activity_references::Tkat;
+using units::isq::si::catalytic_activity_references::Pkat;
+using units::isq::si::catalytic_activity_references::Ekat;
+using units::isq::si::catalytic_activity_references::Zkat;
+using units::isq::si::catalytic_activity_references::Ykat;
+using units::isq::si::catalytic_activity_references::U;
+
+}  // namespace units::isq::si::catalytic_activity_references
+
+export namespace units::isq::si::conductance_references {
+
+using units::isq::si::conductance_references::S;
+using units::isq::si::conductance_references::yS;
+using units::isq::si::conductance_references::zS;
+using units::isq::si::conductance_references::aS;
+using units::isq::si::conductance_references::fS;
+using units::isq::si::conductance_references::pS;
+using units::isq::si::conductance_references::nS;
+using units::isq::si::conductance_references::uS;
+using units::isq::si::conductance_references::mS;
+using units::isq::si::conductance_references::kS;
+using units::isq::si::conductance_references::MS;
+using units::isq::si::conductance_references::GS;
+using units::isq::si::conductance_references::TS;
+using units::isq::si::conductance_references::PS;
+using units::isq::si::conductance_references::ES;
+using units::isq::si::conductance_references::ZS;
+using units::isq::si::conductance_references::YS;
+
+}  // namespace units::isq::si::conductance_references
+
+export namespace units::isq::si::electric_charge_references {
+
+using units::isq::si::electric_charge_references::C;
+
+}  // namespace units::isq::si::electric_charge_references
+
+export namespace units::isq::si::electric_current_references {
+
+using units::isq::si::electric_current_references::A;
+using units::isq::si::electric_current_references::yA;
+using units::isq::si::electric_current_references::zA;
+using units::isq::si::electric_current_references::aA;
+using units::isq::si::electric_current_references::fA;
+using units::isq::si::electric_current_references::pA;
+using units::isq::si::electric_current_references::nA;
+using units::isq::si::electric_current_references::uA;
+using units::isq::si::electric_current_references::mA;
+using units::isq::si::electric_current_references::cA;
+using units::isq::si::electric_current_references::dA;
+using units::isq::si::electric_current_references::daA;
+using units::isq::si::electric_current_references::hA;
+using units::isq::si::electric_current_references::kA;
+using units::isq::si::electric_current_references::MA;
+using units::isq::si::electric_current_references::GA;
+using units::isq::si::electric_current_references::TA;
+using units::isq::si::electric_current_references::PA;
+using units::isq::si::electric_current_references::EA;
+using units::isq::si::electric_current_references::ZA;
+using units::isq::si::electric_current_references::YA;
+
+}  // namespace units::isq::si::electric_current_references
+
+export namespace units::isq::si::energy_references {
+
+using units::isq::si::energy_references::J;
+using units::isq::si::energy_references::yJ;
+using units::isq::si::energy_references::zJ;
+using units::isq::si::energy_references::aJ;
+using units::isq::si::energy_references::fJ;
+using units::isq::si::energy_references::pJ;
+using units::isq::si::energy_references::nJ;
+using units::isq::si::energy_references::uJ;
+using units::isq::si::energy_references::mJ;
+using units::isq::si::energy_references::kJ;
+using units::isq::si::energy_references::MJ;
+using units::isq::si::energy_references::GJ;
+using units::isq::si::energy_references::TJ;
+using units::isq::si::energy_references::PJ;
+using units::isq::si::energy_references::EJ;
+using units::isq::si::energy_references::ZJ;
+using units::isq::si::energy_references::YJ;
+using units::isq::si::energy_references::eV;
+using units::isq::si::energy_references::GeV;
+
+}  // namespace units::isq::si::energy_references
+
+export namespace units::isq::si::force_references {
+
+using units::isq::si::force_references::N;
+using units::isq::si::force_references::yN;
+using units::isq::si::force_references::zN;
+using units::isq::si::force_references::aN;
+using units::isq::si::force_references::fN;
+using units::isq::si::force_references::pN;
+using units::isq::si::force_references::nN;
+using units::isq::si::force_references::uN;
+using units::isq::si::force_references::mN;
+using units::isq::si::force_references::cN;
+using units::isq::si::force_references::dN;
+using units::isq::si::force_references::daN;
+using units::isq::si::force_references::hN;
+using units::isq::si::force_references::kN;
+using units::isq::si::force_references::MN;
+using units::isq::si::force_references::GN;
+using units::isq::si::force_references::TN;
+using units::isq::si::force_references::PN;
+using units::isq::si::force_references::EN;
+using units::isq::si::force_references::ZN;
+using units::isq::si::force_references::YN;
+
+}  // namespace units::isq::si::force_references
+
+export namespace units::isq::si::frequency_references {
+
+using units::isq::si::frequency_references::Hz;
+using units::isq::si::frequency_references::yHz;
+using units::isq::si::frequency_references::zHz;
+using units::isq::si::frequency_references::aHz;
+using units::isq::si::frequency_references::fHz;
+using units::isq::si::frequency_references::pHz;
+using units::isq::si::frequency_references::nHz;
+using units::isq::si::frequency_references::uHz;
+using units::isq::si::frequency_references::mHz;
+using units::isq::si::frequency_references::kHz;
+using units::isq::si::frequency_references::MHz;
+using units::isq::si::frequency_references::GHz;
+using units::isq::si::frequency_references::THz;
+using units::isq::si::frequency_references::PHz;
+using units::isq::si::frequency_references::EHz;
+using units::isq::si::frequency_references::ZHz;
+using units::isq::si::frequency_references::YHz;
+
+}  // namespace units::isq::si::frequency_references
+
+export namespace units::isq::si::inductance_references {
+
+using units::isq::si::inductance_references::H;
+using units::isq::si::inductance_references::yH;
+using units::isq::si::inductance_references::zH;
+using units::isq::si::inductance_references::aH;
+using units::isq::si::inductance_references::fH;
+using units::isq::si::inductance_references::pH;
+using units::isq::si::inductance_references::nH;
+using units::isq::si::inductance_references::uH;
+using units::isq::si::inductance_references::mH;
+using units::isq::si::inductance_references::kH;
+using units::isq::si::inductance_references::MH;
+using units::isq::si::inductance_references::GH;
+using units::isq::si::inductance_references::TH;
+using units::isq::si::inductance_references::PH;
+using units::isq::si::inductance_references::EH;
+using units::isq::si::inductance_references::ZH;
+using units::isq::si::inductance_references::YH;
+
+}  // namespace units::isq::si::inductance_references
+
+export namespace units::isq::si::length_references {
+
+using units::isq::si::length_references::m;
+using units::isq::si::length_references::ym;
+using units::isq::si::length_references::zm;
+using units::isq::si::length_references::am;
+using units::isq::si::length_references::fm;
+using units::isq::si::length_references::pm;
+using units::isq::si::length_references::nm;
+using units::isq::si::length_references::um;
+using units::isq::si::length_references::mm;
+using units::isq::si::length_references::cm;
+using units::isq::si::length_references::dm;
+using units::isq::si::length_references::dam;
+using units::isq::si::length_references::hm;
+using units::isq::si::length_references::km;
+using units::isq::si::length_references::Mm;
+using units::isq::si::length_references::Gm;
+using units::isq::si::length_references::Tm;
+using units::isq::si::length_references::Pm;
+using units::isq::si::length_references::Em;
+using units::isq::si::length_references::Zm;
+using units::isq::si::length_references::Ym;
+using units::isq::si::length_references::au;
+
+}  // namespace units::isq::si::length_references
+
+export namespace units::isq::si::luminous_intensity_references {
+
+using units::isq::si::luminous_intensity_references::cd;
+using units::isq::si::luminous_intensity_references::ycd;
+using units::isq::si::luminous_intensity_references::zcd;
+using units::isq::si::luminous_intensity_references::acd;
+using units::isq::si::luminous_intensity_references::fcd;
+using units::isq::si::luminous_intensity_references::pcd;
+using units::isq::si::luminous_intensity_references::ncd;
+using units::isq::si::luminous_intensity_references::ucd;
+using units::isq::si::luminous_intensity_references::mcd;
+using units::isq::si::luminous_intensity_references::ccd;
+using units::isq::si::luminous_intensity_references::dcd;
+using units::isq::si::luminous_intensity_references::dacd;
+using units::isq::si::luminous_intensity_references::hcd;
+using units::isq::si::luminous_intensity_references::kcd;
+using units::isq::si::luminous_intensity_references::Mcd;
+using units::isq::si::luminous_intensity_references::Gcd;
+using units::isq::si::luminous_intensity_references::Tcd;
+using units::isq::si::luminous_intensity_references::Pcd;
+using units::isq::si::luminous_intensity_references::Ecd;
+using units::isq::si::luminous_intensity_references::Zcd;
+using units::isq::si::luminous_intensity_references::Ycd;
+
+}  // namespace units::isq::si::luminous_intensity_references
+
+export namespace units::isq::si::magnetic_flux_references {
+
+using units::isq::si::magnetic_flux_references::Wb;
+using units::isq::si::magnetic_flux_references::yWb;
+using units::isq::si::magnetic_flux_references::zWb;
+using units::isq::si::magnetic_flux_references::aWb;
+using units::isq::si::magnetic_flux_references::fWb;
+using units::isq::si::magnetic_flux_references::pWb;
+using units::isq::si::magnetic_flux_references::nWb;
+using units::isq::si::magnetic_flux_references::uWb;
+using units::isq::si::magnetic_flux_references::mWb;
+using units::isq::si::magnetic_flux_references::kWb;
+using units::isq::si::magnetic_flux_references::MWb;
+using units::isq::si::magnetic_flux_references::GWb;
+using units::isq::si::magnetic_flux_references::TWb;
+using units::isq::si::magnetic_flux_references::PWb;
+using units::isq::si::magnetic_flux_references::EWb;
+using units::isq::si::magnetic_flux_references::ZWb;
+using units::isq::si::magnetic_flux_references::YWb;
+
+}  // namespace units::isq::si::magnetic_flux_references
+
+export namespace units::isq::si::magnetic_induction_references {
+
+using units::isq::si::magnetic_induction_references::T;
+using units::isq::si::magnetic_induction_references::yT;
+using units::isq::si::magnetic_induction_references::zT;
+using units::isq::si::magnetic_induction_references::aT;
+using units::isq::si::magnetic_induction_references::fT;
+using units::isq::si::magnetic_induction_references::pT;
+using units::isq::si::magnetic_induction_references::nT;
+using units::isq::si::magnetic_induction_references::uT;
+using units::isq::si::magnetic_induction_references::mT;
+using units::isq::si::magnetic_induction_references::kT;
+using units::isq::si::magnetic_induction_references::MT;
+using units::isq::si::magnetic_induction_references::GT;
+using units::isq::si::magnetic_induction_references::TT;
+using units::isq::si::magnetic_induction_references::PT;
+using units::isq::si::magnetic_induction_references::ET;
+using units::isq::si::magnetic_induction_references::ZT;
+using units::isq::si::magnetic_induction_references::YT;
+using units::isq::si::magnetic_induction_references::G;
+
+}  // namespace units::isq::si::magnetic_induction_references
+
+export namespace units::isq::si::mass_references {
+
+using units::isq::si::mass_references::g;
+using units::isq::si::mass_references::yg;
+using units::isq::si::mass_references::zg;
+using units::isq::si::mass_references::ag;
+using units::isq::si::mass_references::fg;
+using units::isq::si::mass_references::pg;
+using units::isq::si::mass_references::ng;
+using units::isq::si::mass_references::ug;
+using units::isq::si::mass_references::mg;
+using units::isq::si::mass_references::cg;
+using units::isq::si::mass_references::dg;
+using units::isq::si::mass_references::dag;
+using units::isq::si::mass_references::hg;
+using units::isq::si::mass_references::kg;
+using units::isq::si::mass_references::Mg;
+using units::isq::si::mass_references::Gg;
+using units::isq::si::mass_references::Tg;
+using units::isq::si::mass_references::Pg;
+using units::isq::si::mass_references::Eg;
+using units::isq::si::mass_references::Zg;
+using units::isq::si::mass_references::Yg;
+using units::isq::si::mass_references::t;
+using units::isq::si::mass_references::yt;
+using units::isq::si::mass_references::zt;
+using units::isq::si::mass_references::at;
+using units::isq::si::mass_references::ft;
+using units::isq::si::mass_references::pt;
+using units::isq::si::mass_references::nt;
+using units::isq::si::mass_references::ut;
+using units::isq::si::mass_references::mt;
+using units::isq::si::mass_references::ct;
+using units::isq::si::mass_references::dt;
+using units::isq::si::mass_references::dat;
+using units::isq::si::mass_references::ht;
+using units::isq::si::mass_references::kt;
+using units::isq::si::mass_references::Mt;
+using units::isq::si::mass_references::Gt;
+using units::isq::si::mass_references::Tt;
+using units::isq::si::mass_references::Pt;
+using units::isq::si::mass_references::Et;
+using units::isq::si::mass_references::Zt;
+using units::isq::si::mass_references::Yt;
+using units::isq::si::mass_references::Da;
+
+}  // namespace units::isq::si::mass_references
+
+export namespace units::isq::si::power_references {
+
+using units::isq::si::power_references::W;
+using units::isq::si::power_references::yW;
+using units::isq::si::power_references::zW;
+using units::isq::si::power_references::aW;
+using units::isq::si::power_references::fW;
+using units::isq::si::power_references::pW;
+using units::isq::si::power_references::nW;
+using units::isq::si::power_references::uW;
+using units::isq::si::power_references::mW;
+using units::isq::si::power_references::kW;
+using units::isq::si::power_references::MW;
+using units::isq::si::power_references::GW;
+using units::isq::si::power_references::TW;
+using units::isq::si::power_references::PW;
+using units::isq::si::power_references::EW;
+using units::isq::si::power_references::ZW;
+using units::isq::si::power_references::YW;
+
+}  // namespace units::isq::si::power_references
+
+export namespace units::isq::si::pressure_references {
+
+using units::isq::si::pressure_references::Pa;
+using units::isq::si::pressure_references::yPa;
+using units::isq::si::pressure_references::zPa;
+using units::isq::si::pressure_references::aPa;
+using units::isq::si::pressure_references::fPa;
+using units::isq::si::pressure_references::pPa;
+using units::isq::si::pressure_references::nPa;
+using units::isq::si::pressure_references::uPa;
+using units::isq::si::pressure_references::mPa;
+using units::isq::si::pressure_references::cPa;
+using units::isq::si::pressure_references::dPa;
+using units::isq::si::pressure_references::daPa;
+using units::isq::si::pressure_references::hPa;
+using units::isq::si::pressure_references::kPa;
+using units::isq::si::pressure_references::MPa;
+using units::isq::si::pressure_references::GPa;
+using units::isq::si::pressure_references::TPa;
+using units::isq::si::pressure_references::PPa;
+using units::isq::si::pressure_references::EPa;
+using units::isq::si::pressure_references::ZPa;
+using units::isq::si::pressure_references::YPa;
+
+}  // namespace units::isq::si::pressure_references
+
+export namespace units::isq::si::resistance_references {
+
+using units::isq::si::resistance_references::R;
+using units::isq::si::resistance_references::yR;
+using units::isq::si::resistance_references::zR;
+using units::isq::si::resistance_references::aR;
+using units::isq::si::resistance_references::fR;
+using units::isq::si::resistance_references::pR;
+using units::isq::si::resistance_references::nR;
+using units::isq::si::resistance_references::uR;
+using units::isq::si::resistance_references::mR;
+using units::isq::si::resistance_references::kR;
+using units::isq::si::resistance_references::MR;
+using units::isq::si::resistance_references::GR;
+using units::isq::si::resistance_references::TR;
+using units::isq::si::resistance_references::PR;
+using units::isq::si::resistance_references::ER;
+using units::isq::si::resistance_references::ZR;
+using units::isq::si::resistance_references::YR;
+
+}  // namespace units::isq::si::resistance_references
+
+export namespace units::isq::si::thermodynamic_temperature_references {
+
+using units::isq::si::thermodynamic_temperature_references::K;
+
+}  // namespace units::isq::si::thermodynamic_temperature_references
+
+export namespace units::isq::si::time_references {
+
+using units::isq::si::time_references::ys;
+using units::isq::si::time_references::zs;
+using units::isq::si::time_references::as;
+using units::isq::si::time_references::fs;
+using units::isq::si::time_references::ps;
+using units::isq::si::time_references::ns;
+using units::isq::si::time_references::us;
+using units::isq::si::time_references::ms;
+using units::isq::si::time_references::s;
+using units::isq::si::time_references::min;
+using units::isq::si::time_references::h;
+using units::isq::si::time_references::d;
+
+}  // namespace units::isq::si::time_references
+
+export namespace units::isq::si::voltage_references {
+
+using units::isq::si::voltage_references::V;
+using units::isq::si::voltage_references::yV;
+using units::isq::si::voltage_references::zV;
+using units::isq::si::voltage_references::aV;
+using units::isq::si::voltage_references::fV;
+using units::isq::si::voltage_references::pV;
+using units::isq::si::voltage_references::nV;
+using units::isq::si::voltage_references::uV;
+using units::isq::si::voltage_references::mV;
+using units::isq::si::voltage_references::cV;
+using units::isq::si::voltage_references::dV;
+using units::isq::si::voltage_references::daV;
+using units::isq::si::voltage_references::hV;
+using units::isq::si::voltage_references::kV;
+using units::isq::si::voltage_references::MV;
+using units::isq::si::voltage_references::GV;
+using units::isq::si::voltage_references::TV;
+using units::isq::si::voltage_references::PV;
+using units::isq::si::voltage_references::EV;
+using units::isq::si::voltage_references::ZV;
+using units::isq::si::voltage_references::YV;
+
+}  // namespace units::isq::si::voltage_references
+
+export namespace units::isq::si::volume_references {
+
+using units::isq::si::volume_references::m3;
+using units::isq::si::volume_references::ym3;
+using units::isq::si::volume_references::zm3;
+using units::isq::si::volume_references::am3;
+using units::isq::si::volume_references::fm3;
+using units::isq::si::volume_references::pm3;
+using units::isq::si::volume_references::nm3;
+using units::isq::si::volume_references::um3;
+using units::isq::si::volume_references::mm3;
+using units::isq::si::volume_references::cm3;
+using units::isq::si::volume_references::dm3;
+using units::isq::si::volume_references::dam3;
+using units::isq::si::volume_references::hm3;
+using units::isq::si::volume_references::km3;
+using units::isq::si::volume_references::Mm3;
+using units::isq::si::volume_references::Gm3;
+using units::isq::si::volume_references::Tm3;
+using units::isq::si::volume_references::Pm3;
+using units::isq::si::volume_references::Em3;
+using units::isq::si::volume_references::Zm3;
+using units::isq::si::volume_references::Ym3;
+using units::isq::si::volume_references::l;
+using units::isq::si::volume_references::yl;
+using units::isq::si::volume_references::zl;
+using units::isq::si::volume_references::al;
+using units::isq::si::volume_references::fl;
+using units::isq::si::volume_references::pl;
+using units::isq::si::volume_references::nl;
+using units::isq::si::volume_references::ul;
+using units::isq::si::volume_references::ml;
+using units::isq::si::volume_references::cl;
+using units::isq::si::volume_references::dl;
+using units::isq::si::volume_references::dal;
+using units::isq::si::volume_references::hl;
+using units::isq::si::volume_references::kl;
+using units::isq::si::volume_references::Ml;
+using units::isq::si::volume_references::Gl;
+using units::isq::si::volume_references::Tl;
+using units::isq::si::volume_references::Pl;
+using units::isq::si::volume_references::El;
+using units::isq::si::volume_references::Zl;
+using units::isq::si::volume_references::Yl;
+
+}  // namespace units::isq::si::volume_references
+
+export namespace units::references {
+
+using units::references::rad;
+
+}  // namespace units::references
+
+export namespace units::isq::si::references {
+
+using units::isq::si::references::Gy;
+using units::isq::si::references::yGy;
+using units::isq::si::references::zGy;
+using units::isq::si::references::aGy;
+using units::isq::si::references::fGy;
+using units::isq::si::references::pGy;
+using units::isq::si::references::nGy;
+using units::isq::si::references::uGy;
+using units::isq::si::references::mGy;
+using units::isq::si::references::cGy;
+using units::isq::si::references::dGy;
+using units::isq::si::references::daGy;
+using units::isq::si::references::hGy;
+using units::isq::si::references::kGy;
+using units::isq::si::references::MGy;
+using units::isq::si::references::GGy;
+using units::isq::si::references::TGy;
+using units::isq::si::references::PGy;
+using units::isq::si::references::EGy;
+using units::isq::si::references::ZGy;
+using units::isq::si::references::YGy;
+using units::isq::si::references::mol;
+using units::isq::si::references::m2;
+using units::isq::si::references::ym2;
+using units::isq::si::references::zm2;
+using units::isq::si::references::am2;
+using units::isq::si::references::fm2;
+using units::isq::si::references::pm2;
+using units::isq::si::references::nm2;
+using units::isq::si::references::um2;
+using units::isq::si::references::mm2;
+using units::isq::si::references::cm2;
+using units::isq::si::references::dm2;
+using units::isq::si::references::dam2;
+using units::isq::si::references::hm2;
+using units::isq::si::references::km2;
+using units::isq::si::references::Mm2;
+using units::isq::si::references::Gm2;
+using units::isq::si::references::Tm2;
+using units::isq::si::references::Pm2;
+using units::isq::si::references::Em2;
+using units::isq::si::references::Zm2;
+using units::isq::si::references::Ym2;
+using units::isq::si::references::ha;
+using units::isq::si::references::F;
+using units::isq::si::references::yF;
+using units::isq::si::references::zF;
+using units::isq::si::references::aF;
+using units::isq::si::references::fF;
+using units::isq::si::references::pF;
+using units::isq::si::references::nF;
+using units::isq::si::references::uF;
+using units::isq::si::references::mF;
+using units::isq::si::references::cF;
+using units::isq::si::references::dF;
+using units::isq::si::references::daF;
+using units::isq::si::references::hF;
+using units::isq::si::references::kF;
+using units::isq::si::references::MF;
+using units::isq::si::references::GF;
+using units::isq::si::references::TF;
+using units::isq::si::references::PF;
+using units::isq::si::references::EF;
+using units::isq::si::references::ZF;
+using units::isq::si::references::YF;
+using units::isq::si::references::kat;
+using units::isq::si::references::ykat;
+using units::isq::si::references::zkat;
+using units::isq::si::references::akat;
+using units::isq::si::references::fkat;
+using units::isq::si::references::pkat;
+using units::isq::si::references::nkat;
+using units::isq::si::references::ukat;
+using units::isq::si::references::mkat;
+using units::isq::si::references::ckat;
+using units::isq::si::references::dkat;
+using units::isq::si::references::dakat;
+using units::isq::si::references::hkat;
+using units::isq::si::references::kkat;
+using units::isq::si::references::Mkat;
+using units::isq::si::references::Gkat;
+using units::isq::si::references::Tkat;
+using units::isq::si::references::Pkat;
+using units::isq::si::references::Ekat;
+using units::isq::si::references::Zkat;
+using units::isq::si::references::Ykat;
+using units::isq::si::references::U;
+using units::isq::si::references::S;
+using units::isq::si::references::yS;
+using units::isq::si::references::zS;
+using units::isq::si::references::aS;
+using units::isq::si::references::fS;
+using units::isq::si::references::pS;
+using units::isq::si::references::nS;
+using units::isq::si::references::uS;
+using units::isq::si::references::mS;
+using units::isq::si::references::kS;
+using units::isq::si::references::MS;
+using units::isq::si::references::GS;
+using units::isq::si::references::TS;
+using units::isq::si::references::PS;
+using units::isq::si::references::ES;
+using units::isq::si::references::ZS;
+using units::isq::si::references::YS;
+using units::isq::si::references::C;
+using units::isq::si::references::A;
+using units::isq::si::references::yA;
+using units::isq::si::references::zA;
+using units::isq::si::references::aA;
+using units::isq::si::references::fA;
+using units::isq::si::references::pA;
+using units::isq::si::references::nA;
+using units::isq::si::references::uA;
+using units::isq::si::references::mA;
+using units::isq::si::references::cA;
+using units::isq::si::references::dA;
+using units::isq::si::references::daA;
+using units::isq::si::references::hA;
+using units::isq::si::references::kA;
+using units::isq::si::references::MA;
+using units::isq::si::references::GA;
+using units::isq::si::references::TA;
+using units::isq::si::references::PA;
+using units::isq::si::references::EA;
+using units::isq::si::references::ZA;
+using units::isq::si::references::YA;
+using units::isq::si::references::J;
+using units::isq::si::references::yJ;
+using units::isq::si::references::zJ;
+using units::isq::si::references::aJ;
+using units::isq::si::references::fJ;
+using units::isq::si::references::pJ;
+using units::isq::si::references::nJ;
+using units::isq::si::references::uJ;
+using units::isq::si::references::mJ;
+using units::isq::si::references::kJ;
+using units::isq::si::references::MJ;
+using units::isq::si::references::GJ;
+using units::isq::si::references::TJ;
+using units::isq::si::references::PJ;
+using units::isq::si::references::EJ;
+using units::isq::si::references::ZJ;
+using units::isq::si::references::YJ;
+using units::isq::si::references::eV;
+using units::isq::si::references::GeV;
+using units::isq::si::references::N;
+using units::isq::si::references::yN;
+using units::isq::si::references::zN;
+using units::isq::si::references::aN;
+using units::isq::si::references::fN;
+using units::isq::si::references::pN;
+using units::isq::si::references::nN;
+using units::isq::si::references::uN;
+using units::isq::si::references::mN;
+using units::isq::si::references::cN;
+using units::isq::si::references::dN;
+using units::isq::si::references::daN;
+using units::isq::si::references::hN;
+using units::isq::si::references::kN;
+using units::isq::si::references::MN;
+using units::isq::si::references::GN;
+using units::isq::si::references::TN;
+using units::isq::si::references::PN;
+using units::isq::si::references::EN;
+using units::isq::si::references::ZN;
+using units::isq::si::references::YN;
+using units::isq::si::references::Hz;
+using units::isq::si::references::yHz;
+using units::isq::si::references::zHz;
+using units::isq::si::references::aHz;
+using units::isq::si::references::fHz;
+using units::isq::si::references::pHz;
+using units::isq::si::references::nHz;
+using units::isq::si::references::uHz;
+using units::isq::si::references::mHz;
+using units::isq::si::references::kHz;
+using units::isq::si::references::MHz;
+using units::isq::si::references::GHz;
+using units::isq::si::references::THz;
+using units::isq::si::references::PHz;
+using units::isq::si::references::EHz;
+using units::isq::si::references::ZHz;
+using units::isq::si::references::YHz;
+using units::isq::si::references::H;
+using units::isq::si::references::yH;
+using units::isq::si::references::zH;
+using units::isq::si::references::aH;
+using units::isq::si::references::fH;
+using units::isq::si::references::pH;
+using units::isq::si::references::nH;
+using units::isq::si::references::uH;
+using units::isq::si::references::mH;
+using units::isq::si::references::kH;
+using units::isq::si::references::MH;
+using units::isq::si::references::GH;
+using units::isq::si::references::TH;
+using units::isq::si::references::PH;
+using units::isq::si::references::EH;
+using units::isq::si::references::ZH;
+using units::isq::si::references::YH;
+using units::isq::si::references::m;
+using units::isq::si::references::ym;
+using units::isq::si::references::zm;
+using units::isq::si::references::am;
+using units::isq::si::references::fm;
+using units::isq::si::references::pm;
+using units::isq::si::references::nm;
+using units::isq::si::references::um;
+using units::isq::si::references::mm;
+using units::isq::si::references::cm;
+using units::isq::si::references::dm;
+using units::isq::si::references::dam;
+using units::isq::si::references::hm;
+using units::isq::si::references::km;
+using units::isq::si::references::Mm;
+using units::isq::si::references::Gm;
+using units::isq::si::references::Tm;
+using units::isq::si::references::Pm;
+using units::isq::si::references::Em;
+using units::isq::si::references::Zm;
+using units::isq::si::references::Ym;
+using units::isq::si::references::au;
+using units::isq::si::references::cd;
+using units::isq::si::references::ycd;
+using units::isq::si::references::zcd;
+using units::isq::si::references::acd;
+using units::isq::si::references::fcd;
+using units::isq::si::references::pcd;
+using units::isq::si::references::ncd;
+using units::isq::si::references::ucd;
+using units::isq::si::references::mcd;
+using units::isq::si::references::ccd;
+using units::isq::si::references::dcd;
+using units::isq::si::references::dacd;
+using units::isq::si::references::hcd;
+using units::isq::si::references::kcd;
+using units::isq::si::references::Mcd;
+using units::isq::si::references::Gcd;
+using units::isq::si::references::Tcd;
+using units::isq::si::references::Pcd;
+using units::isq::si::references::Ecd;
+using units::isq::si::references::Zcd;
+using units::isq::si::references::Ycd;
+using units::isq::si::references::Wb;
+using units::isq::si::references::yWb;
+using units::isq::si::references::zWb;
+using units::isq::si::references::aWb;
+using units::isq::si::references::fWb;
+using units::isq::si::references::pWb;
+using units::isq::si::references::nWb;
+using units::isq::si::references::uWb;
+using units::isq::si::references::mWb;
+using units::isq::si::references::kWb;
+using units::isq::si::references::MWb;
+using units::isq::si::references::GWb;
+using units::isq::si::references::TWb;
+using units::isq::si::references::PWb;
+using units::isq::si::references::EWb;
+using units::isq::si::references::ZWb;
+using units::isq::si::references::YWb;
+using units::isq::si::references::T;
+using units::isq::si::references::yT;
+using units::isq::si::references::zT;
+using units::isq::si::references::aT;
+using units::isq::si::references::fT;
+using units::isq::si::references::pT;
+using units::isq::si::references::nT;
+using units::isq::si::references::uT;
+using units::isq::si::references::mT;
+using units::isq::si::references::kT;
+using units::isq::si::references::MT;
+using units::isq::si::references::GT;
+using units::isq::si::references::TT;
+using units::isq::si::references::PT;
+using units::isq::si::references::ET;
+using units::isq::si::references::ZT;
+using units::isq::si::references::YT;
+using units::isq::si::references::G;
+using units::isq::si::references::g;
+using units::isq::si::references::yg;
+using units::isq::si::references::zg;
+using units::isq::si::references::ag;
+using units::isq::si::references::fg;
+using units::isq::si::references::pg;
+using units::isq::si::references::ng;
+using units::isq::si::references::ug;
+using units::isq::si::references::mg;
+using units::isq::si::references::cg;
+using units::isq::si::references::dg;
+using units::isq::si::references::dag;
+using units::isq::si::references::hg;
+using units::isq::si::references::kg;
+using units::isq::si::references::Mg;
+using units::isq::si::references::Gg;
+using units::isq::si::references::Tg;
+using units::isq::si::references::Pg;
+using units::isq::si::references::Eg;
+using units::isq::si::references::Zg;
+using units::isq::si::references::Yg;
+using units::isq::si::references::t;
+using units::isq::si::references::yt;
+using units::isq::si::references::zt;
+using units::isq::si::references::at;
+using units::isq::si::references::ft;
+using units::isq::si::references::pt;
+using units::isq::si::references::nt;
+using units::isq::si::references::ut;
+using units::isq::si::references::mt;
+using units::isq::si::references::ct;
+using units::isq::si::references::dt;
+using units::isq::si::references::dat;
+using units::isq::si::references::ht;
+using units::isq::si::references::kt;
+using units::isq::si::references::Mt;
+using units::isq::si::references::Gt;
+using units::isq::si::references::Tt;
+using units::isq::si::references::Pt;
+using units::isq::si::references::Et;
+using units::isq::si::references::Zt;
+using units::isq::si::references::Yt;
+using units::isq::si::references::Da;
+using units::isq::si::references::W;
+using units::isq::si::references::yW;
+using units::isq::si::references::zW;
+using units::isq::si::references::aW;
+using units::isq::si::references::fW;
+using units::isq::si::references::pW;
+using units::isq::si::references::nW;
+using units::isq::si::references::uW;
+using units::isq::si::references::mW;
+using units::isq::si::references::kW;
+using units::isq::si::references::MW;
+using units::isq::si::references::GW;
+using units::isq::si::references::TW;
+using units::isq::si::references::PW;
+using units::isq::si::references::EW;
+using units::isq::si::references::ZW;
+using units::isq::si::references::YW;
+using units::isq::si::references::Pa;
+using units::isq::si::references::yPa;
+using units::isq::si::references::zPa;
+using units::isq::si::references::aPa;
+using units::isq::si::references::fPa;
+using units::isq::si::references::pPa;
+using units::isq::si::references::nPa;
+using units::isq::si::references::uPa;
+using units::isq::si::references::mPa;
+using units::isq::si::references::cPa;
+using units::isq::si::references::dPa;
+using units::isq::si::references::daPa;
+using units::isq::si::references::hPa;
+using units::isq::si::references::kPa;
+using units::isq::si::references::MPa;
+using units::isq::si::references::GPa;
+using units::isq::si::references::TPa;
+using units::isq::si::references::PPa;
+using units::isq::si::references::EPa;
+using units::isq::si::references::ZPa;
+using units::isq::si::references::YPa;
+using units::isq::si::references::R;
+using units::isq::si::references::yR;
+using units::isq::si::references::zR;
+using units::isq::si::references::aR;
+using units::isq::si::references::fR;
+using units::isq::si::references::pR;
+using units::isq::si::references::nR;
+using units::isq::si::references::uR;
+using units::isq::si::references::mR;
+using units::isq::si::references::kR;
+using units::isq::si::references::MR;
+using units::isq::si::references::GR;
+using units::isq::si::references::TR;
+using units::isq::si::references::PR;
+using units::isq::si::references::ER;
+using units::isq::si::references::ZR;
+using units::isq::si::references::YR;
+using units::isq::si::references::K;
+using units::isq::si::references::ys;
+using units::isq::si::references::zs;
+using units::isq::si::references::as;
+using units::isq::si::references::fs;
+using units::isq::si::references::ps;
+using units::isq::si::references::ns;
+using units::isq::si::references::us;
+using units::isq::si::references::ms;
+using units::isq::si::references::s;
+using units::isq::si::references::min;
+using units::isq::si::references::h;
+using units::isq::si::references::d;
+using units::isq::si::references::V;
+using units::isq::si::references::yV;
+using units::isq::si::references::zV;
+using units::isq::si::references::aV;
+using units::isq::si::references::fV;
+using units::isq::si::references::pV;
+using units::isq::si::references::nV;
+using units::isq::si::references::uV;
+using units::isq::si::references::mV;
+using units::isq::si::references::cV;
+using units::isq::si::references::dV;
+using units::isq::si::references::daV;
+using units::isq::si::references::hV;
+using units::isq::si::references::kV;
+using units::isq::si::references::MV;
+using units::isq::si::references::GV;
+using units::isq::si::references::TV;
+using units::isq::si::references::PV;
+using units::isq::si::references::EV;
+using units::isq::si::references::ZV;
+using units::isq::si::references::YV;
+using units::isq::si::references::m3;
+using units::isq::si::references::ym3;
+using units::isq::si::references::zm3;
+using units::isq::si::references::am3;
+using units::isq::si::references::fm3;
+using units::isq::si::references::pm3;
+using units::isq::si::references::nm3;
+using units::isq::si::references::um3;
+using units::isq::si::references::mm3;
+using units::isq::si::references::cm3;
+using units::isq::si::references::dm3;
+using units::isq::si::references::dam3;
+using units::isq::si::references::hm3;
+using units::isq::si::references::km3;
+using units::isq::si::references::Mm3;
+using units::isq::si::references::Gm3;
+using units::isq::si::references::Tm3;
+using units::isq::si::references::Pm3;
+using units::isq::si::references::Em3;
+using units::isq::si::references::Zm3;
+using units::isq::si::references::Ym3;
+using units::isq::si::references::l;
+using units::isq::si::references::yl;
+using units::isq::si::references::zl;
+using units::isq::si::references::al;
+using units::isq::si::references::fl;
+using units::isq::si::references::pl;
+using units::isq::si::references::nl;
+using units::isq::si::references::ul;
+using units::isq::si::references::ml;
+using units::isq::si::references::cl;
+using units::isq::si::references::dl;
+using units::isq::si::references::dal;
+using units::isq::si::references::hl;
+using units::isq::si::references::kl;
+using units::isq::si::references::Ml;
+using units::isq::si::references::Gl;
+using units::isq::si::references::Tl;
+using units::isq::si::references::Pl;
+using units::isq::si::references::El;
+using units::isq::si::references::Zl;
+using units::isq::si::references::Yl;
+
+}  // namespace units::isq::si::references
+
+#endif // UNITS_NO_REFERENCES
+
+#ifndef UNITS_NO_ALIASES
+
+export namespace units::aliases::isq::si::absorbed_dose {
+
+using units::aliases::isq::si::absorbed_dose::Gy;
+using units::aliases::isq::si::absorbed_dose::yGy;
+using units::aliases::isq::si::absorbed_dose::zGy;
+using units::aliases::isq::si::absorbed_dose::aGy;
+using units::aliases::isq::si::absorbed_dose::fGy;
+using units::aliases::isq::si::absorbed_dose::pGy;
+using units::aliases::isq::si::absorbed_dose::nGy;
+using units::aliases::isq::si::absorbed_dose::uGy;
+using units::aliases::isq::si::absorbed_dose::mGy;
+using units::aliases::isq::si::absorbed_dose::cGy;
+using units::aliases::isq::si::absorbed_dose::dGy;
+using units::aliases::isq::si::absorbed_dose::daGy;
+using units::aliases::isq::si::absorbed_dose::hGy;
+using units::aliases::isq::si::absorbed_dose::kGy;
+using units::aliases::isq::si::absorbed_dose::MGy;
+using units::aliases::isq::si::absorbed_dose::GGy;
+using units::aliases::isq::si::absorbed_dose::TGy;
+using units::aliases::isq::si::absorbed_dose::PGy;
+using units::aliases::isq::si::absorbed_dose::EGy;
+using units::aliases::isq::si::absorbed_dose::ZGy;
+using units::aliases::isq::si::absorbed_dose::YGy;
+
+}  // namespace units::aliases::isq::si::absorbed_dose
+
+export namespace units::aliases::isq::si::acceleration {
+
+using units::aliases::isq::si::acceleration::m_per_s2;
+
+}  // namespace units::aliases::isq::si::acceleration
+
+export namespace units::aliases::isq::si::amount_of_substance {
+
+using units::aliases::isq::si::amount_of_substance::mol;
+
+}  // namespace units::aliases::isq::si::amount_of_substance
+
+export namespace units::aliases::isq::si::angular_velocity {
+
+using units::aliases::isq::si::angular_velocity::rad_per_s;
+
+}  // namespace units::aliases::isq::si::angular_velocity
+
+export namespace units::aliases::isq::si::area {
+
+using units::aliases::isq::si::area::m2;
+using units::aliases::isq::si::area::ym2;
+using units::aliases::isq::si::area::zm2;
+using units::aliases::isq::si::area::am2;
+using units::aliases::isq::si::area::fm2;
+using units::aliases::isq::si::area::pm2;
+using units::aliases::isq::si::area::nm2;
+using units::aliases::isq::si::area::um2;
+using units::aliases::isq::si::area::mm2;
+using units::aliases::isq::si::area::cm2;
+using units::aliases::isq::si::area::dm2;
+using units::aliases::isq::si::area::dam2;
+using units::aliases::isq::si::area::hm2;
+using units::aliases::isq::si::area::km2;
+using units::aliases::isq::si::area::Mm2;
+using units::aliases::isq::si::area::Gm2;
+using units::aliases::isq::si::area::Tm2;
+using units::aliases::isq::si::area::Pm2;
+using units::aliases::isq::si::area::Em2;
+using units::aliases::isq::si::area::Zm2;
+using units::aliases::isq::si::area::Ym2;
+using units::aliases::isq::si::area::ha;
+
+}  // namespace units::aliases::isq::si::area
+
+export namespace units::aliases::isq::si::capacitance {
+
+using units::aliases::isq::si::capacitance::F;
+using units::aliases::isq::si::capacitance::yF;
+using units::aliases::isq::si::capacitance::zF;
+using units::aliases::isq::si::capacitance::aF;
+using units::aliases::isq::si::capacitance::fF;
+using units::aliases::isq::si::capacitance::pF;
+using units::aliases::isq::si::capacitance::nF;
+using units::aliases::isq::si::capacitance::uF;
+using units::aliases::isq::si::capacitance::mF;
+using units::aliases::isq::si::capacitance::cF;
+using units::aliases::isq::si::capacitance::dF;
+using units::aliases::isq::si::capacitance::daF;
+using units::aliases::isq::si::capacitance::hF;
+using units::aliases::isq::si::capacitance::kF;
+using units::aliases::isq::si::capacitance::MF;
+using units::aliases::isq::si::capacitance::GF;
+using units::aliases::isq::si::capacitance::TF;
+using units::aliases::isq::si::capacitance::PF;
+using units::aliases::isq::si::capacitance::EF;
+using units::aliases::isq::si::capacitance::ZF;
+using units::aliases::isq::si::capacitance::YF;
+
+}  // namespace units::aliases::isq::si::capacitance
+
+export namespace units::aliases::isq::si::catalytic_activity {
+
+using units::aliases::isq::si::catalytic_activity::kat;
+using units::aliases::isq::si::catalytic_activity::ykat;
+using units::aliases::isq::si::catalytic_activity::zkat;
+using units::aliases::isq::si::catalytic_activity::akat;
+using units::aliases::isq::si::catalytic_activity::fkat;
+using units::aliases::isq::si::catalytic_activity::pkat;
+using units::aliases::isq::si::catalytic_activity::nkat;
+using units::aliases::isq::si::catalytic_activity::ukat;
+using units::aliases::isq::si::catalytic_activity::mkat;
+using units::aliases::isq::si::catalytic_activity::ckat;
+using units::aliases::isq::si::catalytic_activity::dkat;
+using units::aliases::isq::si::catalytic_activity::dakat;
+using units::aliases::isq::si::catalytic_activity::hkat;
+using units::aliases::isq::si::catalytic_activity::kkat;
+using units::aliases::isq::si::catalytic_activity::Mkat;
+using units::aliases::isq::si::catalytic_activity::Gkat;
+using units::aliases::isq::si::catalytic_activity::Tkat;
+using units::aliases::isq::si::catalytic_activity::Pkat;
+using units::aliases::isq::si::catalytic_activity::Ekat;
+using units::aliases::isq::si::catalytic_activity::Zkat;
+using units::aliases::isq::si::catalytic_activity::Ykat;
+using units::aliases::isq::si::catalytic_activity::U;
+
+}  // namespace units::aliases::isq::si::catalytic_activity
+
+export namespace units::aliases::isq::si::charge_density {
+
+using units::aliases::isq::si::charge_density::C_per_m3;
+using units::aliases::isq::si::charge_density::C_per_m2;
+
+}  // namespace units::aliases::isq::si::charge_density
+
+export namespace units::aliases::isq::si::concentration {
+
+using units::aliases::isq::si::concentration::mol_per_m3;
+
+}  // namespace units::aliases::isq::si::concentration
+
+export namespace units::aliases::isq::si::conductance {
+
+using units::aliases::isq::si::conductance::S;
+using units::aliases::isq::si::conductance::yS;
+using units::aliases::isq::si::conductance::zS;
+using units::aliases::isq::si::conductance::aS;
+using units::aliases::isq::si::conductance::fS;
+using units::aliases::isq::si::conductance::pS;
+using units::aliases::isq::si::conductance::nS;
+using units::aliases::isq::si::conductance::uS;
+using units::aliases::isq::si::conductance::mS;
+using units::aliases::isq::si::conductance::kS;
+using units::aliases::isq::si::conductance::MS;
+using units::aliases::isq::si::conductance::GS;
+using units::aliases::isq::si::conductance::TS;
+using units::aliases::isq::si::conductance::PS;
+using units::aliases::isq::si::conductance::ES;
+using units::aliases::isq::si::conductance::ZS;
+using units::aliases::isq::si::conductance::YS;
+
+}  // namespace units::aliases::isq::si::conductance
+
+export namespace units::aliases::isq::si::current_density {
+
+using units::aliases::isq::si::current_density::A_per_m2;
+
+}  // namespace units::aliases::isq::si::current_density
+
+export namespace units::aliases::isq::si::density {
+
+using units::aliases::isq::si::density::kg_per_m3;
+
+}  // namespace units::aliases::isq::si::density
+
+export namespace units::aliases::isq::si::dynamic_viscosity {
+
+using units::aliases::isq::si::dynamic_viscosity::Pa_s;
+
+}  // namespace units::aliases::isq::si::dynamic_viscosity
+
+export namespace units::aliases::isq::si::electric_charge {
+
+using units::aliases::isq::si::electric_charge::C;
+
+}  // namespace units::aliases::isq::si::electric_charge
+
+export namespace units::aliases::isq::si::electric_current {
+
+using units::aliases::isq::si::electric_current::A;
+using units::aliases::isq::si::electric_current::yA;
+using units::aliases::isq::si::electric_current::zA;
+using units::aliases::isq::si::electric_current::aA;
+using units::aliases::isq::si::electric_current::fA;
+using units::aliases::isq::si::electric_current::pA;
+using units::aliases::isq::si::electric_current::nA;
+using units::aliases::isq::si::electric_current::uA;
+using units::aliases::isq::si::electric_current::mA;
+using units::aliases::isq::si::electric_current::cA;
+using units::aliases::isq::si::electric_current::dA;
+using units::aliases::isq::si::electric_current::daA;
+using units::aliases::isq::si::electric_current::hA;
+using units::aliases::isq::si::electric_current::kA;
+using units::aliases::isq::si::electric_current::MA;
+using units::aliases::isq::si::electric_current::GA;
+using units::aliases::isq::si::electric_current::TA;
+using units::aliases::isq::si::electric_current::PA;
+using units::aliases::isq::si::electric_current::EA;
+using units::aliases::isq::si::electric_current::ZA;
+using units::aliases::isq::si::electric_current::YA;
+
+}  // namespace units::aliases::isq::si::electric_current
+
+export namespace units::aliases::isq::si::electric_field_strength {
+
+using units::aliases::isq::si::electric_field_strength::V_per_m;
+
+}  // namespace units::aliases::isq::si::electric_field_strength
+
+export namespace units::aliases::isq::si::energy {
+
+using units::aliases::isq::si::energy::J;
+using units::aliases::isq::si::energy::yJ;
+using units::aliases::isq::si::energy::zJ;
+using units::aliases::isq::si::energy::aJ;
+using units::aliases::isq::si::energy::fJ;
+using units::aliases::isq::si::energy::pJ;
+using units::aliases::isq::si::energy::nJ;
+using units::aliases::isq::si::energy::uJ;
+using units::aliases::isq::si::energy::mJ;
+using units::aliases::isq::si::energy::kJ;
+using units::aliases::isq::si::energy::MJ;
+using units::aliases::isq::si::energy::GJ;
+using units::aliases::isq::si::energy::TJ;
+using units::aliases::isq::si::energy::PJ;
+using units::aliases::isq::si::energy::EJ;
+using units::aliases::isq::si::energy::ZJ;
+using units::aliases::isq::si::energy::YJ;
+using units::aliases::isq::si::energy::eV;
+using units::aliases::isq::si::energy::GeV;
+
+}  // namespace units::aliases::isq::si::energy
+
+export namespace units::aliases::isq::si::force {
+
+using units::aliases::isq::si::force::N;
+using units::aliases::isq::si::force::yN;
+using units::aliases::isq::si::force::zN;
+using units::aliases::isq::si::force::aN;
+using units::aliases::isq::si::force::fN;
+using units::aliases::isq::si::force::pN;
+using units::aliases::isq::si::force::nN;
+using units::aliases::isq::si::force::uN;
+using units::aliases::isq::si::force::mN;
+using units::aliases::isq::si::force::cN;
+using units::aliases::isq::si::force::dN;
+using units::aliases::isq::si::force::daN;
+using units::aliases::isq::si::force::hN;
+using units::aliases::isq::si::force::kN;
+using units::aliases::isq::si::force::MN;
+using units::aliases::isq::si::force::GN;
+using units::aliases::isq::si::force::TN;
+using units::aliases::isq::si::force::PN;
+using units::aliases::isq::si::force::EN;
+using units::aliases::isq::si::force::ZN;
+using units::aliases::isq::si::force::YN;
+
+}  // namespace units::aliases::isq::si::force
+
+export namespace units::aliases::isq::si::frequency {
+
+using units::aliases::isq::si::frequency::Hz;
+using units::aliases::isq::si::frequency::yHz;
+using units::aliases::isq::si::frequency::zHz;
+using units::aliases::isq::si::frequency::aHz;
+using units::aliases::isq::si::frequency::fHz;
+using units::aliases::isq::si::frequency::pHz;
+using units::aliases::isq::si::frequency::nHz;
+using units::aliases::isq::si::frequency::uHz;
+using units::aliases::isq::si::frequency::mHz;
+using units::aliases::isq::si::frequency::kHz;
+using units::aliases::isq::si::frequency::MHz;
+using units::aliases::isq::si::frequency::GHz;
+using units::aliases::isq::si::frequency::THz;
+using units::aliases::isq::si::frequency::PHz;
+using units::aliases::isq::si::frequency::EHz;
+using units::aliases::isq::si::frequency::ZHz;
+using units::aliases::isq::si::frequency::YHz;
+
+}  // namespace units::aliases::isq::si::frequency
+
+export namespace units::aliases::isq::si::heat_capacity {
+
+using units::aliases::isq::si::heat_capacity::J_per_K;
+using units::aliases::isq::si::heat_capacity::J_per_kg_K;
+using units::aliases::isq::si::heat_capacity::J_per_mol_K;
+
+}  // namespace units::aliases::isq::si::heat_capacity
+
+export namespace units::aliases::isq::si::inductance {
+
+using units::aliases::isq::si::inductance::H;
+using units::aliases::isq::si::inductance::yH;
+using units::aliases::isq::si::inductance::zH;
+using units::aliases::isq::si::inductance::aH;
+using units::aliases::isq::si::inductance::fH;
+using units::aliases::isq::si::inductance::pH;
+using units::aliases::isq::si::inductance::nH;
+using units::aliases::isq::si::inductance::uH;
+using units::aliases::isq::si::inductance::mH;
+using units::aliases::isq::si::inductance::kH;
+using units::aliases::isq::si::inductance::MH;
+using units::aliases::isq::si::inductance::GH;
+using units::aliases::isq::si::inductance::TH;
+using units::aliases::isq::si::inductance::PH;
+using units::aliases::isq::si::inductance::EH;
+using units::aliases::isq::si::inductance::ZH;
+using units::aliases::isq::si::inductance::YH;
+
+}  // namespace units::aliases::isq::si::inductance
+
+export namespace units::aliases::isq::si::length {
+
+using units::aliases::isq::si::length::m;
+using units::aliases::isq::si::length::ym;
+using units::aliases::isq::si::length::zm;
+using units::aliases::isq::si::length::am;
+using units::aliases::isq::si::length::fm;
+using units::aliases::isq::si::length::pm;
+using units::aliases::isq::si::length::nm;
+using units::aliases::isq::si::length::um;
+using units::aliases::isq::si::length::mm;
+using units::aliases::isq::si::length::cm;
+using units::aliases::isq::si::length::dm;
+using units::aliases::isq::si::length::dam;
+using units::aliases::isq::si::length::hm;
+using units::aliases::isq::si::length::km;
+using units::aliases::isq::si::length::Mm;
+using units::aliases::isq::si::length::Gm;
+using units::aliases::isq::si::length::Tm;
+using units::aliases::isq::si::length::Pm;
+using units::aliases::isq::si::length::Em;
+using units::aliases::isq::si::length::Zm;
+using units::aliases::isq::si::length::Ym;
+using units::aliases::isq::si::length::au;
+
+}  // namespace units::aliases::isq::si::length
+
+export namespace units::aliases::isq::si::luminance {
+
+using units::aliases::isq::si::luminance::cd_per_m2;
+
+}  // namespace units::aliases::isq::si::luminance
+
+export namespace units::aliases::isq::si::luminous_intensity {
+
+using units::aliases::isq::si::luminous_intensity::cd;
+using units::aliases::isq::si::luminous_intensity::ycd;
+using units::aliases::isq::si::luminous_intensity::zcd;
+using units::aliases::isq::si::luminous_intensity::acd;
+using units::aliases::isq::si::luminous_intensity::fcd;
+using units::aliases::isq::si::luminous_intensity::pcd;
+using units::aliases::isq::si::luminous_intensity::ncd;
+using units::aliases::isq::si::luminous_intensity::ucd;
+using units::aliases::isq::si::luminous_intensity::mcd;
+using units::aliases::isq::si::luminous_intensity::ccd;
+using units::aliases::isq::si::luminous_intensity::dcd;
+using units::aliases::isq::si::luminous_intensity::dacd;
+using units::aliases::isq::si::luminous_intensity::hcd;
+using units::aliases::isq::si::luminous_intensity::kcd;
+using units::aliases::isq::si::luminous_intensity::Mcd;
+using units::aliases::isq::si::luminous_intensity::Gcd;
+using units::aliases::isq::si::luminous_intensity::Tcd;
+using units::aliases::isq::si::luminous_intensity::Pcd;
+using units::aliases::isq::si::luminous_intensity::Ecd;
+using units::aliases::isq::si::luminous_intensity::Zcd;
+using units::aliases::isq::si::luminous_intensity::Ycd;
+
+}  // namespace units::aliases::isq::si::luminous_intensity
+
+export namespace units::aliases::isq::si::magnetic_flux {
+
+using units::aliases::isq::si::magnetic_flux::Wb;
+using units::aliases::isq::si::magnetic_flux::yWb;
+using units::aliases::isq::si::magnetic_flux::zWb;
+using units::aliases::isq::si::magnetic_flux::aWb;
+using units::aliases::isq::si::magnetic_flux::fWb;
+using units::aliases::isq::si::magnetic_flux::pWb;
+using units::aliases::isq::si::magnetic_flux::nWb;
+using units::aliases::isq::si::magnetic_flux::uWb;
+using units::aliases::isq::si::magnetic_flux::mWb;
+using units::aliases::isq::si::magnetic_flux::kWb;
+using units::aliases::isq::si::magnetic_flux::MWb;
+using units::aliases::isq::si::magnetic_flux::GWb;
+using units::aliases::isq::si::magnetic_flux::TWb;
+using units::aliases::isq::si::magnetic_flux::PWb;
+using units::aliases::isq::si::magnetic_flux::EWb;
+using units::aliases::isq::si::magnetic_flux::ZWb;
+using units::aliases::isq::si::magnetic_flux::YWb;
+
+}  // namespace units::aliases::isq::si::magnetic_flux
+
+export namespace units::aliases::isq::si::magnetic_induction {
+
+using units::aliases::isq::si::magnetic_induction::T;
+using units::aliases::isq::si::magnetic_induction::yT;
+using units::aliases::isq::si::magnetic_induction::zT;
+using units::aliases::isq::si::magnetic_induction::aT;
+using units::aliases::isq::si::magnetic_induction::fT;
+using units::aliases::isq::si::magnetic_induction::pT;
+using units::aliases::isq::si::magnetic_induction::nT;
+using units::aliases::isq::si::magnetic_induction::uT;
+using units::aliases::isq::si::magnetic_induction::mT;
+using units::aliases::isq::si::magnetic_induction::kT;
+using units::aliases::isq::si::magnetic_induction::MT;
+using units::aliases::isq::si::magnetic_induction::GT;
+using units::aliases::isq::si::magnetic_induction::TT;
+using units::aliases::isq::si::magnetic_induction::PT;
+using units::aliases::isq::si::magnetic_induction::ET;
+using units::aliases::isq::si::magnetic_induction::ZT;
+using units::aliases::isq::si::magnetic_induction::YT;
+using units::aliases::isq::si::magnetic_induction::G;
+
+}  // namespace units::aliases::isq::si::magnetic_induction
+
+export namespace units::aliases::isq::si::mass {
+
+using units::aliases::isq::si::mass::g;
+using units::aliases::isq::si::mass::yg;
+using units::aliases::isq::si::mass::zg;
+using units::aliases::isq::si::mass::ag;
+using units::aliases::isq::si::mass::fg;
+using units::aliases::isq::si::mass::pg;
+using units::aliases::isq::si::mass::ng;
+using units::aliases::isq::si::mass::ug;
+using units::aliases::isq::si::mass::mg;
+using units::aliases::isq::si::mass::cg;
+using units::aliases::isq::si::mass::dg;
+using units::aliases::isq::si::mass::dag;
+using units::aliases::isq::si::mass::hg;
+using units::aliases::isq::si::mass::kg;
+using units::aliases::isq::si::mass::Mg;
+using units::aliases::isq::si::mass::Gg;
+using units::aliases::isq::si::mass::Tg;
+using units::aliases::isq::si::mass::Pg;
+using units::aliases::isq::si::mass::Eg;
+using units::aliases::isq::si::mass::Zg;
+using units::aliases::isq::si::mass::Yg;
+using units::aliases::isq::si::mass::t;
+using units::aliases::isq::si::mass::yt;
+using units::aliases::isq::si::mass::zt;
+using units::aliases::isq::si::mass::at;
+using units::aliases::isq::si::mass::ft;
+using units::aliases::isq::si::mass::pt;
+using units::aliases::isq::si::mass::nt;
+using units::aliases::isq::si::mass::ut;
+using units::aliases::isq::si::mass::mt;
+using units::aliases::isq::si::mass::ct;
+using units::aliases::isq::si::mass::dt;
+using units::aliases::isq::si::mass::dat;
+using units::aliases::isq::si::mass::ht;
+using units::aliases::isq::si::mass::kt;
+using units::aliases::isq::si::mass::Mt;
+using units::aliases::isq::si::mass::Gt;
+using units::aliases::isq::si::mass::Tt;
+using units::aliases::isq::si::mass::Pt;
+using units::aliases::isq::si::mass::Et;
+using units::aliases::isq::si::mass::Zt;
+using units::aliases::isq::si::mass::Yt;
+using units::aliases::isq::si::mass::Da;
+
+}  // namespace units::aliases::isq::si::mass
+
+export namespace units::aliases::isq::si::molar_energy {
+
+using units::aliases::isq::si::molar_energy::J_per_mol;
+
+}  // namespace units::aliases::isq::si::molar_energy
+
+export namespace units::aliases::isq::si::momentum {
+
+using units::aliases::isq::si::momentum::kg_m_per_s;
+
+}  // namespace units::aliases::isq::si::momentum
+
+export namespace units::aliases::isq::si::permeability {
+
+using units::aliases::isq::si::permeability::H_per_m;
+
+}  // namespace units::aliases::isq::si::permeability
+
+export namespace units::aliases::isq::si::permittivity {
+
+using units::aliases::isq::si::permittivity::F_per_m;
+
+}  // namespace units::aliases::isq::si::permittivity
+
+export namespace units::aliases::isq::si::power {
+
+using units::aliases::isq::si::power::W;
+using units::aliases::isq::si::power::yW;
+using units::aliases::isq::si::power::zW;
+using units::aliases::isq::si::power::aW;
+using units::aliases::isq::si::power::fW;
+using units::aliases::isq::si::power::pW;
+using units::aliases::isq::si::power::nW;
+using units::aliases::isq::si::power::uW;
+using units::aliases::isq::si::power::mW;
+using units::aliases::isq::si::power::kW;
+using units::aliases::isq::si::power::MW;
+using units::aliases::isq::si::power::GW;
+using units::aliases::isq::si::power::TW;
+using units::aliases::isq::si::power::PW;
+using units::aliases::isq::si::power::EW;
+using units::aliases::isq::si::power::ZW;
+using units::aliases::isq::si::power::YW;
+
+}  // namespace units::aliases::isq::si::power
+
+export namespace units::aliases::isq::si::pressure {
+
+using units::aliases::isq::si::pressure::Pa;
+using units::aliases::isq::si::pressure::yPa;
+using units::aliases::isq::si::pressure::zPa;
+using units::aliases::isq::si::pressure::aPa;
+using units::aliases::isq::si::pressure::fPa;
+using units::aliases::isq::si::pressure::pPa;
+using units::aliases::isq::si::pressure::nPa;
+using units::aliases::isq::si::pressure::uPa;
+using units::aliases::isq::si::pressure::mPa;
+using units::aliases::isq::si::pressure::cPa;
+using units::aliases::isq::si::pressure::dPa;
+using units::aliases::isq::si::pressure::daPa;
+using units::aliases::isq::si::pressure::hPa;
+using units::aliases::isq::si::pressure::kPa;
+using units::aliases::isq::si::pressure::MPa;
+using units::aliases::isq::si::pressure::GPa;
+using units::aliases::isq::si::pressure::TPa;
+using units::aliases::isq::si::pressure::PPa;
+using units::aliases::isq::si::pressure::EPa;
+using units::aliases::isq::si::pressure::ZPa;
+using units::aliases::isq::si::pressure::YPa;
+
+}  // namespace units::aliases::isq::si::pressure
+
+export namespace units::aliases::isq::si::resistance {
+
+using units::aliases::isq::si::resistance::R;
+using units::aliases::isq::si::resistance::yR;
+using units::aliases::isq::si::resistance::zR;
+using units::aliases::isq::si::resistance::aR;
+using units::aliases::isq::si::resistance::fR;
+using units::aliases::isq::si::resistance::pR;
+using units::aliases::isq::si::resistance::nR;
+using units::aliases::isq::si::resistance::uR;
+using units::aliases::isq::si::resistance::mR;
+using units::aliases::isq::si::resistance::kR;
+using units::aliases::isq::si::resistance::MR;
+using units::aliases::isq::si::resistance::GR;
+using units::aliases::isq::si::resistance::TR;
+using units::aliases::isq::si::resistance::PR;
+using units::aliases::isq::si::resistance::ER;
+using units::aliases::isq::si::resistance::ZR;
+using units::aliases::isq::si::resistance::YR;
+
+}  // namespace units::aliases::isq::si::resistance
+
+export namespace units::aliases::isq::si::speed {
+
+using units::aliases::isq::si::speed::m_per_s;
+using units::aliases::isq::si::speed::km_per_h;
+
+}  // namespace units::aliases::isq::si::speed
+
+export namespace units::aliases::isq::si::surface_tension {
+
+using units::aliases::isq::si::surface_tension::N_per_m;
+
+}  // namespace units::aliases::isq::si::surface_tension
+
+export namespace units::aliases::isq::si::thermal_conductivity {
+
+using units::aliases::isq::si::thermal_conductivity::W_per_m_K;
+
+}  // namespace units::aliases::isq::si::thermal_conductivity
+
+export namespace units::aliases::isq::si::thermodynamic_temperature {
+
+using units::aliases::isq::si::thermodynamic_temperature::K;
+
+}  // namespace units::aliases::isq::si::thermodynamic_temperature
+
+export namespace units::aliases::isq::si::time {
+
+using units::aliases::isq::si::time::ys;
+using units::aliases::isq::si::time::zs;
+using units::aliases::isq::si::time::as;
+using units::aliases::isq::si::time::fs;
+using units::aliases::isq::si::time::ps;
+using units::aliases::isq::si::time::ns;
+using units::aliases::isq::si::time::us;
+using units::aliases::isq::si::time::ms;
+using units::aliases::isq::si::time::s;
+using units::aliases::isq::si::time::min;
+using units::aliases::isq::si::time::h;
+using units::aliases::isq::si::time::d;
+
+}  // namespace units::aliases::isq::si::time
+
+export namespace units::aliases::isq::si::torque {
+
+using units::aliases::isq::si::torque::N_m_per_rad;
+
+}  // namespace units::aliases::isq::si::torque
+
+export namespace units::aliases::isq::si::voltage {
+
+using units::aliases::isq::si::voltage::V;
+using units::aliases::isq::si::voltage::yV;
+using units::aliases::isq::si::voltage::zV;
+using units::aliases::isq::si::voltage::aV;
+using units::aliases::isq::si::voltage::fV;
+using units::aliases::isq::si::voltage::pV;
+using units::aliases::isq::si::voltage::nV;
+using units::aliases::isq::si::voltage::uV;
+using units::aliases::isq::si::voltage::mV;
+using units::aliases::isq::si::voltage::cV;
+using units::aliases::isq::si::voltage::dV;
+using units::aliases::isq::si::voltage::daV;
+using units::aliases::isq::si::voltage::hV;
+using units::aliases::isq::si::voltage::kV;
+using units::aliases::isq::si::voltage::MV;
+using units::aliases::isq::si::voltage::GV;
+using units::aliases::isq::si::voltage::TV;
+using units::aliases::isq::si::voltage::PV;
+using units::aliases::isq::si::voltage::EV;
+using units::aliases::isq::si::voltage::ZV;
+using units::aliases::isq::si::voltage::YV;
+
+}  // namespace units::aliases::isq::si::voltage
+
+export namespace units::aliases::isq::si::volume {
+
+using units::aliases::isq::si::volume::m3;
+using units::aliases::isq::si::volume::ym3;
+using units::aliases::isq::si::volume::zm3;
+using units::aliases::isq::si::volume::am3;
+using units::aliases::isq::si::volume::fm3;
+using units::aliases::isq::si::volume::pm3;
+using units::aliases::isq::si::volume::nm3;
+using units::aliases::isq::si::volume::um3;
+using units::aliases::isq::si::volume::mm3;
+using units::aliases::isq::si::volume::cm3;
+using units::aliases::isq::si::volume::dm3;
+using units::aliases::isq::si::volume::dam3;
+using units::aliases::isq::si::volume::hm3;
+using units::aliases::isq::si::volume::km3;
+using units::aliases::isq::si::volume::Mm3;
+using units::aliases::isq::si::volume::Gm3;
+using units::aliases::isq::si::volume::Tm3;
+using units::aliases::isq::si::volume::Pm3;
+using units::aliases::isq::si::volume::Em3;
+using units::aliases::isq::si::volume::Zm3;
+using units::aliases::isq::si::volume::Ym3;
+using units::aliases::isq::si::volume::l;
+using units::aliases::isq::si::volume::yl;
+using units::aliases::isq::si::volume::zl;
+using units::aliases::isq::si::volume::al;
+using units::aliases::isq::si::volume::fl;
+using units::aliases::isq::si::volume::pl;
+using units::aliases::isq::si::volume::nl;
+using units::aliases::isq::si::volume::ul;
+using units::aliases::isq::si::volume::ml;
+using units::aliases::isq::si::volume::cl;
+using units::aliases::isq::si::volume::dl;
+using units::aliases::isq::si::volume::dal;
+using units::aliases::isq::si::volume::hl;
+using units::aliases::isq::si::volume::kl;
+using units::aliases::isq::si::volume::Ml;
+using units::aliases::isq::si::volume::Gl;
+using units::aliases::isq::si::volume::Tl;
+using units::aliases::isq::si::volume::Pl;
+using units::aliases::isq::si::volume::El;
+using units::aliases::isq::si::volume::Zl;
+using units::aliases::isq::si::volume::Yl;
+
+}  // namespace units::aliases::isq::si::volume
+
+#endif // UNITS_NO_ALIASES
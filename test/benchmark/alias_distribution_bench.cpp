@@ -0,0 +1,73 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/alias_distribution.h>
+#include <units/isq/si/time.h>
+#include <units/random.h>
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+using namespace units;
+using namespace units::isq::si;
+
+namespace {
+
+constexpr std::size_t samples = 1'000'000;
+constexpr std::size_t bins = 4096;
+
+using latency = isq::si::time<millisecond, double>;
+
+}  // namespace
+
+TEST_CASE("alias_distribution vs piecewise_constant_distribution", "[alias_distribution]")
+{
+  // an empirical latency histogram with a long tail
+  std::vector<latency> bounds(bins + 1);
+  std::vector<double> weights(bins);
+  for (std::size_t i = 0; i <= bins; ++i) bounds[i] = latency(static_cast<double>(i) * 0.25);
+  for (std::size_t i = 0; i < bins; ++i) weights[i] = std::exp(-static_cast<double>(i) / 200.) * static_cast<double>(i % 7 + 1);
+
+  std::mt19937_64 gen;
+  std::vector<latency> out(samples);
+
+  SECTION("construction") {
+    BENCHMARK("piecewise_constant_distribution") { return units::piecewise_constant_distribution<latency>(bounds, weights); };
+    BENCHMARK("alias_distribution") { return alias_distribution<latency>(histogram_bins, bounds, weights); };
+  }
+
+  SECTION("sampling") {
+    auto pwc = units::piecewise_constant_distribution<latency>(bounds, weights);
+    const auto alias = alias_distribution<latency>(histogram_bins, bounds, weights);
+
+    BENCHMARK("piecewise_constant_distribution") {
+      pwc.generate(gen, out);
+      return out.back();
+    };
+    BENCHMARK("alias_distribution") {
+      alias.generate(gen, out);
+      return out.back();
+    };
+  }
+}
@@ -0,0 +1,160 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/isq/si/length.h>
+#include <units/parallel_random.h>
+#include <units/random.h>
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace units;
+using namespace units::isq::si;
+
+// Throughput of all the distributions of <units/random.h> compared to the underlying std:: ones
+// drawing from the same engine. Divide the number of samples by the reported time to get samples/s.
+
+namespace {
+
+constexpr std::size_t samples = 100'000;
+
+using qi = length<metre, std::int64_t>;
+using qf = length<metre, double>;
+
+template<typename UnitsDist, typename StdDist>
+void compare(UnitsDist units_dist, StdDist std_dist)
+{
+  using Q = std::invoke_result_t<UnitsDist&, std::mt19937_64&>;
+  using rep = TYPENAME StdDist::result_type;
+  std::mt19937_64 gen;
+  std::vector<rep> std_out(samples);
+  std::vector<Q> units_out(samples);
+
+  BENCHMARK("std::") {
+    for (rep& v : std_out) v = std_dist(gen);
+    return std_out.back();
+  };
+  BENCHMARK("units:: operator()") {
+    for (Q& q : units_out) q = units_dist(gen);
+    return units_out.back();
+  };
+  BENCHMARK("units:: generate()") {
+    units_dist.generate(gen, units_out);
+    return units_out.back();
+  };
+}
+
+}  // namespace
+
+TEST_CASE("distribution throughput", "[distribution]")
+{
+  const std::vector<double> bounds = {0.0, 1.0, 2.0, 4.0, 8.0};
+  const std::vector<qf> bounds_qty = {qf(0.0), qf(1.0), qf(2.0), qf(4.0), qf(8.0)};
+  const std::vector<double> weights = {1.0, 3.0, 2.0, 1.0, 0.5};
+
+  // clang-format off
+  SECTION("uniform_int_distribution") { compare(units::uniform_int_distribution(qi(0), qi(100)), std::uniform_int_distribution<std::int64_t>(0, 100)); }
+  SECTION("uniform_real_distribution") { compare(units::uniform_real_distribution(qf(0.), qf(1.)), std::uniform_real_distribution(0., 1.)); }
+  SECTION("binomial_distribution") { compare(units::binomial_distribution(qi(100), 0.3), std::binomial_distribution<std::int64_t>(100, 0.3)); }
+  SECTION("negative_binomial_distribution") { compare(units::negative_binomial_distribution(qi(10), 0.3), std::negative_binomial_distribution<std::int64_t>(10, 0.3)); }
+  SECTION("geometric_distribution") { compare(units::geometric_distribution<qi>(0.3), std::geometric_distribution<std::int64_t>(0.3)); }
+  SECTION("poisson_distribution") { compare(units::poisson_distribution<qi>(4.), std::poisson_distribution<std::int64_t>(4.)); }
+  SECTION("exponential_distribution") { compare(units::exponential_distribution<qf>(2.), std::exponential_distribution(2.)); }
+  SECTION("gamma_distribution") { compare(units::gamma_distribution<qf>(2., 3.), std::gamma_distribution(2., 3.)); }
+  SECTION("weibull_distribution") { compare(units::weibull_distribution<qf>(2., 3.), std::weibull_distribution(2., 3.)); }
+  SECTION("extreme_value_distribution") { compare(units::extreme_value_distribution(qf(2.), 3.), std::extreme_value_distribution(2., 3.)); }
+  SECTION("normal_distribution") { compare(units::normal_distribution(qf(2.), qf(3.)), std::normal_distribution(2., 3.)); }
+  SECTION("lognormal_distribution") { compare(units::lognormal_distribution(qf(2.), qf(3.)), std::lognormal_distribution(2., 3.)); }
+  SECTION("chi_squared_distribution") { compare(units::chi_squared_distribution<qf>(4.), std::chi_squared_distribution(4.)); }
+  SECTION("cauchy_distribution") { compare(units::cauchy_distribution(qf(2.), qf(3.)), std::cauchy_distribution(2., 3.)); }
+  SECTION("fisher_f_distribution") { compare(units::fisher_f_distribution<qf>(2., 3.), std::fisher_f_distribution(2., 3.)); }
+  SECTION("student_t_distribution") { compare(units::student_t_distribution<qf>(4.), std::student_t_distribution(4.)); }
+  SECTION("discrete_distribution") { compare(units::discrete_distribution<qi>({1., 3., 2., 1., 0.5}), std::discrete_distribution<std::int64_t>({1., 3., 2., 1., 0.5})); }
+  SECTION("piecewise_constant_distribution") { compare(units::piecewise_constant_distribution<qf>(bounds_qty, weights), std::piecewise_constant_distribution<double>(bounds.begin(), bounds.end(), weights.begin())); }
+  SECTION("piecewise_linear_distribution") { compare(units::piecewise_linear_distribution<qf>(bounds_qty, weights), std::piecewise_linear_distribution<double>(bounds.begin(), bounds.end(), weights.begin())); }
+  // clang-format on
+}
+
+TEST_CASE("piecewise distribution construction", "[distribution]")
+{
+  constexpr std::size_t intervals = 10'000;
+  std::vector<double> bounds(intervals + 1);
+  std::vector<qf> bounds_qty(intervals + 1);
+  std::vector<double> weights(intervals + 1);
+  for (std::size_t i = 0; i <= intervals; ++i) {
+    bounds[i] = static_cast<double>(i);
+    bounds_qty[i] = qf(static_cast<double>(i));
+    weights[i] = static_cast<double>(i % 10 + 1);
+  }
+
+  SECTION("piecewise_constant_distribution") {
+    BENCHMARK("std::") { return std::piecewise_constant_distribution<double>(bounds.begin(), bounds.end(), weights.begin()); };
+    BENCHMARK("units:: iterators") {
+      return units::piecewise_constant_distribution<qf>(bounds_qty.cbegin(), bounds_qty.cend(), weights.cbegin());
+    };
+    BENCHMARK("units:: span") { return units::piecewise_constant_distribution<qf>(bounds_qty, weights); };
+  }
+
+  SECTION("piecewise_linear_distribution") {
+    BENCHMARK("std::") { return std::piecewise_linear_distribution<double>(bounds.begin(), bounds.end(), weights.begin()); };
+    BENCHMARK("units:: iterators") {
+      return units::piecewise_linear_distribution<qf>(bounds_qty.cbegin(), bounds_qty.cend(), weights.cbegin());
+    };
+    BENCHMARK("units:: span") { return units::piecewise_linear_distribution<qf>(bounds_qty, weights); };
+  }
+}
+
+TEST_CASE("distribution multi-threaded scaling", "[distribution][threads]")
+{
+  // the same total amount of samples split among threads, each with its own stream of the engine
+  constexpr std::size_t total = 4'000'000;
+  std::vector<qf> out(total);
+  const philox4x32 root;
+
+  const auto run = [&](std::size_t threads) {
+    const std::size_t chunk = total / threads;
+    std::vector<std::jthread> workers;
+    workers.reserve(threads);
+    for (std::size_t t = 0; t < threads; ++t) {
+      workers.emplace_back([&, t] {
+        philox4x32 gen = root.split(t);
+        auto dist = units::normal_distribution(qf(0.), qf(1.));
+        dist.generate(gen, std::span(out).subspan(t * chunk, chunk));
+      });
+    }
+  };
+
+  const std::size_t max_threads = std::max<std::size_t>(4, std::thread::hardware_concurrency());
+  for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+    BENCHMARK(std::to_string(threads) + " thread(s)") {
+      run(threads);
+      return out.back();
+    };
+  }
+}
@@ -0,0 +1,81 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/bits/external/hacks.h>
+
+#if UNITS_HAS_FLOAT16
+
+#include <units/algorithm.h>
+#include <units/isq/si/length.h>
+#include <catch2/catch.hpp>
+#include <cstddef>
+#include <vector>
+
+using namespace units;
+using namespace units::isq::si;
+
+namespace {
+
+constexpr std::size_t size = 1'000'000;
+
+template<Representation Rep>
+std::vector<length<kilometre, Rep>> make_column()
+{
+  std::vector<length<kilometre, Rep>> column(size);
+  for (std::size_t i = 0; i < size; ++i)
+    column[i] = length<kilometre, Rep>(static_cast<Rep>(static_cast<float>(i % 1000) / 8.f));
+  return column;
+}
+
+}  // namespace
+
+TEST_CASE("half-precision storage vs single-precision storage", "[half_precision]")
+{
+  const auto half_column = make_column<_Float16>();
+  const auto float_column = make_column<float>();
+
+  SECTION("memory") {
+    CHECK(sizeof(half_column[0]) * 2 == sizeof(float_column[0]));
+  }
+
+  SECTION("bulk_cast") {
+    std::vector<length<metre, float>> out(size);
+
+    BENCHMARK("_Float16 km -> float m") {
+      bulk_cast(half_column, out);
+      return out.back();
+    };
+    BENCHMARK("float km -> float m") {
+      bulk_cast(float_column, out);
+      return out.back();
+    };
+  }
+
+  SECTION("bulk_sum") {
+    REQUIRE(bulk_sum(half_column) == bulk_sum(float_column));
+
+    BENCHMARK("_Float16 storage, float accumulation") { return bulk_sum(half_column); };
+    BENCHMARK("float storage, float accumulation") { return bulk_sum(float_column); };
+  }
+}
+
+#endif  // UNITS_HAS_FLOAT16
@@ -0,0 +1,90 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/isq/si/length.h>
+#include <units/isq/si/speed.h>
+#include <units/isq/si/time.h>
+#include <units/mixed.h>
+#include <catch2/catch.hpp>
+#include <cstddef>
+#include <vector>
+
+using namespace units;
+using namespace units::isq::si;
+
+namespace {
+
+constexpr std::size_t size = 1'000'000;
+
+// structure of arrays of particles moving along one axis
+template<Representation Rep>
+struct particles {
+  std::vector<length<metre, Rep>> position;
+  std::vector<speed<metre_per_second, Rep>> velocity;
+
+  particles() : position(size), velocity(size)
+  {
+    for (std::size_t i = 0; i < size; ++i) {
+      position[i] = length<metre, Rep>(1e6f + static_cast<float>(i % 1024));
+      velocity[i] = speed<metre_per_second, Rep>(static_cast<float>(i % 7) - 3.f);
+    }
+  }
+
+  void step(isq::si::time<second, Rep> dt)
+  {
+    for (std::size_t i = 0; i < size; ++i) position[i] = position[i] + velocity[i] * dt;
+  }
+
+  // cancellation-prone: a sum of small differences of big values
+  [[nodiscard]] length<metre, double> spread() const
+  {
+    auto result = length<metre, double>::zero();
+    for (std::size_t i = 1; i < size; ++i) result += quantity_cast<length<metre, double>>(position[i] - position[i - 1]);
+    return result;
+  }
+};
+
+}  // namespace
+
+TEST_CASE("mixed<float, double> vs float and double storage", "[mixed]")
+{
+  particles<float> f;
+  particles<double> d;
+  particles<mixed<float, double>> m;
+
+  SECTION("memory") {
+    CHECK(sizeof(m.position[0]) == sizeof(f.position[0]));
+    CHECK(2 * sizeof(m.position[0]) == sizeof(d.position[0]));
+  }
+
+  SECTION("step") {
+    BENCHMARK("float") { f.step(isq::si::time<second, float>(0.001f)); };
+    BENCHMARK("double") { d.step(isq::si::time<second, double>(0.001)); };
+    BENCHMARK("mixed<float, double>") { m.step(isq::si::time<second, mixed<float, double>>(0.001f)); };
+  }
+
+  SECTION("spread") {
+    BENCHMARK("float") { return f.spread(); };
+    BENCHMARK("double") { return d.spread(); };
+    BENCHMARK("mixed<float, double>") { return m.spread(); };
+  }
+}
@@ -0,0 +1,84 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/ode.h>
+#include <units/isq/si/acceleration.h>
+#include <units/isq/si/frequency.h>
+#include <units/isq/si/length.h>
+#include <units/isq/si/speed.h>
+#include <units/isq/si/time.h>
+#include <catch2/catch.hpp>
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+using namespace units;
+using namespace units::isq;
+
+namespace {
+
+constexpr std::size_t size = 100'000;
+
+using duration = si::time<si::second>;
+using position = si::length<si::metre>;
+using velocity = si::speed<si::metre_per_second>;
+using acceleration = si::acceleration<si::metre_per_second_sq>;
+
+constexpr double omega = 2.;
+
+// hand-rolled RK4 step of x'' = -w^2 x on raw numbers
+void raw_rk4(std::vector<double>& x, std::vector<double>& v, double h)
+{
+  constexpr double w2 = omega * omega;
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    const double x1 = x[i], v1 = v[i], a1 = -w2 * x1;
+    const double x2 = x1 + h / 2 * v1, v2 = v1 + h / 2 * a1, a2 = -w2 * x2;
+    const double x3 = x1 + h / 2 * v2, v3 = v1 + h / 2 * a2, a3 = -w2 * x3;
+    const double x4 = x1 + h * v3, v4 = v1 + h * a3, a4 = -w2 * x4;
+    x[i] = x1 + h / 6 * (v1 + 2 * v2 + 2 * v3 + v4);
+    v[i] = v1 + h / 6 * (a1 + 2 * a2 + 2 * a3 + a4);
+  }
+}
+
+}  // namespace
+
+TEST_CASE("batch ODE integration", "[ode]")
+{
+  const auto spring = ode::chain([](const duration&, const std::tuple<position, velocity>& y) -> acceleration {
+    constexpr auto w2 = si::frequency<si::hertz>(omega) * si::frequency<si::hertz>(omega);
+    return -w2 * std::get<0>(y);
+  });
+
+  std::vector<double> raw_x(size, 1.), raw_v(size, 0.);
+  std::vector<position> x(size, position(1.));
+  std::vector<velocity> v(size, velocity(0.));
+  const duration h(0.001);
+
+  BENCHMARK("hand-rolled RK4 on raw numbers") {
+    raw_rk4(raw_x, raw_v, h.number());
+    return raw_x.back();
+  };
+  BENCHMARK("ode::step_all<ode::rk4>") {
+    ode::step_all<ode::rk4>(spring, duration(0.), h, x, v);
+    return x.back();
+  };
+}
@@ -0,0 +1,75 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/isq/si/length.h>
+#include <units/optional_quantity.h>
+#include <catch2/catch.hpp>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+using namespace units;
+using namespace units::isq::si;
+
+namespace {
+
+constexpr std::size_t size = 1'000'000;
+constexpr std::size_t stride = 10;  // every 10th sample is present
+
+template<typename Optional>
+std::vector<Optional> make_sparse_column()
+{
+  std::vector<Optional> column(size);
+  for (std::size_t i = 0; i < size; i += stride) column[i] = length<metre>(static_cast<double>(i));
+  return column;
+}
+
+template<typename Optional>
+length<metre> sum(const std::vector<Optional>& column)
+{
+  auto result = length<metre>::zero();
+  for (const auto& v : column)
+    if (v) result += *v;
+  return result;
+}
+
+}  // namespace
+
+TEST_CASE("optional_quantity vs std::optional<quantity>", "[optional_quantity]")
+{
+  using compact = optional_quantity<length<metre>>;
+  using standard = std::optional<length<metre>>;
+
+  SECTION("memory") {
+    CHECK(sizeof(compact) == sizeof(double));
+    CHECK(sizeof(standard) == 2 * sizeof(double));
+  }
+
+  SECTION("scan") {
+    const auto c = make_sparse_column<compact>();
+    const auto s = make_sparse_column<standard>();
+    REQUIRE(sum(c) == sum(s));
+
+    BENCHMARK("optional_quantity") { return sum(c); };
+    BENCHMARK("std::optional") { return sum(s); };
+  }
+}
@@ -0,0 +1,87 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/isq/si/time.h>
+#include <units/overflow_checked.h>
+#include <catch2/catch.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using namespace units;
+using namespace units::isq::si;
+
+namespace {
+
+constexpr std::size_t size = 1'000'000;
+
+template<Representation Rep>
+std::vector<isq::si::time<millisecond, Rep>> make_column()
+{
+  std::vector<isq::si::time<millisecond, Rep>> column(size);
+  for (std::size_t i = 0; i < size; ++i) column[i] = isq::si::time<millisecond, Rep>(static_cast<std::int32_t>(i % 86'400'000));
+  return column;
+}
+
+template<Representation Rep>
+auto sum(const std::vector<isq::si::time<millisecond, Rep>>& column)
+{
+  auto result = isq::si::time<millisecond, Rep>::zero();
+  for (const auto& v : column) result += v;
+  return result;
+}
+
+template<Representation To, Representation From>
+void to_nanoseconds(const std::vector<isq::si::time<millisecond, From>>& in, std::vector<isq::si::time<nanosecond, To>>& out)
+{
+  for (std::size_t i = 0; i < size; ++i) out[i] = quantity_cast<isq::si::time<nanosecond, To>>(in[i]);
+}
+
+}  // namespace
+
+TEST_CASE("checked and saturating integers vs std::int64_t", "[overflow_checked]")
+{
+  const auto plain = make_column<std::int64_t>();
+  const auto chk = make_column<checked<std::int64_t>>();
+  const auto sat = make_column<saturating<std::int64_t>>();
+  const auto chk32 = make_column<checked<std::int32_t>>();
+
+  SECTION("sum") {
+    REQUIRE(sum(chk).number() == sum(plain).number());
+
+    BENCHMARK("std::int64_t") { return sum(plain); };
+    BENCHMARK("checked<std::int64_t>") { return sum(chk); };
+    BENCHMARK("saturating<std::int64_t>") { return sum(sat); };
+  }
+
+  SECTION("ms -> ns") {
+    std::vector<isq::si::time<nanosecond, std::int64_t>> plain_out(size);
+    std::vector<isq::si::time<nanosecond, checked<std::int64_t>>> chk_out(size);
+    std::vector<isq::si::time<nanosecond, saturating<std::int64_t>>> sat_out(size);
+
+    BENCHMARK("std::int64_t") { to_nanoseconds(plain, plain_out); };
+    BENCHMARK("checked<std::int64_t>") { to_nanoseconds(chk, chk_out); };
+    BENCHMARK("saturating<std::int64_t>") { to_nanoseconds(sat, sat_out); };
+    // the range of std::int32_t scaled by 10^6 always fits in std::int64_t so the checks are elided
+    BENCHMARK("checked<std::int32_t> -> checked<std::int64_t>") { to_nanoseconds(chk32, chk_out); };
+  }
+}
@@ -0,0 +1,111 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/isq/si/length.h>
+#include <units/isq/si/time.h>
+#include <units/parallel_random.h>
+#include <units/random.h>
+#include <catch2/catch.hpp>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+using namespace units;
+using namespace units::isq::si;
+
+namespace {
+
+constexpr std::size_t samples = 1'000'000;
+
+using q = length<metre, double>;
+
+}  // namespace
+
+TEST_CASE("philox4x32 kernels vs std distributions", "[parallel_random]")
+{
+  std::mt19937_64 mt;
+  philox4x32 philox;
+  std::vector<q> out(samples);
+
+  SECTION("engine") {
+    std::vector<philox4x32::result_type> bits(samples);
+
+    BENCHMARK("std::mt19937") {
+      std::mt19937 mt32;
+      for (auto& b : bits) b = static_cast<philox4x32::result_type>(mt32());
+      return bits.back();
+    };
+    BENCHMARK("philox4x32::operator()") {
+      for (auto& b : bits) b = philox();
+      return bits.back();
+    };
+    BENCHMARK("philox4x32::fill()") {
+      philox.fill(bits);
+      return bits.back();
+    };
+  }
+
+  SECTION("uniform") {
+    auto dist = units::uniform_real_distribution(q(0.), q(1.));
+
+    BENCHMARK("std::mt19937_64 + uniform_real_distribution") {
+      dist.generate(mt, out);
+      return out.back();
+    };
+    BENCHMARK("philox4x32 + generate_uniform()") {
+      generate_uniform(philox, std::span(out), q(0.), q(1.));
+      return out.back();
+    };
+  }
+
+  SECTION("normal") {
+    auto dist = units::normal_distribution(q(0.), q(1.));
+
+    BENCHMARK("std::mt19937_64 + normal_distribution") {
+      dist.generate(mt, out);
+      return out.back();
+    };
+    BENCHMARK("std::mt19937_64 + generate_normal()") {
+      generate_normal(mt, std::span(out), q(0.), q(1.));
+      return out.back();
+    };
+    BENCHMARK("philox4x32 + generate_normal()") {
+      generate_normal(philox, std::span(out), q(0.), q(1.));
+      return out.back();
+    };
+  }
+
+  SECTION("exponential") {
+    using t = isq::si::time<second, double>;
+    std::vector<t> times(samples);
+    auto dist = units::exponential_distribution<t>(1.);
+
+    BENCHMARK("std::mt19937_64 + exponential_distribution") {
+      dist.generate(mt, times);
+      return times.back();
+    };
+    BENCHMARK("philox4x32 + generate_exponential()") {
+      generate_exponential(philox, std::span(times), t(1.));
+      return times.back();
+    };
+  }
+}
@@ -0,0 +1,71 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/isq/si/length.h>
+#include <units/random.h>
+#include <catch2/catch.hpp>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+using namespace units;
+using namespace units::isq::si;
+
+namespace {
+
+constexpr std::size_t samples = 1'000'000;
+
+using q = length<metre, double>;
+
+}  // namespace
+
+TEST_CASE("bulk sample generation", "[random]")
+{
+  std::mt19937_64 gen;
+  std::vector<q> out(samples);
+
+  SECTION("normal_distribution") {
+    auto dist = units::normal_distribution(q(0.), q(1.));
+
+    BENCHMARK("operator()") {
+      for (q& v : out) v = dist(gen);
+      return out.back();
+    };
+    BENCHMARK("generate()") {
+      dist.generate(gen, out);
+      return out.back();
+    };
+  }
+
+  SECTION("uniform_real_distribution") {
+    auto dist = units::uniform_real_distribution(q(0.), q(1.));
+
+    BENCHMARK("operator()") {
+      for (q& v : out) v = dist(gen);
+      return out.back();
+    };
+    BENCHMARK("generate()") {
+      dist.generate(gen, out);
+      return out.back();
+    };
+  }
+}
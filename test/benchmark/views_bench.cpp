@@ -0,0 +1,73 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/views.h>
+#include <units/isq/si/length.h>
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+using namespace units;
+using namespace units::isq::si;
+
+namespace {
+
+constexpr std::size_t size = 1'000'000;
+
+// stands for an API expecting raw numbers in metres
+double sum_metres(const std::vector<double>& metres) { return std::accumulate(metres.begin(), metres.end(), 0.); }
+
+}  // namespace
+
+TEST_CASE("lazy unit conversion views vs converted copies", "[views]")
+{
+  std::vector<length<kilometre>> distances(size);
+  for (std::size_t i = 0; i < size; ++i) distances[i] = length<kilometre>(static_cast<double>(i % 1000) / 8.);
+  std::vector<double> out(size);
+
+  SECTION("copy into an existing buffer") {
+    BENCHMARK("std::ranges::transform + quantity_cast") {
+      std::ranges::transform(distances, out.begin(), [](const auto& d) { return quantity_cast<metre>(d).number(); });
+      return out.back();
+    };
+    BENCHMARK("std::ranges::copy of views::as_unit | views::numbers") {
+      std::ranges::copy(distances | views::as_unit<metre> | views::numbers, out.begin());
+      return out.back();
+    };
+  }
+
+  SECTION("feeding an API expecting metres") {
+    BENCHMARK("temporary vector of metres") {
+      std::vector<length<metre>> metres(distances.size());
+      std::ranges::transform(distances, metres.begin(), [](const auto& d) { return quantity_cast<metre>(d); });
+      std::vector<double> numbers(metres.size());
+      std::ranges::transform(metres, numbers.begin(), [](const auto& m) { return m.number(); });
+      return sum_metres(numbers);
+    };
+    BENCHMARK("lazy view") {
+      auto metres = distances | views::as_unit<metre> | views::numbers;
+      return std::accumulate(metres.begin(), metres.end(), 0.);
+    };
+  }
+}
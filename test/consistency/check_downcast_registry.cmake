@@ -0,0 +1,141 @@
+# The MIT License (MIT)
+#
+# Copyright (c) 2018 Mateusz Pusz
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+#
+# cmake -DINCLUDE_DIRS=<dir>,... -P check_downcast_registry.cmake
+#
+# Checks that every downcasting target defined in the headers of `INCLUDE_DIRS` is registered with
+# `UNITS_DOWNCAST_REGISTER` in the header that defines it, as required by the `REGISTRY`
+# downcasting mode, and that it passes itself as the downcasting target to its base. The class templates deriving (directly or through other class templates) from
+# `downcast_dispatch` with the default downcasting mode are found first, and then every class
+# deriving from one of them is a target. The library does not indent namespace bodies, so only the
+# definitions starting in the first column are taken into account.
+#
+
+cmake_minimum_required(VERSION 3.15)
+
+if(NOT INCLUDE_DIRS)
+    message(FATAL_ERROR "'INCLUDE_DIRS' not provided")
+endif()
+
+string(REPLACE "," ";" INCLUDE_DIRS "${INCLUDE_DIRS}")
+set(headers)
+foreach(dir IN LISTS INCLUDE_DIRS)
+    file(GLOB_RECURSE dir_headers ${dir}/*.h)
+    list(APPEND headers ${dir_headers})
+endforeach()
+
+# `<header>|<template>|<name>|<base>|<argument>` entries of all the classes derived from a class
+# template; `<template>` is TRUE for the class templates and `<argument>` is the first template
+# argument of the base (the downcasting target of the classes derived from `downcast_dispatch`)
+set(classes)
+foreach(header IN LISTS headers)
+    # semicolons and square brackets cannot be a part of a CMake list
+    file(READ ${header} content)
+    string(REPLACE ";" "<semicolon>" content "${content}")
+    string(REPLACE "[" "<lbracket>" content "${content}")
+    string(REPLACE "]" "<rbracket>" content "${content}")
+    string(REPLACE "\n" ";" lines "${content}")
+    set(template FALSE)
+    set(name)
+    foreach(line IN LISTS lines)
+        if(name)
+            # the base class of `struct <name> :` on the next line
+            set(line "struct ${name} : ${line}")
+            set(name)
+        endif()
+        if(line MATCHES "^(template *<.*> )?struct ([A-Za-z_][A-Za-z_0-9]*)(<[^:]*>)? *:(.*)$")
+            if(CMAKE_MATCH_1)
+                set(template TRUE)
+            endif()
+            set(name ${CMAKE_MATCH_2})
+            set(bases "${CMAKE_MATCH_4}")
+            if(bases MATCHES "^ *$")
+                continue()
+            endif()
+            if(bases MATCHES "^ *(public )?([A-Za-z_:]*::)?([A-Za-z_][A-Za-z_0-9]*)<(.*)$")
+                set(base ${CMAKE_MATCH_3})
+                set(arguments "${CMAKE_MATCH_4}")
+                set(argument)
+                if(arguments MATCHES "^ *([A-Za-z_0-9:]+)")
+                    set(argument ${CMAKE_MATCH_1})
+                endif()
+                if(base STREQUAL "downcast_dispatch" AND arguments MATCHES "downcast_mode::")
+                    set(base)
+                endif()
+                if(base)
+                    list(APPEND classes "${header}|${template}|${name}|${base}|${argument}")
+                endif()
+            endif()
+            set(template FALSE)
+            set(name)
+        elseif(line MATCHES "^template *<")
+            set(template TRUE)
+        elseif(line MATCHES "^[^ ]")
+            set(template FALSE)
+        endif()
+    endforeach()
+endforeach()
+
+# class templates providing downcasting
+set(downcasting downcast_dispatch)
+set(found TRUE)
+while(found)
+    set(found FALSE)
+    foreach(entry IN LISTS classes)
+        string(REPLACE "|" ";" entry "${entry}")
+        list(GET entry 1 template)
+        list(GET entry 2 name)
+        list(GET entry 3 base)
+        list(FIND downcasting ${name} name_index)
+        list(FIND downcasting ${base} base_index)
+        if(template AND name_index EQUAL -1 AND NOT base_index EQUAL -1)
+            list(APPEND downcasting ${name})
+            set(found TRUE)
+        endif()
+    endforeach()
+endwhile()
+
+set(missing)
+foreach(entry IN LISTS classes)
+    string(REPLACE "|" ";" entry "${entry}")
+    list(GET entry 0 header)
+    list(GET entry 1 template)
+    list(GET entry 2 name)
+    list(GET entry 3 base)
+    list(GET entry 4 argument)
+    list(FIND downcasting ${base} index)
+    if(NOT template AND NOT index EQUAL -1)
+        if(NOT argument STREQUAL name)
+            list(APPEND missing "${name} (${header}) downcasts to ${argument}")
+        endif()
+        file(STRINGS ${header} registrations REGEX "^UNITS_DOWNCAST_REGISTER\\(([A-Za-z_0-9]*::)*${name}\\)")
+        if(NOT registrations)
+            list(APPEND missing "${name} (${header}) not registered")
+        endif()
+    endif()
+endforeach()
+
+if(missing)
+    list(JOIN missing "\n  " missing)
+    message(FATAL_ERROR "Downcasting targets not consistent with the registry:\n  ${missing}")
+endif()
@@ -0,0 +1,106 @@
+# The MIT License (MIT)
+#
+# Copyright (c) 2018 Mateusz Pusz
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+#
+# cmake -DFORWARD_HEADER=<fwd.h> -P check_forward_declarations.cmake
+#
+# Checks that the forward-declaration header of a system declares exactly the classes defined in
+# the headers of its directory that include it. The declarations of every header are grouped
+# after a `// <header>` comment and the dimensions declared there need their quantity alias
+# templates. The library does not indent namespace bodies, so only the definitions starting in the
+# first column are taken into account.
+#
+
+cmake_minimum_required(VERSION 3.15)
+
+if(NOT FORWARD_HEADER)
+    message(FATAL_ERROR "'FORWARD_HEADER' not provided")
+endif()
+
+function(read_lines file result)
+    # semicolons and square brackets cannot be a part of a CMake list
+    file(READ ${file} content)
+    string(REPLACE ";" "<semicolon>" content "${content}")
+    string(REPLACE "[" "<lbracket>" content "${content}")
+    string(REPLACE "]" "<rbracket>" content "${content}")
+    string(REPLACE "\n" ";" lines "${content}")
+    set(${result} "${lines}" PARENT_SCOPE)
+endfunction()
+
+# `<header>:<name>` entries of the forward declarations and of the quantity alias templates
+read_lines(${FORWARD_HEADER} lines)
+set(declared)
+set(aliased)
+set(section)
+foreach(line IN LISTS lines)
+    if(line MATCHES "^// ([A-Za-z_0-9]+\\.h)$")
+        set(section ${CMAKE_MATCH_1})
+    elseif(line MATCHES "^struct ([A-Za-z_][A-Za-z_0-9]*)<semicolon>$")
+        list(APPEND declared "${section}:${CMAKE_MATCH_1}")
+    elseif(line MATCHES "^using [A-Za-z_][A-Za-z_0-9]* = quantity<([A-Za-z_][A-Za-z_0-9]*),")
+        list(APPEND aliased "${section}:${CMAKE_MATCH_1}")
+    endif()
+endforeach()
+
+# `<header>:<name>` entries of the definitions
+get_filename_component(dir ${FORWARD_HEADER} DIRECTORY)
+get_filename_component(forward_name ${FORWARD_HEADER} NAME)
+string(REGEX REPLACE "^.*/include/" "" forward_include "${FORWARD_HEADER}")
+file(GLOB headers ${dir}/*.h)
+set(defined)
+set(errors)
+foreach(header IN LISTS headers)
+    get_filename_component(file ${header} NAME)
+    file(STRINGS ${header} includes REGEX "^#include <${forward_include}>")
+    if(file STREQUAL forward_name OR NOT includes)
+        continue()
+    endif()
+    read_lines(${header} lines)
+    foreach(line IN LISTS lines)
+        if(line MATCHES "^struct ([A-Za-z_][A-Za-z_0-9]*) *:")
+            set(name ${CMAKE_MATCH_1})
+            list(APPEND defined "${file}:${name}")
+            list(FIND declared "${file}:${name}" index)
+            if(index EQUAL -1)
+                list(APPEND errors "${name} (${file}) not declared")
+            elseif(name MATCHES "^dim_")
+                list(FIND aliased "${file}:${name}" index)
+                if(index EQUAL -1)
+                    list(APPEND errors "${name} (${file}) has no quantity alias template")
+                endif()
+            endif()
+        endif()
+    endforeach()
+endforeach()
+
+foreach(entry IN LISTS declared)
+    list(FIND defined "${entry}" index)
+    if(index EQUAL -1)
+        string(REPLACE ":" " " entry "${entry}")
+        list(APPEND errors "declared but not defined: ${entry}")
+    endif()
+endforeach()
+
+if(errors)
+    list(JOIN errors "\n  " errors)
+    message(FATAL_ERROR "Forward declarations of ${FORWARD_HEADER} are not consistent:\n  ${errors}")
+endif()
@@ -58,10 +58,10 @@ namespace units {
     {
       constexpr std::uintmax_t c = std::uintmax_t(1) << (sizeof(std::intmax_t) * 4);
 
-      const std::uintmax_t a0 = detail::abs(lhs) % c;
-      const std::uintmax_t a1 = detail::abs(lhs) / c;
-      const std::uintmax_t b0 = detail::abs(rhs) % c;
-      const std::uintmax_t b1 = detail::abs(rhs) / c;
+      const std::uintmax_t a0 = static_cast<std::uintmax_t>(detail::abs(lhs)) % c;
+      const std::uintmax_t a1 = static_cast<std::uintmax_t>(detail::abs(lhs)) / c;
+      const std::uintmax_t b0 = static_cast<std::uintmax_t>(detail::abs(rhs)) % c;
+      const std::uintmax_t b1 = static_cast<std::uintmax_t>(detail::abs(rhs)) / c;
 
       Expects(a1 == 0 || b1 == 0); //  overflow in multiplication
       Expects(a0 * b1 + b0 * a1 < (c >> 1)); // overflow in multiplication
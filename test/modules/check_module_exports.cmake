@@ -0,0 +1,122 @@
+# The MIT License (MIT)
+#
+# Copyright (c) 2018 Mateusz Pusz
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+#
+# cmake -DMODULE_INTERFACE=<file.cppm> -DINCLUDE_DIR=<dir> [-DEXCLUDE=<name|header>,...]
+#       -P check_module_exports.cmake
+#
+# Checks that a module interface unit exports every public name declared at a namespace scope of
+# the headers it includes from `INCLUDE_DIR` (and of the headers they include from there). The
+# library does not indent namespace bodies, so only the definitions of classes, concepts, aliases,
+# variables, functions, and user-defined literals starting in the first column are taken into
+# account. Names from `detail` namespaces, names ending with `_`, and the names and headers listed
+# in `EXCLUDE` are skipped.
+#
+
+cmake_minimum_required(VERSION 3.15)
+
+foreach(var MODULE_INTERFACE INCLUDE_DIR)
+    if(NOT ${var})
+        message(FATAL_ERROR "'${var}' not provided")
+    endif()
+endforeach()
+
+function(get_includes file result)
+    file(STRINGS ${file} lines REGEX "^#include <units/")
+    set(headers)
+    foreach(line IN LISTS lines)
+        string(REGEX REPLACE "^#include <([^>]+)>.*$" "\\1" header "${line}")
+        if(EXISTS ${INCLUDE_DIR}/${header})
+            list(APPEND headers ${INCLUDE_DIR}/${header})
+        endif()
+    endforeach()
+    set(${result} ${headers} PARENT_SCOPE)
+endfunction()
+
+# headers of `INCLUDE_DIR` reachable from the module interface unit
+get_includes(${MODULE_INTERFACE} todo)
+set(headers)
+while(todo)
+    list(POP_FRONT todo header)
+    list(FIND headers ${header} index)
+    if(index EQUAL -1)
+        list(APPEND headers ${header})
+        get_includes(${header} includes)
+        list(APPEND todo ${includes})
+    endif()
+endwhile()
+
+string(REPLACE "," ";" EXCLUDE "${EXCLUDE}")
+
+# the name is always the last capture group
+set(name_regexes
+    "^struct ([A-Za-z_][A-Za-z_0-9]*)[ :]"
+    "^(template<.*> )?concept ([A-Za-z_][A-Za-z_0-9]*) ="
+    "^(template<.*> )?using ([A-Za-z_][A-Za-z_0-9]*) ="
+    "^(inline )?constexpr [^=(]* ([A-Za-z_][A-Za-z_0-9]*) ="
+    "^constexpr auto operator\"\" *(_[A-Za-z_0-9]*)\\("
+    "^(<lbracket><lbracket>nodiscard<rbracket><rbracket> )?(inline |constexpr |consteval |static )*[A-Za-z_][^=(]* ([a-z_][A-Za-z_0-9]*)\\("
+)
+
+file(READ ${MODULE_INTERFACE} exports)
+set(missing)
+foreach(header IN LISTS headers)
+    file(RELATIVE_PATH file ${INCLUDE_DIR} ${header})
+    list(FIND EXCLUDE ${file} index)
+    if(NOT index EQUAL -1)
+        continue()
+    endif()
+
+    # semicolons and square brackets cannot be a part of a CMake list
+    file(READ ${header} content)
+    string(REPLACE ";" "<semicolon>" content "${content}")
+    string(REPLACE "[" "<lbracket>" content "${content}")
+    string(REPLACE "]" "<rbracket>" content "${content}")
+    string(REPLACE "\n" ";" lines "${content}")
+    set(in_detail FALSE)
+    foreach(line IN LISTS lines)
+        if(line MATCHES "^namespace ([A-Za-z_0-9]+::)*detail {")
+            set(in_detail TRUE)
+        elseif(line MATCHES "^}.*// namespace ([A-Za-z_0-9]+::)*detail$")
+            set(in_detail FALSE)
+        elseif(NOT in_detail)
+            foreach(regex IN LISTS name_regexes)
+                if(line MATCHES "${regex}")
+                    set(name "${CMAKE_MATCH_${CMAKE_MATCH_COUNT}}")
+                    string(FIND "${exports}" "::${name};" pos)
+                    string(FIND "${exports}" "\"\"${name};" literal_pos)
+                    list(FIND EXCLUDE ${name} index)
+                    if(pos EQUAL -1 AND literal_pos EQUAL -1 AND index EQUAL -1 AND NOT name MATCHES "_$")
+                        list(APPEND missing "${name} (${file})")
+                    endif()
+                    break()
+                endif()
+            endforeach()
+        endif()
+    endforeach()
+endforeach()
+
+if(missing)
+    list(REMOVE_DUPLICATES missing)
+    list(JOIN missing "\n  " missing)
+    message(FATAL_ERROR "Names not exported from ${MODULE_INTERFACE}:\n  ${missing}")
+endif()
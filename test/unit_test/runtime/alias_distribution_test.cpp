@@ -0,0 +1,92 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/alias_distribution.h>
+#include <units/isq/iec80000/storage_capacity.h>
+#include <units/isq/si/time.h>
+#include <catch2/catch.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using namespace units;
+using namespace units::isq;
+
+TEST_CASE("alias_distribution", "[alias_distribution]")
+{
+  using size = iec80000::storage_capacity<iec80000::byte, std::int64_t>;
+  using latency = si::time<si::millisecond, double>;
+  constexpr std::size_t count = 400'000;
+  philox4x32 gen(123);
+
+  SECTION("default") {
+    auto dist = alias_distribution<size>();
+    CHECK(dist.size() == 1);
+    CHECK(dist(gen) == size::zero());
+  }
+
+  SECTION("probabilities are preserved by the alias tables") {
+    const std::vector<double> weights = {1, 0, 3, 4, 12, 0.5, 2, 7.5};
+    std::vector<size> values;
+    for (std::size_t i = 0; i < weights.size(); ++i) values.push_back(size(static_cast<std::int64_t>(512 << i)));
+    const auto dist = alias_distribution<size>(values, weights);
+
+    const auto p = dist.probabilities();
+    REQUIRE(p.size() == weights.size());
+    for (std::size_t i = 0; i < weights.size(); ++i) CHECK(p[i] == Approx(weights[i] / 30.).margin(1e-9));
+    CHECK(dist.min() == size(512));
+    CHECK(dist.max() == size(512 << 7));
+  }
+
+  SECTION("sampled frequencies match the weights") {
+    const auto dist = alias_distribution<size>({size(1), size(2), size(3)}, {1., 2., 7.});
+    std::vector<size> out(count);
+    dist.generate(gen, out);
+    std::vector<std::size_t> hits(3);
+    for (const size& s : out) ++hits[static_cast<std::size_t>(s.number() - 1)];
+    CHECK(static_cast<double>(hits[0]) / count == Approx(0.1).epsilon(0.03));
+    CHECK(static_cast<double>(hits[1]) / count == Approx(0.2).epsilon(0.03));
+    CHECK(static_cast<double>(hits[2]) / count == Approx(0.7).epsilon(0.03));
+  }
+
+  SECTION("histogram bins") {
+    const std::vector<latency> bounds = {latency(0.), latency(1.), latency(10.), latency(100.)};
+    const std::vector<double> weights = {5., 4., 1.};
+    const auto dist = alias_distribution<latency>(histogram_bins, bounds, weights);
+    CHECK(dist.min() == latency(0.));
+    CHECK(dist.max() == latency(100.));
+
+    std::vector<latency> out(count);
+    dist.generate(gen, out);
+    std::vector<std::size_t> hits(3);
+    double sum = 0;
+    for (const latency& l : out) {
+      REQUIRE((l >= latency(0.) && l < latency(100.)));
+      ++hits[l < latency(1.) ? 0 : l < latency(10.) ? 1 : 2];
+      sum += l.number();
+    }
+    CHECK(static_cast<double>(hits[0]) / count == Approx(0.5).epsilon(0.02));
+    CHECK(static_cast<double>(hits[1]) / count == Approx(0.4).epsilon(0.02));
+    CHECK(static_cast<double>(hits[2]) / count == Approx(0.1).epsilon(0.03));
+    CHECK(sum / count == Approx(0.5 * 0.5 + 0.4 * 5.5 + 0.1 * 55.).epsilon(0.02));
+  }
+}
@@ -26,6 +26,7 @@
 #include <catch2/catch.hpp>
 #include <initializer_list>
 #include <random>
+#include <span>
 #include <vector>
 
 
@@ -530,6 +531,18 @@ TEST_CASE("piecewise_constant_distribution")
     CHECK(units_dist.densities() == stl_dist.densities());
   }
 
+  SECTION ("parametrized_span") {
+    const std::vector<rep> intervals_rep = {1.0, 2.0, 3.0};
+    const std::vector<q> intervals_qty = {1.0_q_m, 2.0_q_m, 3.0_q_m};
+    const std::vector<rep> weights = {1.0, 2.0};
+
+    auto stl_dist = std::piecewise_constant_distribution<rep>(intervals_rep.cbegin(), intervals_rep.cend(), weights.cbegin());
+    auto units_dist = units::piecewise_constant_distribution<q>(intervals_qty, weights);
+
+    CHECK(units_dist.intervals() == intervals_qty_vec);
+    CHECK(units_dist.densities() == stl_dist.densities());
+  }
+
   SECTION ("parametrized_initializer_list") {
     std::initializer_list<rep> intervals_rep = {1.0, 2.0, 3.0};
     std::initializer_list<q> intervals_qty = {1.0_q_m, 2.0_q_m, 3.0_q_m};
@@ -588,6 +601,18 @@ TEST_CASE("piecewise_linear_distribution")
     CHECK(units_dist.densities() == stl_dist.densities());
   }
 
+  SECTION ("parametrized_span") {
+    const std::vector<rep> intervals_rep = {1.0, 2.0, 3.0};
+    const std::vector<q> intervals_qty = {1.0_q_m, 2.0_q_m, 3.0_q_m};
+    const std::vector<rep> weights = {1.0, 2.0, 3.0};
+
+    auto stl_dist = std::piecewise_linear_distribution<rep>(intervals_rep.cbegin(), intervals_rep.cend(), weights.cbegin());
+    auto units_dist = units::piecewise_linear_distribution<q>(intervals_qty, weights);
+
+    CHECK(units_dist.intervals() == intervals_qty_vec);
+    CHECK(units_dist.densities() == stl_dist.densities());
+  }
+
   SECTION ("parametrized_initializer_list") {
     std::initializer_list<rep> intervals_rep = {1.0, 2.0, 3.0};
     std::initializer_list<q> intervals_qty = {1.0_q_m, 2.0_q_m, 3.0_q_m};
@@ -611,3 +636,45 @@ TEST_CASE("piecewise_linear_distribution")
     CHECK(units_dist.densities() == stl_dist.densities());
   }
 }
+
+TEST_CASE("generate")
+{
+  constexpr std::size_t count = 16;
+
+  SECTION("uniform_int_distribution") {
+    using q = length<metre, std::int64_t>;
+    std::mt19937 stl_gen, units_gen;
+    auto stl_dist = std::uniform_int_distribution<std::int64_t>(2, 5);
+    auto units_dist = units::uniform_int_distribution(q(2), q(5));
+
+    std::array<q, count> out;
+    units_dist.generate(units_gen, out);
+    for (const q& v : out) CHECK(v == q(stl_dist(stl_gen)));
+  }
+
+  SECTION("normal_distribution") {
+    using q = length<metre, double>;
+    std::mt19937 stl_gen, units_gen;
+    auto stl_dist = std::normal_distribution(5.0, 2.0);
+    auto units_dist = units::normal_distribution(q(5.0), q(2.0));
+
+    std::vector<q> out(count);
+    units_dist.generate(units_gen, out);
+    for (const q& v : out) CHECK(v == q(stl_dist(stl_gen)));
+  }
+
+  SECTION("piecewise_constant_distribution") {
+    using q = length<metre, double>;
+    const std::vector<double> intervals_rep = {1.0, 2.0, 3.0};
+    const std::vector<q> intervals_qty = {1.0_q_m, 2.0_q_m, 3.0_q_m};
+    const std::vector<double> weights = {1.0, 2.0};
+    std::mt19937 stl_gen, units_gen;
+    auto stl_dist = std::piecewise_constant_distribution<double>(intervals_rep.cbegin(), intervals_rep.cend(), weights.cbegin());
+    auto units_dist = units::piecewise_constant_distribution<q>(intervals_qty, weights);
+
+    std::vector<q> out(count);
+    units_dist.generate(units_gen, std::span(out).first(count / 2));
+    for (std::size_t i = 0; i < count / 2; ++i) CHECK(out[i] == q(stl_dist(stl_gen)));
+    for (std::size_t i = count / 2; i < count; ++i) CHECK(out[i] == q::zero());
+  }
+}
@@ -0,0 +1,49 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/isq/si/instantiations.h>
+#include <catch2/catch.hpp>
+#include <sstream>
+
+using namespace units;
+using namespace units::isq::si::references;
+
+// the quantities and their text output below are compiled against the explicit instantiations of
+// `mp-units::instantiations`
+
+TEST_CASE("explicitly instantiated quantities", "[instantiations]")
+{
+  const auto d = 10. * km;
+  const auto t = 2. * h;
+
+  SECTION("quantities") {
+    CHECK(d.number() == 10.);
+    CHECK((d / t).number() == 5.);
+  }
+
+  SECTION("text output") {
+    std::ostringstream os;
+    os << d / t;
+    CHECK(os.str() == "5 km/h");
+    CHECK(fmt::format("{}", d) == "10 km");
+  }
+}
@@ -0,0 +1,168 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/ode.h>
+#include <units/isq/si/acceleration.h>
+#include <units/isq/si/frequency.h>
+#include <units/isq/si/length.h>
+#include <units/isq/si/speed.h>
+#include <units/isq/si/time.h>
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+using namespace units;
+using namespace units::isq;
+
+namespace {
+
+using duration = si::time<si::second>;
+using position = si::length<si::metre>;
+using velocity = si::speed<si::metre_per_second>;
+using acceleration = si::acceleration<si::metre_per_second_sq>;
+using state = std::tuple<position, velocity>;
+
+static_assert(ode::are_derivatives<duration, position, velocity, acceleration>);
+static_assert(ode::are_derivatives<duration, position>);
+static_assert(!ode::are_derivatives<duration, position, acceleration>);
+static_assert(!ode::are_derivatives<duration, velocity, position>);
+static_assert(ode::State<ode::derivative<state, duration>>);
+static_assert(std::is_same_v<std::tuple_element_t<0, ode::derivative<state, duration>>::dimension, si::dim_speed>);
+static_assert(std::is_same_v<std::tuple_element_t<1, ode::derivative<state, duration>>::dimension, si::dim_acceleration>);
+
+// x'' = -w^2 x
+const auto spring = ode::chain([](const duration&, const state& y) -> acceleration {
+  constexpr auto omega = si::frequency<si::hertz>(1.);
+  return -omega * omega * std::get<0>(y);
+});
+
+static_assert(ode::SystemFunction<decltype(spring), state, duration>);
+static_assert(!ode::SystemFunction<decltype(spring), std::tuple<position, acceleration>, duration>);
+
+constexpr auto wrong_derivative = [](const duration&, const state& y) { return std::tuple(std::get<1>(y), std::get<1>(y)); };
+static_assert(!ode::SystemFunction<decltype(wrong_derivative), state, duration>);
+
+// analytical solution of the spring for x(0) = 1 m, v(0) = 0
+position exact(double t) { return position(std::cos(t)); }
+
+}  // namespace
+
+TEST_CASE("fixed step integrators", "[ode]")
+{
+  const state y0(position(1.), velocity(0.));
+  const duration t1(std::numbers::pi);
+
+  SECTION("euler") {
+    const auto y = ode::integrate<ode::euler>(spring, duration(0.), y0, t1, 100'000);
+    CHECK(std::get<0>(y).number() == Approx(exact(t1.number()).number()).epsilon(1e-3));
+  }
+
+  SECTION("rk4") {
+    const auto y = ode::integrate<ode::rk4>(spring, duration(0.), y0, t1, 100);
+    CHECK(std::get<0>(y).number() == Approx(-1.).epsilon(1e-7));
+    CHECK(std::get<1>(y).number() == Approx(0.).margin(1e-7));
+  }
+
+  SECTION("rk45 with a fixed step") {
+    const auto y = ode::integrate<ode::rk45>(spring, duration(0.), y0, t1, 100);
+    CHECK(std::get<0>(y).number() == Approx(-1.).epsilon(1e-10));
+  }
+
+  SECTION("error decreases with the order of the method") {
+    const auto err = [&]<typename Method>(Method) {
+      const auto y = ode::integrate<Method>(spring, duration(0.), y0, t1, 50);
+      return std::abs(std::get<0>(y).number() + 1.);
+    };
+    CHECK(err(ode::rk4{}) < err(ode::euler{}));
+    CHECK(err(ode::rk45{}) < err(ode::rk4{}));
+  }
+
+  SECTION("different units of the state and the independent variable") {
+    using km_state = std::tuple<si::length<si::kilometre>, si::speed<si::kilometre_per_hour>>;
+    const auto fall = ode::chain([](const si::time<si::minute>&, const km_state&) -> acceleration { return acceleration(-9.81); });
+    const auto y = ode::integrate<ode::rk4>(fall, si::time<si::minute>(0.), km_state(si::length<si::kilometre>(1.), {}),
+                                             si::time<si::minute>(0.1), 10);
+    CHECK(std::get<0>(y).number() == Approx(1. - 9.81 * 36. / 2. / 1000.));
+    CHECK(std::get<1>(y).number() == Approx(-9.81 * 6. * 3.6));
+  }
+}
+
+TEST_CASE("adaptive integrator", "[ode]")
+{
+  const state y0(position(1.), velocity(0.));
+  const state atol(position(1e-9), velocity(1e-9));
+
+  SECTION("meets the tolerance") {
+    const auto y = ode::integrate_adaptive(spring, duration(0.), y0, duration(10.), duration(1.), atol, 1e-9);
+    CHECK(std::get<0>(y).number() == Approx(exact(10.).number()).epsilon(1e-6));
+  }
+
+  SECTION("rejects too large steps") {
+    const auto result = ode::rk45::adaptive_step(spring, duration(0.), y0, duration(3.), atol, 1e-9);
+    CHECK(!result.accepted);
+    CHECK(std::get<0>(result.state) == std::get<0>(y0));
+    CHECK(result.next_step < duration(3.));
+  }
+
+  SECTION("proposes larger steps when the error is small") {
+    const auto result = ode::rk45::adaptive_step(spring, duration(0.), y0, duration(1e-3), atol, 1e-6);
+    CHECK(result.accepted);
+    CHECK(result.next_step > duration(1e-3));
+  }
+
+  const auto diverging = ode::chain([](const duration&, const state&) -> acceleration { return acceleration(std::nan("")); });
+
+  SECTION("rejects non-finite errors") {
+    const auto result = ode::rk45::adaptive_step(diverging, duration(0.), y0, duration(1.), atol, 1e-9);
+    CHECK(!result.accepted);
+    CHECK(std::get<0>(result.state) == std::get<0>(y0));
+    CHECK(result.next_step.number() == Approx(0.2));
+  }
+
+  SECTION("stops after the maximum number of steps") {
+    REQUIRE_THROWS_AS(ode::integrate_adaptive(diverging, duration(0.), y0, duration(10.), duration(1.), atol, 1e-9, 1'000),
+                      std::runtime_error);
+  }
+}
+
+TEST_CASE("batch integration", "[ode]")
+{
+  constexpr std::size_t size = 1'000;
+  std::vector<position> x(size);
+  std::vector<velocity> v(size);
+  for (std::size_t i = 0; i < size; ++i) x[i] = position(static_cast<double>(i) / size);
+
+  const duration h(0.01);
+  for (int i = 0; i < 100; ++i) ode::step_all<ode::rk4>(spring, duration(i * h.number()), h, x, v);
+
+  for (std::size_t i = 0; i < size; i += 100) {
+    const auto y = ode::integrate<ode::rk4>(spring, duration(0.), state(position(static_cast<double>(i) / size), velocity(0.)),
+                                            duration(1.), 100);
+    CHECK(x[i].number() == Approx(std::get<0>(y).number()));
+    CHECK(v[i].number() == Approx(std::get<1>(y).number()));
+  }
+}
@@ -0,0 +1,71 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/overflow_checked.h>
+#include <units/isq/si/length.h>
+#include <units/isq/si/time.h>
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+using namespace units;
+using namespace units::isq::si;
+
+TEST_CASE("'checked' arithmetic throws on overflow", "[overflow_checked][checked]")
+{
+  using c8 = checked<std::int8_t>;
+
+  SECTION ("in range results are returned unchanged") {
+    CHECK(c8(100) + c8(27) == 127);
+    CHECK(c8(-100) - c8(28) == -128);
+    CHECK(c8(-16) * c8(8) == -128);
+  }
+
+  SECTION ("overflowing operations throw 'std::overflow_error'") {
+    CHECK_THROWS_AS(c8(100) + c8(28), std::overflow_error);
+    CHECK_THROWS_AS(c8(-100) - c8(29), std::overflow_error);
+    CHECK_THROWS_AS(c8(16) * c8(8), std::overflow_error);
+    CHECK_THROWS_AS(c8(-128) / c8(-1), std::overflow_error);
+    CHECK_THROWS_AS(-c8(-128), std::overflow_error);
+    CHECK_THROWS_AS(c8(128), std::overflow_error);
+    CHECK_THROWS_AS(c8(128.), std::overflow_error);
+    CHECK_THROWS_AS(static_cast<std::int8_t>(checked<int>(128)), std::overflow_error);
+  }
+}
+
+TEST_CASE("'checked' quantity conversions throw on overflow", "[overflow_checked][checked]")
+{
+  using ns = isq::si::time<nanosecond, checked<std::int64_t>>;
+  using s = isq::si::time<second, checked<std::int64_t>>;
+
+  SECTION ("in range conversions are exact") {
+    CHECK(quantity_cast<ns>(s(9'000'000'000)).number() == 9'000'000'000'000'000'000);
+  }
+
+  SECTION ("overflowing conversions throw 'std::overflow_error'") {
+    CHECK_THROWS_AS(quantity_cast<ns>(s(10'000'000'000)), std::overflow_error);
+    CHECK_THROWS_AS(quantity_cast<ns>(s(-10'000'000'000)), std::overflow_error);
+    CHECK_THROWS_AS(ns(s(10'000'000'000)), std::overflow_error);
+    CHECK_THROWS_AS((quantity_cast<length<metre, std::int8_t>>(length<kilometre, checked<int>>(1))), std::overflow_error);
+  }
+}
@@ -0,0 +1,151 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/parallel_random.h>
+#include <units/isq/si/length.h>
+#include <units/isq/si/time.h>
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace units;
+using namespace units::isq::si;
+
+namespace {
+
+template<typename Q>
+double mean(const std::vector<Q>& v)
+{
+  double sum = 0;
+  for (const Q& q : v) sum += static_cast<double>(q.number());
+  return sum / static_cast<double>(v.size());
+}
+
+template<typename Q>
+double variance(const std::vector<Q>& v)
+{
+  const double m = mean(v);
+  double sum = 0;
+  for (const Q& q : v) sum += (q.number() - m) * (q.number() - m);
+  return sum / static_cast<double>(v.size() - 1);
+}
+
+}  // namespace
+
+static_assert(std::uniform_random_bit_generator<philox4x32>);
+
+TEST_CASE("philox4x32 matches the Random123 known answers", "[parallel_random][philox4x32]")
+{
+  using block = philox4x32::block_type;
+
+  CHECK(philox4x32::bijection({0, 0, 0, 0}, {0, 0}) == block{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8});
+  CHECK(philox4x32::bijection({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff}) ==
+        block{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd});
+  CHECK(philox4x32::bijection({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}) ==
+        block{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1});
+}
+
+TEST_CASE("philox4x32 streams", "[parallel_random][philox4x32]")
+{
+  SECTION("discard() is equivalent to drawing the numbers") {
+    philox4x32 a(42), b(42);
+    for (int i = 0; i < 1003; ++i) static_cast<void>(a());
+    b.discard(1003);
+    CHECK(a == b);
+    CHECK(a() == b());
+  }
+
+  SECTION("fill() is equivalent to drawing the numbers") {
+    philox4x32 a(42), b(42);
+    static_cast<void>(a());
+    static_cast<void>(b());
+    std::vector<philox4x32::result_type> out(23);
+    a.fill(out);
+    for (const auto v : out) CHECK(v == b());
+    CHECK(a == b);
+  }
+
+  SECTION("split() streams are reproducible and different") {
+    const philox4x32 root(7);
+    philox4x32 s1 = root.split(1), s1_again = root.split(1), s2 = root.split(2);
+    CHECK(s1.stream() == 1);
+    CHECK(s1() == s1_again());
+    CHECK(s1 != s2);
+    int equal = 0;
+    for (int i = 0; i < 1000; ++i) equal += s1() == s2();
+    CHECK(equal < 2);
+  }
+}
+
+TEST_CASE("bulk quantity kernels", "[parallel_random]")
+{
+  constexpr std::size_t count = 200'000;
+  philox4x32 gen(2021);
+
+  SECTION("generate_uniform()") {
+    std::vector<length<metre>> out(count);
+    generate_uniform(gen, std::span(out), length<metre>(2.), length<metre>(6.));
+    for (const auto& q : out) REQUIRE((q >= length<metre>(2.) && q < length<metre>(6.)));
+    CHECK(mean(out) == Approx(4.).epsilon(0.01));
+    CHECK(variance(out) == Approx(16. / 12.).epsilon(0.02));
+  }
+
+  SECTION("generate_uniform() without fill()") {
+    std::mt19937_64 mt;
+    std::vector<length<metre, float>> out(count);
+    generate_uniform(mt, std::span(out), length<metre, float>(-1.f), length<metre, float>(1.f));
+    CHECK(mean(out) == Approx(0.).margin(0.01));
+  }
+
+  SECTION("generate_normal()") {
+    std::vector<length<metre>> out(count);
+    generate_normal(gen, std::span(out), length<metre>(10.), length<metre>(2.));
+    CHECK(mean(out) == Approx(10.).epsilon(0.01));
+    CHECK(variance(out) == Approx(4.).epsilon(0.02));
+    std::size_t beyond_3_sigma = 0;
+    for (const auto& q : out) beyond_3_sigma += std::abs(q.number() - 10.) > 6.;
+    CHECK(static_cast<double>(beyond_3_sigma) / count == Approx(0.0027).epsilon(0.2));
+  }
+
+  SECTION("generate_exponential()") {
+    std::vector<isq::si::time<second>> out(count);
+    generate_exponential(gen, std::span(out), isq::si::time<second>(3.));
+    for (const auto& q : out) REQUIRE(q.number() >= 0.);
+    CHECK(mean(out) == Approx(3.).epsilon(0.01));
+    CHECK(variance(out) == Approx(9.).epsilon(0.03));
+  }
+
+  SECTION("split streams give the same results as one stream") {
+    std::vector<length<metre>> whole(1024), parts(1024);
+    philox4x32 a = gen.split(5);
+    generate_uniform(a, std::span(whole), length<metre>(0.), length<metre>(1.));
+    philox4x32 b = gen.split(5);
+    philox4x32 c = gen.split(5);
+    c.discard(512 * 2);
+    generate_uniform(b, std::span(parts).first(512), length<metre>(0.), length<metre>(1.));
+    generate_uniform(c, std::span(parts).last(512), length<metre>(0.), length<metre>(1.));
+    CHECK(whole == parts);
+  }
+}
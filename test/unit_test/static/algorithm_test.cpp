@@ -0,0 +1,100 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/algorithm.h>
+#include <units/chrono.h>
+#include <units/isq/si/energy.h>
+#include <units/isq/si/length.h>
+#include <units/isq/si/power.h>
+#include <units/isq/si/speed.h>
+#include <units/isq/si/time.h>
+#include <units/quantity_point.h>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace {
+
+using namespace units;
+using namespace units::isq::si;
+
+using sys_seconds = quantity_point<clock_origin<std::chrono::system_clock>, second, double>;
+
+constexpr std::array<units::isq::si::time<second>, 4> times = {units::isq::si::time<second>(0.), units::isq::si::time<second>(1.),
+                                                               units::isq::si::time<second>(3.), units::isq::si::time<second>(4.)};
+constexpr std::array<sys_seconds, 4> stamps = {sys_seconds(times[0]), sys_seconds(times[1]), sys_seconds(times[2]),
+                                               sys_seconds(times[3])};
+constexpr std::array<power<watt>, 4> powers = {power<watt>(2.), power<watt>(4.), power<watt>(4.), power<watt>(0.)};
+constexpr std::array<length<metre>, 4> positions = {length<metre>(0.), length<metre>(2.), length<metre>(6.), length<metre>(8.)};
+
+// integrate_trapezoid
+static_assert(is_same_v<decltype(integrate_trapezoid(times, powers)), energy<joule>>);
+static_assert(integrate_trapezoid(times, powers) == energy<joule>(3. + 8. + 2.));
+static_assert(integrate_trapezoid(stamps, powers) == energy<joule>(13.));
+static_assert(integrate_trapezoid(std::array{stamps[0]}, std::array{powers[0]}) == energy<joule>(0.));
+static_assert(integrate_trapezoid(std::array{units::isq::si::time<millisecond, int>(0), units::isq::si::time<millisecond, int>(3)},
+                                  std::array{power<watt, int>(1), power<watt, int>(2)})
+                .number() == 4);
+
+// differentiate
+constexpr auto speeds = [] {
+  std::array<speed<metre_per_second>, 4> out{};
+  differentiate(stamps, positions, out);
+  return out;
+}();
+static_assert(speeds[0] == speed<metre_per_second>(2.));
+static_assert(speeds[1] == speed<metre_per_second>(2.));
+static_assert(speeds[2] == speed<metre_per_second>(2.));
+static_assert(speeds[3] == speed<metre_per_second>(2.));
+
+constexpr auto kmh = [] {
+  std::array<speed<kilometre_per_hour>, 4> out{};
+  differentiate(times, positions, out);
+  return out;
+}();
+static_assert(kmh[0] == speed<metre_per_second>(2.));
+
+// incremental forms
+static_assert(is_same_v<incremental_integral<sys_seconds, power<watt>>::result_type, energy<joule>>);
+static_assert(is_same_v<incremental_derivative<sys_seconds, length<metre>>::result_type, speed<metre_per_second>>);
+
+constexpr auto integral = [] {
+  incremental_integral<sys_seconds, power<watt>> i;
+  for (std::size_t n = 0; n < stamps.size(); ++n) i.push(stamps[n], powers[n]);
+  return i.value();
+}();
+static_assert(integral == integrate_trapezoid(stamps, powers));
+static_assert(incremental_integral<sys_seconds, power<watt>>().value() == energy<joule>(0.));
+
+constexpr auto derivative = [] {
+  incremental_derivative<sys_seconds, length<metre>> d;
+  d.push(stamps[0], positions[0]);
+  const bool single = d.has_value();
+  d.push(stamps[2], positions[2]);
+  return std::pair{single, d.value()};
+}();
+static_assert(!derivative.first);
+static_assert(derivative.second == speed<metre_per_second>(2.));
+
+}  // namespace
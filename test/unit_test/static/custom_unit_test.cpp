@@ -51,6 +51,11 @@ using amplitude_spectral_density = quantity<dim_amplitude_spectral_density, U, R
 
 }
 
+UNITS_DOWNCAST_REGISTER(sq_volt_per_hertz);
+UNITS_DOWNCAST_REGISTER(dim_power_spectral_density);
+UNITS_DOWNCAST_REGISTER(volt_per_sqrt_hertz);
+UNITS_DOWNCAST_REGISTER(dim_amplitude_spectral_density);
+
 namespace {
 
 static_assert(compare<dimension_sqrt<dim_power_spectral_density>, dim_amplitude_spectral_density>);
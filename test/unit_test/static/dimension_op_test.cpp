@@ -38,6 +38,7 @@ struct u2 : named_unit<u2, "u2", no_prefix> {};
 struct d2 : base_dimension<"d2", u2> {};
 struct u3 : named_unit<u3, "u3", no_prefix> {};
 struct d3 : base_dimension<"d3", u3> {};
+struct d0_u1 : base_dimension<"d0", u1> {};
 
 // exponent_invert
 
@@ -88,6 +89,28 @@ static_assert(is_same_v<make_dimension<units::exponent<d0, -1>, units::exponent<
 static_assert(is_same_v<make_dimension<units::exponent<d0, 1>, units::exponent<d1, 1>, units::exponent<d1, -1>>, derived_dim<units::exponent<d0, 1>>>);
 static_assert(is_same_v<make_dimension<units::exponent<d0, 1>, units::exponent<d0, -1>, units::exponent<d1, 1>>, derived_dim<units::exponent<d1, 1>>>);
 static_assert(is_same_v<make_dimension<units::exponent<d0, 1>, units::exponent<d1, 1>, units::exponent<d0, -1>>, derived_dim<units::exponent<d1, 1>>>);
+static_assert(is_same_v<make_dimension<units::exponent<d0, 1>, units::exponent<d0_u1, 1>>, derived_dim<units::exponent<d0, 1>, units::exponent<d0_u1, 1>>>);
+static_assert(is_same_v<make_dimension<units::exponent<d0_u1, 1>, units::exponent<d0, 1>>, derived_dim<units::exponent<d0_u1, 1>, units::exponent<d0, 1>>>);
+
+// unknown_dimension
+
+using unknown_d0_d1 = unknown_dimension<units::exponent<d0, 1>, units::exponent<d1, -2>>;
+static_assert(is_same_v<unknown_d0_d1::downcast_base_type, derived_dim<units::exponent<d0, 1>, units::exponent<d1, -2>>>);
+static_assert(is_same_v<unknown_d0_d1::recipe, exponent_list<units::exponent<d0, 1>, units::exponent<d1, -2>>>);
+static_assert(is_same_v<unknown_d0_d1::coherent_unit, unknown_coherent_unit>);
+static_assert(unknown_d0_d1::base_units_ratio == ratio(1));
+
+// user-written unknown dimensions are normalized
+static_assert(detail::normalized_exponents<units::exponent<d0, 1>, units::exponent<d1, -2>>);
+static_assert(!detail::normalized_exponents<units::exponent<d1, -2>, units::exponent<d0, 1>>);
+static_assert(!detail::normalized_exponents<units::exponent<d0, 1>, units::exponent<d0, 1>>);
+static_assert(!detail::normalized_exponents<units::exponent<dim2, 1>>);
+#if UNITS_DOWNCAST_MODE == 0
+static_assert(is_same_v<unknown_dimension<units::exponent<d1, -2>, units::exponent<d0, 1>>::downcast_base_type,
+                        derived_dim<units::exponent<d0, 1>, units::exponent<d1, -2>>>);
+static_assert(is_same_v<unknown_dimension<units::exponent<d0, 1>, units::exponent<d0, 1>>::downcast_base_type, derived_dim<units::exponent<d0, 2>>>);
+static_assert(is_same_v<unknown_dimension<units::exponent<dim2, 1>>::downcast_base_type, dim2>);
+#endif
 
 // dimension_multiply
 
@@ -108,6 +131,10 @@ static_assert(is_same_v<
               dimension_multiply<derived_dim<units::exponent<d0, 1>, units::exponent<d1, 1>, units::exponent<d2, 1>>, derived_dim<units::exponent<d1, -1>>>,
               unknown_dimension<units::exponent<d0, 1>, units::exponent<d2, 1>>>);
 static_assert(is_same_v<dimension_multiply<derived_dim<units::exponent<d0, 2>>, derived_dim<units::exponent<d0, -1>>>, d0>);
+static_assert(is_same_v<dimension_multiply<derived_dim<units::exponent<d0, 1, 2>, units::exponent<d2, 1>>,
+                                           derived_dim<units::exponent<d0, -1, 2>, units::exponent<d1, 1>, units::exponent<d2, 1, 3>>>,
+                        unknown_dimension<units::exponent<d1, 1>, units::exponent<d2, 4, 3>>>);
+static_assert(is_same_v<dimension_multiply<d0, d0_u1>, unknown_dimension<units::exponent<d0_u1, 1>, units::exponent<d0, 1>>>);
 
 // dimension_divide
 
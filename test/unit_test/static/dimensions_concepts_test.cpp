@@ -63,6 +63,10 @@ static_assert(Volume<quantity<unknown_dimension<exponent<si::dim_length, 3>>, un
 
 static_assert(Speed<si::speed<si::metre_per_second>>);
 static_assert(!Speed<si::time<si::second>>);
+#if UNITS_DOWNCAST_MODE == 0
+static_assert(equivalent<unknown_dimension<exponent<si::dim_time, -1>, exponent<si::dim_length, 1>>, si::dim_speed>);
+static_assert(equivalent<unknown_dimension<exponent<si::dim_speed, 1>>, si::dim_speed>);
+#endif
 
 static_assert(Acceleration<si::acceleration<si::metre_per_second_sq>>);
 static_assert(!Acceleration<si::time<si::second>>);
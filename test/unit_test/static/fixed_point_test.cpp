@@ -0,0 +1,116 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/fixed_point.h>
+#include <units/isq/si/length.h>
+#include <units/isq/si/speed.h>
+#include <units/isq/si/time.h>
+#include <units/quantity.h>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace {
+
+using namespace units;
+using namespace units::isq::si;
+
+using q2 = fixed_point<std::uint16_t, 2>;  // 0.25 steps
+using s8 = fixed_point<std::int16_t, 8>;
+using i32 = fixed_point<std::int32_t, 16>;
+
+// class invariants
+
+static_assert(sizeof(q2) == 2);
+static_assert(sizeof(i32) == 4);
+static_assert(sizeof(length<metre, q2>) == 2);
+static_assert(std::is_trivially_copyable_v<q2>);
+static_assert(Representation<q2>);
+static_assert(Representation<i32>);
+static_assert(treat_as_floating_point<q2>);
+static_assert(!treat_as_floating_point<fixed_point<std::int16_t, 0>>);
+
+// construction and conversion
+
+static_assert(q2(1).raw() == 4);
+static_assert(q2(2.25).raw() == 9);
+static_assert(q2(2.3).raw() == 9);  // rounds to the nearest step
+static_assert(q2(2.4).raw() == 10);
+static_assert(static_cast<double>(q2::from_raw(9)) == 2.25);
+static_assert(static_cast<int>(s8(-2.5)) == -2);
+static_assert(s8(fixed_point<std::int16_t, 4>(1.5)) == s8(1.5));
+static_assert(fixed_point<std::int16_t, 4>(s8(1.5)) == fixed_point<std::int16_t, 4>(1.5));
+
+// saturation
+
+static_assert(q2(-1) == q2::from_raw(0));
+static_assert(q2(-1.) == q2::from_raw(0));
+static_assert(q2(100'000) == q2::from_raw(std::numeric_limits<std::uint16_t>::max()));
+static_assert(q2(1e9) == q2::from_raw(std::numeric_limits<std::uint16_t>::max()));
+static_assert(s8(1000) == s8::from_raw(std::numeric_limits<std::int16_t>::max()));
+static_assert(s8(-1000) == s8::from_raw(std::numeric_limits<std::int16_t>::lowest()));
+static_assert(q2(16'000) + q2(16'000) == q2::from_raw(std::numeric_limits<std::uint16_t>::max()));
+static_assert(q2(1) - q2(2) == q2::from_raw(0));
+static_assert(s8(100) * s8(100) == s8::from_raw(std::numeric_limits<std::int16_t>::max()));
+static_assert(s8(-100) * s8(100) == s8::from_raw(std::numeric_limits<std::int16_t>::lowest()));
+static_assert(-s8::from_raw(std::numeric_limits<std::int16_t>::lowest()) == s8::from_raw(std::numeric_limits<std::int16_t>::max()));
+
+// arithmetic
+
+static_assert(s8(1.5) + s8(2.25) == s8(3.75));
+static_assert(s8(1.5) - s8(2.25) == s8(-0.75));
+static_assert(s8(1.5) * s8(-2) == s8(-3));
+static_assert(s8(3) / s8(2) == s8(1.5));
+static_assert(s8(1.5) < s8(2));
+
+// quantity_values
+
+static_assert(length<metre, q2>::zero().number() == q2(0));
+static_assert(length<metre, q2>::one().number() == q2(1));
+static_assert(length<metre, q2>::max().number() == q2::from_raw(std::numeric_limits<std::uint16_t>::max()));
+
+// quantity support
+
+static_assert(length<metre, q2>(2.25).number().raw() == 9);
+static_assert(length<metre, q2>(2.25) + length<metre, q2>(1) == length<metre, q2>(3.25));
+static_assert(length<metre, s8>(3) / time<second, s8>(2) == speed<metre_per_second, s8>(1.5));
+
+// quantity_cast folds the binary scale and the unit ratio
+
+static_assert(quantity_cast<length<metre, double>>(length<metre, q2>(2.25)).number() == 2.25);
+static_assert(quantity_cast<length<centimetre, double>>(length<metre, q2>(2.25)).number() == 225.);
+static_assert(quantity_cast<length<kilometre, double>>(length<metre, q2>(250)).number() == 0.25);
+static_assert(quantity_cast<length<metre, q2>>(length<centimetre, double>(225.)).number().raw() == 9);
+static_assert(quantity_cast<length<metre, q2>>(length<kilometre, int>(1)).number() == q2(1000));
+static_assert(quantity_cast<length<kilometre, q2>>(length<metre, s8>(125)).number() == q2(0.125 + 0.125));  // rounds to 0.25
+static_assert(quantity_cast<length<centimetre, int>>(length<metre, q2>(2.25)).number() == 225);
+static_assert(quantity_cast<length<metre, q2>>(length<kilometre, double>(1'000.)) == length<metre, q2>::max());  // saturates
+static_assert(length<metre, q2>(length<metre, double>(2.25)).number().raw() == 9);
+
+// range checks
+
+static_assert(range_fits<length<metre, q2>>(length<metre, int>(0), length<metre, int>(16'000)));
+static_assert(!range_fits<length<metre, q2>>(length<metre, int>(-1), length<metre, int>(16'000)));
+static_assert(!range_fits<length<metre, q2>>(length<kilometre, int>(0), length<kilometre, int>(20)));
+static_assert(range_fits<length<metre, s8>>(length<centimetre, int>(-12'000), length<centimetre, int>(12'000)));
+
+}  // namespace
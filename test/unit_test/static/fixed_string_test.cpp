@@ -50,4 +50,8 @@ static_assert(basic_fixed_string('d') + txt2 == basic_fixed_string("dabc"));
 static_assert(txt2 + basic_fixed_string("def") == basic_fixed_string("abcdef"));
 static_assert(basic_fixed_string("def") + txt2 == basic_fixed_string("defabc"));
 
+static_assert(concat(txt2) == basic_fixed_string("abc"));
+static_assert(concat(txt1, txt2, basic_fixed_string("")) == basic_fixed_string("aabc"));
+static_assert(concat(txt2, basic_fixed_string('d'), basic_fixed_string("ef")) == basic_fixed_string("abcdef"));
+
 }
@@ -0,0 +1,88 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/bits/external/hacks.h>
+
+#if UNITS_HAS_FLOAT16
+
+#include <units/algorithm.h>
+#include <units/isq/si/length.h>
+#include <units/isq/si/speed.h>
+#include <units/isq/si/time.h>
+#include <array>
+#include <type_traits>
+
+namespace {
+
+using namespace units;
+using namespace units::isq::si;
+
+using half = _Float16;
+
+static_assert(treat_as_floating_point<half>);
+static_assert(Representation<half>);
+static_assert(sizeof(length<metre, half>) == 2);
+
+// quantity_values
+static_assert(length<metre, half>::zero().number() == half(0));
+static_assert(length<metre, half>::one().number() == half(1));
+static_assert(length<metre, half>::max().number() == static_cast<half>(65504.f));
+static_assert(length<metre, half>::min().number() == static_cast<half>(-65504.f));
+
+// implicit conversions as for other floating-point types
+static_assert(std::is_convertible_v<length<kilometre, half>, length<metre, half>>);
+static_assert(std::is_convertible_v<length<metre, int>, length<metre, half>>);
+static_assert(!std::is_convertible_v<length<metre, half>, length<metre, int>>);
+
+// conversions scale in single precision
+static_assert(std::is_same_v<detail::cast_traits<half, half>::ratio_type, float>);
+static_assert(std::is_same_v<detail::cast_traits<half, double>::ratio_type, double>);
+static_assert(std::is_same_v<detail::cast_traits<int, half>::ratio_type, float>);
+static_assert(quantity_cast<length<metre, half>>(length<kilometre, half>(half(2))).number() == half(2000));
+static_assert(quantity_cast<length<kilometre, half>>(length<millimetre, half>(half(1024))).number() == static_cast<half>(0.001024f));
+static_assert(quantity_cast<length<metre, float>>(length<kilometre, half>(half(1.5f))).number() == 1500.f);
+static_assert(quantity_cast<speed<kilometre_per_hour, half>>(speed<metre_per_second, half>(half(10))).number() == half(36));
+
+// arithmetic
+static_assert(length<metre, half>(half(2)) + length<metre, half>(half(3)) == length<metre, half>(half(5)));
+static_assert(length<metre, half>(half(6)) / isq::si::time<second, half>(half(2)) == speed<metre_per_second, half>(half(3)));
+
+// bulk operations
+static_assert([] {
+  std::array<length<kilometre, half>, 3> in{length<kilometre, half>(half(1)), length<kilometre, half>(half(2)),
+                                            length<kilometre, half>(half(0.5f))};
+  std::array<length<metre, float>, 3> out{};
+  bulk_cast(in, out);
+  return out[0].number() == 1000.f && out[1].number() == 2000.f && out[2].number() == 500.f;
+}());
+
+// 4096 additions of 1 in half-precision stop growing at 2048
+static_assert([] {
+  std::array<length<metre, half>, 4096> in{};
+  for (auto& v : in) v = length<metre, half>(half(1));
+  const auto sum = bulk_sum(in);
+  return std::is_same_v<decltype(sum)::rep, float> && sum.number() == 4096.f;
+}());
+
+}  // namespace
+
+#endif  // UNITS_HAS_FLOAT16
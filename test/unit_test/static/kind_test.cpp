@@ -48,6 +48,14 @@ struct radius : kind<radius, dim_length> {};  // program-defined base kind
 struct colatitude : kind<colatitude, units::dim_angle<>> {};
 struct azimuth : kind<azimuth, units::dim_angle<>> {};
 
+}  // namespace
+
+UNITS_DOWNCAST_REGISTER(radius);
+UNITS_DOWNCAST_REGISTER(colatitude);
+UNITS_DOWNCAST_REGISTER(azimuth);
+
+namespace {
+
 static_assert(Kind<radius>);
 static_assert(Kind<colatitude>);
 static_assert(Kind<azimuth>);
@@ -113,6 +121,14 @@ struct width : kind<width, units::isq::si::dim_length> {};
 using horizontal_speed = downcast_kind<width, dim_speed>;
 
 struct abscissa : point_kind<abscissa, width> {};                                  // program-defined base point kind
+
+}  // namespace
+
+UNITS_DOWNCAST_REGISTER(width);
+UNITS_DOWNCAST_REGISTER(abscissa);
+
+namespace {
+
 using horizontal_velocity = downcast_point_kind<downcast_kind<width, dim_speed>>;  // library-defined derived point kind
 
 static_assert(!Kind<abscissa>);
@@ -153,6 +169,14 @@ struct height : kind<height, dim_length> {};
 struct rate_of_climb : derived_kind<rate_of_climb, dim_speed, height> {};    // program-defined derived kind
 struct velocity_of_climb : point_kind<velocity_of_climb, rate_of_climb> {};  // program-defined derived point kind
 
+}  // namespace
+
+UNITS_DOWNCAST_REGISTER(height);
+UNITS_DOWNCAST_REGISTER(rate_of_climb);
+UNITS_DOWNCAST_REGISTER(velocity_of_climb);
+
+namespace {
+
 static_assert(Kind<rate_of_climb>);
 static_assert(Kind<rate_of_climb::derived_kind>);
 static_assert(Kind<rate_of_climb::_kind_base>);
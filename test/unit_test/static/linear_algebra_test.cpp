@@ -0,0 +1,108 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/linear_algebra.h>
+#include <units/isq/si/frequency.h>
+#include <units/isq/si/length.h>
+#include <units/isq/si/speed.h>
+#include <units/isq/si/time.h>
+#include <type_traits>
+
+namespace {
+
+using namespace units;
+using namespace units::isq::si;
+using units::isq::si::time;
+
+// state of a 1D constant-velocity model and a position measurement
+using state = la::vector<length<metre>, speed<metre_per_second>>;
+using measurement = la::vector<length<metre>>;
+using transition = la::matrix<state, state>;
+using covariance = la::matrix<state, la::inverse_vector<state>>;
+using observation = la::matrix<measurement, state>;
+
+// vector
+static_assert(state::size == 2);
+static_assert(sizeof(state) == 2 * sizeof(double));
+static_assert(std::is_trivially_copyable_v<state>);
+static_assert(std::is_same_v<state::element_type<1>, speed<metre_per_second>>);
+static_assert(state().get<0>() == length<metre>(0.));
+static_assert(state(length<metre>(1.), speed<metre_per_second>(2.)).get<1>() == speed<metre_per_second>(2.));
+static_assert(state(length<kilometre>(1.), speed<metre_per_second>(2.)).get<0>() == length<metre>(1'000.));
+static_assert(state(length<metre>(1.), speed<metre_per_second>(2.)) + state(length<metre>(3.), speed<metre_per_second>(4.)) ==
+              state(length<metre>(4.), speed<metre_per_second>(6.)));
+static_assert(2. * state(length<metre>(1.), speed<metre_per_second>(2.)) == state(length<metre>(2.), speed<metre_per_second>(4.)));
+static_assert(!std::is_convertible_v<length<metre>, measurement>);
+static_assert(std::is_same_v<la::inverse_vector<la::inverse_vector<state>>, state>);
+
+// element types
+static_assert(transition::rows == 2 && transition::cols == 2);
+static_assert(sizeof(transition) == 4 * sizeof(double));
+static_assert(std::is_same_v<transition::element_type<0, 1>, time<second>>);
+static_assert(std::is_same_v<transition::element_type<1, 0>::dimension, dim_frequency>);
+static_assert(std::is_same_v<transition::element_type<1, 1>, dimensionless<one>>);
+static_assert(std::is_same_v<covariance::element_type<0, 0>, decltype(length<metre>() * length<metre>())>);
+static_assert(std::is_same_v<covariance::element_type<0, 1>, decltype(length<metre>() * speed<metre_per_second>())>);
+
+static_assert(std::is_constructible_v<transition, double, time<second>, double, double>);
+static_assert(!std::is_constructible_v<transition, double, length<metre>, double, double>);
+static_assert(!std::is_constructible_v<transition, double, time<second>, double>);
+
+constexpr transition f(1., time<second>(2.), 0., 1.);
+constexpr observation h(1., 0.);
+
+static_assert(f.get<0, 1>() == time<second>(2.));
+static_assert(f.get<1, 1>() == 1.);
+static_assert(transition::identity().get<0, 0>() == 1. && transition::identity().get<0, 1>() == time<second>(0.));
+
+// matrix * vector
+constexpr state x(length<metre>(10.), speed<metre_per_second>(3.));
+static_assert(std::is_same_v<decltype(f * x), state>);
+static_assert(f * x == state(length<metre>(16.), speed<metre_per_second>(3.)));
+static_assert(std::is_same_v<decltype(h * x), measurement>);
+static_assert((h * x).get<0>() == length<metre>(10.));
+
+// matrix * matrix and transpose
+static_assert(std::is_same_v<decltype(f * f), transition>);
+static_assert((f * f).get<0, 1>() == time<second>(4.));
+static_assert(std::is_same_v<decltype(transpose(f)), la::matrix<la::inverse_vector<state>, la::inverse_vector<state>>>);
+static_assert(transpose(f).numbers()[2] == 2.);
+static_assert(std::is_same_v<decltype(transpose(transpose(f))), transition>);
+static_assert(std::is_same_v<decltype(transpose(covariance())), covariance>);
+static_assert(std::is_same_v<decltype(f * covariance() * transpose(f) + covariance()), covariance>);
+
+// Kalman gain
+using innovation_covariance = la::matrix<measurement, la::inverse_vector<measurement>>;
+static_assert(std::is_same_v<decltype(h * covariance() * transpose(h)), innovation_covariance>);
+static_assert(std::is_same_v<decltype(covariance() * transpose(h) * inverse(innovation_covariance(length<metre>(2.) * length<metre>(2.)))),
+                             la::matrix<state, measurement>>);
+static_assert(std::is_same_v<decltype(transition::identity() - la::matrix<state, measurement>() * h), transition>);
+
+// inverse
+static_assert(std::is_same_v<decltype(inverse(f)), transition>);
+static_assert(inverse(f) == transition(1., time<second>(-2.), 0., 1.));
+static_assert(inverse(f) * f == transition::identity());
+static_assert(inverse(transition(0., time<second>(2.), transition::element_type<1, 0>(4.), 0.)) ==
+              transition(0., time<second>(0.25), transition::element_type<1, 0>(0.5), 0.));
+static_assert(inverse(innovation_covariance(length<metre>(2.) * length<metre>(2.))).get<0, 0>() * (length<metre>(1.) * length<metre>(1.)) == 0.25);
+
+}  // namespace
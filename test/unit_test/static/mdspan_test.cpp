@@ -0,0 +1,84 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/mdspan.h>
+#include <units/isq/si/international/length.h>
+#include <units/isq/si/length.h>
+#include <units/isq/si/thermodynamic_temperature.h>
+#include <array>
+#include <type_traits>
+
+namespace {
+
+using namespace units;
+using namespace units::isq::si;
+
+constexpr std::array<double, 6> heights = {0., 1., 2., 3., 4., 5.};
+constexpr std::array<int, 4> distances = {0, 1'000, 1'500, 3'000};
+
+// quantity_accessor
+using qa = quantity_accessor<length<metre>>;
+static_assert(std::is_same_v<qa::element_type, const length<metre>>);
+static_assert(std::is_same_v<qa::reference, length<metre>>);
+static_assert(std::is_same_v<qa::data_handle_type, const double*>);
+static_assert(std::is_same_v<qa::offset_policy, qa>);
+static_assert(std::is_nothrow_default_constructible_v<qa>);
+static_assert(std::is_trivially_copyable_v<qa>);
+
+static_assert(qa{}.access(heights.data(), 2) == length<metre>(2.));
+static_assert(qa{}.access(qa{}.offset(heights.data(), 3), 2) == length<metre>(5.));
+static_assert(quantity_accessor<thermodynamic_temperature<kelvin>>{}.access(heights.data(), 4) ==
+              thermodynamic_temperature<kelvin>(4.));
+
+// converting_accessor
+using ca = converting_accessor<length<metre>, length<international::foot>>;
+static_assert(std::is_same_v<ca::element_type, const length<international::foot>>);
+static_assert(std::is_same_v<ca::reference, length<international::foot>>);
+static_assert(std::is_same_v<ca::data_handle_type, const double*>);
+static_assert(std::is_trivially_copyable_v<ca>);
+
+static_assert(ca{}.access(heights.data(), 0) == length<international::foot>(0.));
+static_assert(ca{}.access(heights.data(), 3) == length<metre>(3.));
+static_assert(ca{}.access(ca{}.offset(heights.data(), 1), 2) == length<metre>(3.));
+
+// truncating conversions
+using ica = converting_accessor<length<metre, int>, length<kilometre, int>>;
+static_assert(std::is_same_v<ica::data_handle_type, const int*>);
+static_assert(ica{}.access(distances.data(), 1).number() == 1);
+static_assert(ica{}.access(distances.data(), 2).number() == 1);
+static_assert(ica{}.access(distances.data(), 3).number() == 3);
+static_assert(converting_accessor<length<kilometre, int>, length<metre, int>>{}.access(distances.data(), 2).number() == 1'500'000);
+
+// construction from quantity_accessor is explicit only for truncating conversions
+static_assert(std::is_convertible_v<quantity_accessor<length<kilometre, int>>, converting_accessor<length<kilometre, int>, length<metre, int>>>);
+static_assert(std::is_convertible_v<qa, ca>);
+static_assert(!std::is_convertible_v<quantity_accessor<length<metre, int>>, ica>);
+static_assert(std::is_constructible_v<ica, quantity_accessor<length<metre, int>>>);
+
+// not convertible dimensions
+template<typename From, typename To>
+concept converting_accessor_for = requires { typename converting_accessor<From, To>; };
+
+static_assert(converting_accessor_for<length<metre>, length<international::foot>>);
+static_assert(!converting_accessor_for<length<metre>, thermodynamic_temperature<kelvin>>);
+
+}  // namespace
@@ -0,0 +1,97 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/mixed.h>
+#include <units/isq/si/area.h>
+#include <units/isq/si/length.h>
+#include <units/isq/si/speed.h>
+#include <units/isq/si/time.h>
+#include <type_traits>
+
+namespace {
+
+using namespace units;
+using namespace units::isq::si;
+
+using mf = mixed<float, double>;
+
+static_assert(Representation<mf>);
+static_assert(treat_as_floating_point<mf>);
+static_assert(sizeof(mf) == sizeof(float));
+static_assert(sizeof(length<metre, mf>) == sizeof(float));
+
+// quantity_values
+static_assert(length<metre, mf>::zero().number() == 0.);
+static_assert(length<metre, mf>::one().number() == 1.);
+static_assert(length<metre, mf>::max().number().stored() == std::numeric_limits<float>::max());
+static_assert(length<metre, mf>::min().number().stored() == std::numeric_limits<float>::lowest());
+
+// common type
+static_assert(std::is_same_v<std::common_type_t<mf, int>, double>);
+static_assert(std::is_same_v<std::common_type_t<long double, mf>, long double>);
+static_assert(std::is_same_v<std::common_type_t<mixed<float, double>, mixed<double, long double>>, mixed<double, long double>>);
+
+// arithmetic is done in the compute type
+static_assert(std::is_same_v<decltype(mf(1) + mf(2)), double>);
+static_assert(std::is_same_v<decltype(mf(1) * 2.f), double>);
+static_assert(std::is_same_v<decltype(2 / mf(1)), double>);
+static_assert(std::is_same_v<decltype(-mf(1)), mf>);
+static_assert(mf(16'777'216.f) + mf(1.f) - mf(16'777'216.f) == 1.);
+static_assert(mf(1) < 2. && 2 > mf(1) && mf(1) == mf(1) && mf(1) != 2.);
+
+// storing narrows
+static_assert([] {
+  mf v(16'777'216.f);
+  v += mf(1.f);
+  return v.stored() == 16'777'216.f;
+}());
+
+// quantity operators
+static_assert(std::is_same_v<decltype(length<metre, mf>(1) + length<metre, mf>(2)), length<metre, double>>);
+static_assert(std::is_same_v<decltype(length<metre, mf>(1) * length<metre, mf>(2)), area<square_metre, double>>);
+static_assert(std::is_same_v<decltype(length<metre, mf>(1) * 2.), length<metre, double>>);
+static_assert(length<metre, mf>(6) / isq::si::time<second, mf>(2) == speed<metre_per_second, mf>(3));
+static_assert(length<kilometre, mf>(1) == length<metre, mf>(1000));
+static_assert(length<kilometre, mf>(16'777.216f) + length<metre, mf>(1) - length<kilometre, mf>(16'777.216f) == length<metre, double>(1));
+static_assert([] {
+  length<metre, mf> d(1);
+  d += length<metre, mf>(2);
+  d *= 2.;
+  return d == length<metre, mf>(6);
+}());
+
+// implicit conversions
+static_assert(std::is_convertible_v<length<metre, double>, length<metre, mf>>);
+static_assert(std::is_convertible_v<length<metre, mf>, length<metre, double>>);
+static_assert(std::is_convertible_v<length<kilometre, mf>, length<metre, mf>>);
+static_assert(std::is_convertible_v<length<metre, int>, length<metre, mf>>);
+static_assert(!std::is_convertible_v<length<metre, mf>, length<metre, int>>);
+
+// quantity_cast
+static_assert(std::is_same_v<detail::cast_traits<mf, float>::ratio_type, double>);
+static_assert(std::is_same_v<detail::cast_traits<int, mf>::ratio_type, double>);
+static_assert(std::is_same_v<detail::cast_traits<mf, mixed<float, long double>>::ratio_type, long double>);
+static_assert(quantity_cast<length<metre, mf>>(length<kilometre, mf>(2)).number() == 2000.);
+static_assert(quantity_cast<length<metre, int>>(length<kilometre, mf>(2.5f)).number() == 2500);
+static_assert(quantity_cast<speed<kilometre_per_hour, mf>>(speed<metre_per_second, mf>(10)).number() == 36.);
+
+}  // namespace
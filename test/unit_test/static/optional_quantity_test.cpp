@@ -0,0 +1,148 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/isq/si/length.h>
+#include <units/isq/si/speed.h>
+#include <units/isq/si/time.h>
+#include <units/optional_quantity.h>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <type_traits>
+
+namespace {
+
+using namespace units;
+using namespace units::isq::si;
+
+using length_fp = length<metre, double>;
+using length_f = length<metre, float>;
+using length_int = length<metre, int>;
+using length_u16 = length<metre, std::uint16_t>;
+
+// class invariants
+
+static_assert(sizeof(optional_quantity<length_fp>) == sizeof(double));
+static_assert(sizeof(optional_quantity<length_f>) == sizeof(float));
+static_assert(sizeof(optional_quantity<length_int>) == sizeof(int));
+static_assert(sizeof(optional_quantity<length_u16, sentinel_value<std::uint16_t, 0xFFFF>>) == sizeof(std::uint16_t));
+
+static_assert(std::is_trivially_copyable_v<optional_quantity<length_fp>>);
+static_assert(std::is_nothrow_default_constructible_v<optional_quantity<length_fp>>);
+
+static_assert(std::is_same_v<optional_quantity<length_fp>::value_type, length_fp>);
+static_assert(wrapped_quantity_<optional_quantity<length_fp>>);
+static_assert(!Representation<optional_quantity<length_fp>>);
+
+// empty state encoding
+
+static_assert(optional_quantity_traits<double>::is_empty(optional_quantity_traits<double>::empty()));
+static_assert(optional_quantity_traits<float>::is_empty(optional_quantity_traits<float>::empty()));
+static_assert(!optional_quantity_traits<double>::is_empty(std::numeric_limits<double>::quiet_NaN()));
+static_assert(!optional_quantity_traits<double>::is_empty(0.));
+static_assert(optional_quantity_traits<int>::empty() == std::numeric_limits<int>::lowest());
+
+// construction
+
+static_assert(!optional_quantity<length_fp>().has_value());
+static_assert(!optional_quantity<length_fp>(std::nullopt).has_value());
+static_assert(!optional_quantity<length_int>().has_value());
+static_assert(optional_quantity<length_fp>(length_fp(0.)).has_value());
+static_assert(optional_quantity<length_fp>(length_fp(std::numeric_limits<double>::quiet_NaN())).has_value());
+static_assert(optional_quantity<length_int>(length_int(0)).has_value());
+static_assert(optional_quantity<length_int>(length_int(std::numeric_limits<int>::max())).has_value());
+static_assert(!optional_quantity<length_u16, sentinel_value<std::uint16_t, 0xFFFF>>().has_value());
+static_assert(optional_quantity<length_u16, sentinel_value<std::uint16_t, 0xFFFF>>(length_u16(std::uint16_t{0})).has_value());
+
+static_assert(std::is_convertible_v<length_fp, optional_quantity<length_fp>>);
+static_assert(std::is_convertible_v<length<kilometre, double>, optional_quantity<length_fp>>);
+static_assert(!std::is_convertible_v<length<metre, double>, optional_quantity<length<kilometre, int>>>);
+static_assert(!std::is_constructible_v<optional_quantity<length_fp>, time<second, double>>);
+
+static_assert(*optional_quantity<length_fp>(length<kilometre, double>(1.)) == length_fp(1000.));
+static_assert(*optional_quantity<length_fp>(std::optional<length_fp>(length_fp(2.))) == length_fp(2.));
+static_assert(!optional_quantity<length_fp>(std::optional<length_fp>()).has_value());
+static_assert(std::is_same_v<decltype(optional_quantity(length_fp(1.))), optional_quantity<length_fp>>);
+
+// observers
+
+static_assert(optional_quantity<length_fp>(length_fp(2.))->number() == 2.);
+static_assert(optional_quantity<length_fp>(length_fp(2.)).value() == length_fp(2.));
+static_assert(optional_quantity<length_fp>().value_or(length_fp(3.)) == length_fp(3.));
+static_assert(optional_quantity<length_fp>(length_fp(2.)).value_or(length_fp(3.)) == length_fp(2.));
+static_assert(static_cast<std::optional<length_fp>>(optional_quantity<length_fp>(length_fp(2.))) == length_fp(2.));
+static_assert(!static_cast<std::optional<length_fp>>(optional_quantity<length_fp>()).has_value());
+
+// modifiers
+
+static_assert([] {
+  optional_quantity<length_int> opt;
+  opt = length_int(2);
+  if (!opt || *opt != length_int(2)) return false;
+  opt = std::nullopt;
+  if (opt) return false;
+  opt.emplace(3);
+  if (*opt != length_int(3)) return false;
+  opt.reset();
+  return !opt.has_value();
+}());
+
+static_assert([] {
+  optional_quantity<length_fp> a(length_fp(1.));
+  optional_quantity<length_fp> b;
+  swap(a, b);
+  return !a && *b == length_fp(1.);
+}());
+
+// monadic operations
+
+static_assert(optional_quantity<length_fp>(length_fp(4.))
+                .transform([](const length_fp& l) { return l / time<second, double>(2.); })
+                .value() == speed<metre_per_second, double>(2.));
+static_assert(std::is_same_v<decltype(optional_quantity<length_fp>().transform([](const length_fp& l) { return l * 2.; })),
+                             optional_quantity<length_fp>>);
+static_assert(std::is_same_v<decltype(optional_quantity<length_fp>().transform([](const length_fp& l) { return l.number() > 0; })),
+                             std::optional<bool>>);
+static_assert(!optional_quantity<length_fp>().transform([](const length_fp& l) { return l * 2.; }).has_value());
+
+constexpr auto positive = [](const length_fp& l) {
+  return l > length_fp(0.) ? optional_quantity<length_fp>(l) : optional_quantity<length_fp>();
+};
+static_assert(optional_quantity<length_fp>(length_fp(1.)).and_then(positive).has_value());
+static_assert(!optional_quantity<length_fp>(length_fp(-1.)).and_then(positive).has_value());
+static_assert(!optional_quantity<length_fp>().and_then(positive).has_value());
+
+static_assert(*optional_quantity<length_fp>().or_else([] { return optional_quantity<length_fp>(length_fp(5.)); }) == length_fp(5.));
+static_assert(*optional_quantity<length_fp>(length_fp(1.)).or_else([] { return optional_quantity<length_fp>(length_fp(5.)); }) == length_fp(1.));
+
+// comparisons
+
+static_assert(optional_quantity<length_fp>() == optional_quantity<length_fp>());
+static_assert(optional_quantity<length_fp>() == std::nullopt);
+static_assert(optional_quantity<length_fp>(length_fp(1.)) != std::nullopt);
+static_assert(optional_quantity<length_fp>(length_fp(1.)) == optional_quantity<length_fp>(length_fp(1.)));
+static_assert(optional_quantity<length_fp>(length_fp(1.)) != optional_quantity<length_fp>(length_fp(2.)));
+static_assert(optional_quantity<length_fp>(length_fp(1.)) != optional_quantity<length_fp>());
+static_assert(optional_quantity<length_fp>(length_fp(1.)) == length_fp(1.));
+static_assert(optional_quantity<length_fp>() != length_fp(1.));
+
+}  // namespace
@@ -0,0 +1,126 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/overflow_checked.h>
+#include <units/isq/si/length.h>
+#include <units/isq/si/speed.h>
+#include <units/isq/si/time.h>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace {
+
+using namespace units;
+using namespace units::isq::si;
+
+using c32 = checked<std::int32_t>;
+using c64 = checked<std::int64_t>;
+using s8 = saturating<std::int8_t>;
+using s64 = saturating<std::int64_t>;
+using su16 = saturating<std::uint16_t>;
+
+static_assert(Representation<c64>);
+static_assert(Representation<s8>);
+static_assert(Representation<su16>);
+static_assert(!treat_as_floating_point<c64>);
+static_assert(sizeof(c64) == sizeof(std::int64_t));
+static_assert(sizeof(isq::si::time<nanosecond, c64>) == sizeof(std::int64_t));
+
+// quantity_values
+static_assert(length<metre, s8>::zero().number() == 0);
+static_assert(length<metre, s8>::one().number() == 1);
+static_assert(length<metre, s8>::min().number() == -128);
+static_assert(length<metre, s8>::max().number() == 127);
+
+// construction
+static_assert(s8(1000) == 127);
+static_assert(s8(-1000) == -128);
+static_assert(su16(-1) == 0);
+static_assert(s8(300.) == 127);
+static_assert(su16(-0.5) == 0);
+static_assert(c32(42) == 42);
+static_assert(std::is_convertible_v<c32, c64>);
+static_assert(!std::is_convertible_v<c64, c32>);
+static_assert(!std::is_convertible_v<c32, s64>);
+static_assert(!std::is_convertible_v<double, c32>);
+static_assert(static_cast<std::int8_t>(s64(1000)) == 127);
+static_assert(static_cast<double>(c32(3)) == 3.);
+
+// saturating arithmetic
+static_assert(s8(100) + s8(100) == 127);
+static_assert(s8(-100) + s8(-100) == -128);
+static_assert(s8(-100) - s8(100) == -128);
+static_assert(s8(100) - s8(-100) == 127);
+static_assert(s8(16) * s8(16) == 127);
+static_assert(s8(-16) * s8(16) == -128);
+static_assert(s8(-128) / s8(-1) == 127);
+static_assert(s8(-128) % s8(-1) == 0);
+static_assert(-s8(-128) == 127);
+static_assert(-su16(1) == 0);
+static_assert(su16(1) - su16(2) == 0);
+static_assert(s64(std::numeric_limits<std::int64_t>::max()) + s64(1) == std::numeric_limits<std::int64_t>::max());
+static_assert([] {
+  s8 v(126);
+  ++v;
+  ++v;
+  return v == 127;
+}());
+
+// checked arithmetic is usable in constant expressions unless it overflows
+static_assert(c32(20) * c32(30) == 600);
+static_assert(c32(7) % c32(4) == 3);
+
+// common type
+static_assert(std::is_same_v<std::common_type_t<c32, c64>, c64>);
+static_assert(std::is_same_v<std::common_type_t<c32, std::int64_t>, c64>);
+static_assert(std::is_same_v<std::common_type_t<double, c32>, double>);
+
+// quantity arithmetic
+static_assert(length<metre, s8>(100) + length<metre, s8>(100) == length<metre, s8>(127));
+static_assert(length<metre, s8>(100) * 2 == length<metre, s8>(127));
+static_assert(length<metre, c32>(6) / isq::si::time<second, c32>(2) == speed<metre_per_second, c32>(3));
+
+// conversions
+static_assert(quantity_cast<isq::si::time<nanosecond, s64>>(isq::si::time<second, s64>(10'000'000'000)).number() ==
+              std::numeric_limits<std::int64_t>::max());
+static_assert(quantity_cast<isq::si::time<nanosecond, s64>>(isq::si::time<second, s64>(-10'000'000'000)).number() ==
+              std::numeric_limits<std::int64_t>::lowest());
+static_assert(quantity_cast<isq::si::time<nanosecond, c64>>(isq::si::time<second, c64>(3)).number() == 3'000'000'000);
+static_assert(quantity_cast<length<metre, s8>>(length<kilometre, int>(1)).number() == 127);
+static_assert(quantity_cast<length<metre, std::int8_t>>(length<kilometre, s8>(1)).number() == 127);
+static_assert(quantity_cast<length<metre, s8>>(length<millimetre, s64>(100'000'000)).number() == 127);
+static_assert(quantity_cast<length<kilometre, s8>>(length<metre, s64>(5'000)).number() == 5);
+static_assert(quantity_cast<length<metre, double>>(length<kilometre, c32>(2)).number() == 2000.);
+static_assert(quantity_cast<length<metre, s8>>(length<kilometre, double>(1.)).number() == 127);
+static_assert(isq::si::time<nanosecond, c64>(isq::si::time<millisecond, c32>(3)).number() == 3'000'000);
+
+// checks elided at compile-time when the scaled range provably fits
+static_assert(detail::integer_scale<std::int32_t, std::int64_t, ratio(1'000'000)>::always_fits);
+static_assert(detail::integer_scale<std::int64_t, std::int32_t, ratio(1, 1'000'000'000'000)>::always_fits);
+static_assert(detail::integer_scale<std::uint16_t, std::int32_t, ratio(1000)>::always_fits);
+static_assert(!detail::integer_scale<std::int64_t, std::int64_t, ratio(1000)>::always_fits);
+static_assert(!detail::integer_scale<std::int32_t, std::int32_t, ratio(1000)>::always_fits);
+static_assert(!detail::integer_scale<std::int64_t, std::int8_t, ratio(1, 1000)>::always_fits);
+static_assert(!detail::integer_scale<std::uint64_t, std::int64_t, ratio(1)>::always_fits);
+
+}  // namespace
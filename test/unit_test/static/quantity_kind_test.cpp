@@ -62,6 +62,20 @@ struct time_kind : kind<time_kind, dim_time> {};
 
 struct cgs_width_kind : kind<cgs_width_kind, cgs::dim_length> {};
 
+}  // namespace
+
+UNITS_DOWNCAST_REGISTER(radius_kind);
+UNITS_DOWNCAST_REGISTER(width_kind);
+UNITS_DOWNCAST_REGISTER(height_kind);
+UNITS_DOWNCAST_REGISTER(horizontal_area_kind);
+UNITS_DOWNCAST_REGISTER(rate_of_climb_kind);
+UNITS_DOWNCAST_REGISTER(apple);
+UNITS_DOWNCAST_REGISTER(orange);
+UNITS_DOWNCAST_REGISTER(time_kind);
+UNITS_DOWNCAST_REGISTER(cgs_width_kind);
+
+namespace {
+
 template <Unit U, Representation Rep = double> using radius = quantity_kind<radius_kind, U, Rep>;
 template <Unit U, Representation Rep = double> using width = quantity_kind<width_kind, U, Rep>;
 template <Unit U, Representation Rep = double> using height = quantity_kind<height_kind, U, Rep>;
@@ -79,6 +79,29 @@ struct time_point_kind : point_kind<time_point_kind, time_kind> {};
 
 struct sys_time_point_kind : point_kind<time_point_kind, time_kind, clock_origin<std::chrono::system_clock>> {};
 
+}  // namespace
+
+UNITS_DOWNCAST_REGISTER(width_kind);
+UNITS_DOWNCAST_REGISTER(height_kind);
+UNITS_DOWNCAST_REGISTER(abscissa_kind);
+UNITS_DOWNCAST_REGISTER(ordinate_kind);
+UNITS_DOWNCAST_REGISTER(distance_kind);
+UNITS_DOWNCAST_REGISTER(cgs_width_kind);
+UNITS_DOWNCAST_REGISTER(cgs_height_kind);
+UNITS_DOWNCAST_REGISTER(rate_of_climb_kind);
+UNITS_DOWNCAST_REGISTER(altitude_kind);
+UNITS_DOWNCAST_REGISTER(sea_level_altitude_kind);
+UNITS_DOWNCAST_REGISTER(screen_si_width_kind);
+UNITS_DOWNCAST_REGISTER(screen_si_cgs_width_kind);
+UNITS_DOWNCAST_REGISTER(apple);
+UNITS_DOWNCAST_REGISTER(orange);
+UNITS_DOWNCAST_REGISTER(nth_apple_kind);
+UNITS_DOWNCAST_REGISTER(nth_orange_kind);
+UNITS_DOWNCAST_REGISTER(time_kind);
+UNITS_DOWNCAST_REGISTER(time_point_kind);
+
+namespace {
+
 template <Unit U, Representation Rep = double> using width = quantity_kind<width_kind, U, Rep>;
 template <Unit U, Representation Rep = double> using height = quantity_kind<height_kind, U, Rep>;
 template <Unit U, Representation Rep = double> using abscissa = quantity_point_kind<abscissa_kind, U, Rep>;
@@ -83,6 +83,13 @@ static_assert(sqrt(ratio(9, 1, 2)) == ratio(3, 1, 1));
 static_assert(cbrt(ratio(27, 1, 3)) == ratio(3, 1, 1));
 static_assert(cbrt(ratio(27, 1, 2)) == ratio(13, 1, 0));
 
+// exact roots close to the range of std::intmax_t
+static_assert(sqrt(ratio(9'223'372'030'926'249'001)) == ratio(3'037'000'499));
+static_assert(sqrt(ratio(9'223'372'036'854'775'807)) == ratio(3'037'000'499));
+static_assert(cbrt(ratio(9'223'358'842'721'533'951)) == ratio(2'097'151));
+static_assert(cbrt(ratio(9'223'358'842'721'533'950)) == ratio(2'097'150));
+static_assert(pow<1, 25>(ratio(1'125'899'906'842'624, 1, 0)) == ratio(4));
+
 // common_ratio
 static_assert(common_ratio(ratio(1), ratio(1000)) == ratio(1));
 static_assert(common_ratio(ratio(1000), ratio(1)) == ratio(1));
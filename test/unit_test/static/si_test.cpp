@@ -269,6 +269,11 @@ static_assert(10_q_m_per_s / 1_q_m_per_s2 == 10_q_s);
 static_assert(1_q_m_per_s2 * 10_q_s == 10_q_m_per_s);
 
 static_assert(detail::unit_text<dim_acceleration, metre_per_second_sq>() == basic_symbol_text("m/s²", "m/s^2"));
+static_assert(detail::unit_symbol<dim_acceleration, metre_per_second_sq> == basic_symbol_text("m/s²", "m/s^2"));
+static_assert(detail::unit_symbol_standard<dim_acceleration, metre_per_second_sq>() == "m/s²");
+static_assert(detail::unit_symbol_ascii<dim_acceleration, metre_per_second_sq>() == "m/s^2");
+static_assert(std::is_same_v<decltype(detail::unit_symbol_standard<dim_acceleration, metre_per_second_sq>()), std::string_view>);
+static_assert(std::is_same_v<decltype(detail::unit_symbol_ascii<dim_acceleration, metre_per_second_sq>()), std::string_view>);
 
 // area
 
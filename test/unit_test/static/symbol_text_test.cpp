@@ -92,4 +92,8 @@ static_assert(sym6 + basic_fixed_string("f") == basic_symbol_text("bcf", "def"))
 static_assert("a" + sym6 == basic_symbol_text("abc", "ade"));
 static_assert(sym6 + "f" == basic_symbol_text("bcf", "def"));
 
+static_assert(concat(sym4, sym6) == basic_symbol_text("bcbc", "bcde"));
+static_assert(concat(basic_fixed_string("a"), sym6, basic_fixed_string("f")) == basic_symbol_text("abcf", "adef"));
+static_assert(concat(sym6, basic_symbol_text("", "^"), basic_symbol_text("\u00b2", "2")) == basic_symbol_text("bc\u00b2", "de^2"));
+
 }
@@ -24,6 +24,7 @@
 #include <units/bits/external/type_list.h>
 #include <units/exponent.h>
 #include <units/unit.h>
+#include <type_traits>
 
 namespace {
 
@@ -114,4 +115,18 @@ static_assert(
 static_assert(
     is_same_v<exp_sort<exponent_list<units::exponent<d1, 1>, units::exponent<d0, -1>>>, exponent_list<units::exponent<d0, -1>, units::exponent<d1, 1>>>);
 
+template<int I>
+using int_ = std::integral_constant<int, I>;
+
+template<typename T1, typename T2>
+using int_less = std::bool_constant<(T1::value / 10 < T2::value / 10)>;
+
+static_assert(is_same_v<type_list_sort<type_list<>, int_less>, type_list<>>);
+static_assert(is_same_v<type_list_sort<type_list<int_<50>, int_<30>, int_<70>, int_<10>, int_<60>, int_<20>, int_<40>>, int_less>,
+                        type_list<int_<10>, int_<20>, int_<30>, int_<40>, int_<50>, int_<60>, int_<70>>>);
+
+// equivalent elements preserve their order
+static_assert(is_same_v<type_list_sort<type_list<int_<21>, int_<10>, int_<22>, int_<11>, int_<23>>, int_less>,
+                        type_list<int_<10>, int_<11>, int_<21>, int_<22>, int_<23>>>);
+
 }  // namespace
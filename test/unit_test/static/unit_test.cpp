@@ -54,6 +54,22 @@ struct metre_per_second : unit<metre_per_second> {};
 struct dim_speed : derived_dimension<dim_speed, metre_per_second, units::exponent<dim_length, 1>, units::exponent<dim_time, -1>> {};
 struct kilometre_per_hour : derived_unit<kilometre_per_hour, dim_speed, kilometre, hour> {};
 
+}  // namespace
+
+UNITS_DOWNCAST_REGISTER(metre);
+UNITS_DOWNCAST_REGISTER(centimetre);
+UNITS_DOWNCAST_REGISTER(kilometre);
+UNITS_DOWNCAST_REGISTER(yard);
+UNITS_DOWNCAST_REGISTER(foot);
+UNITS_DOWNCAST_REGISTER(second);
+UNITS_DOWNCAST_REGISTER(hour);
+UNITS_DOWNCAST_REGISTER(kelvin);
+UNITS_DOWNCAST_REGISTER(metre_per_second);
+UNITS_DOWNCAST_REGISTER(dim_speed);
+UNITS_DOWNCAST_REGISTER(kilometre_per_hour);
+
+namespace {
+
 static_assert(equivalent<metre::named_unit, metre>);
 static_assert(equivalent<metre::scaled_unit, metre>);
 static_assert(compare<downcast<scaled_unit<ratio(1), metre>>, metre>);
@@ -0,0 +1,67 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/views.h>
+#include <units/isq/si/length.h>
+#include <units/isq/si/time.h>
+#include <algorithm>
+#include <array>
+#include <ranges>
+#include <type_traits>
+
+namespace {
+
+using namespace units;
+using namespace units::isq::si;
+
+constexpr std::array<length<kilometre, int>, 3> distances = {length<kilometre, int>(1), length<kilometre, int>(2),
+                                                             length<kilometre, int>(3)};
+using km_view = std::ranges::ref_view<const std::array<length<kilometre, int>, 3>>;
+
+// as_unit
+using as_m = decltype(distances | views::as_unit<metre>);
+static_assert(std::ranges::view<as_m>);
+static_assert(std::ranges::random_access_range<as_m>);
+static_assert(std::ranges::sized_range<as_m>);
+static_assert(std::is_same_v<std::ranges::range_value_t<as_m>, length<metre, int>>);
+static_assert(std::is_same_v<decltype(views::as_unit<metre>(distances)), as_m>);
+static_assert(std::ranges::size(distances | views::as_unit<metre>) == 3);
+static_assert((distances | views::as_unit<metre>)[1] == length<metre, int>(2'000));
+static_assert(std::ranges::equal(distances | views::as_unit<metre> | views::numbers, std::array{1'000, 2'000, 3'000}));
+static_assert(!std::invocable<decltype(views::as_unit<second>), km_view>);
+
+// as_rep
+using as_double = decltype(distances | views::as_rep<double>);
+static_assert(std::ranges::random_access_range<as_double>);
+static_assert(std::ranges::sized_range<as_double>);
+static_assert(std::is_same_v<std::ranges::range_value_t<as_double>, length<kilometre, double>>);
+static_assert((distances | views::as_rep<double> | views::as_unit<megametre>)[2].number() == 0.003);
+
+// numbers
+using nums = decltype(distances | views::numbers);
+static_assert(std::ranges::random_access_range<nums>);
+static_assert(std::ranges::sized_range<nums>);
+static_assert(std::is_same_v<std::ranges::range_value_t<nums>, int>);
+static_assert(std::ranges::equal(distances | views::numbers, std::array{1, 2, 3}));
+static_assert(!std::invocable<decltype(views::numbers), std::array<int, 3>&>);
+
+}  // namespace